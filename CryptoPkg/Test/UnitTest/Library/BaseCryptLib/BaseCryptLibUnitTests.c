@@ -27,6 +27,13 @@ SUITE_DESC  mSuiteDesc[] = {
   { "OAEP encrypt verify tests",   "CryptoPkg.BaseCryptLib", NULL, NULL, &mOaepTestNum,           mOaepTest           },
 };
 
+BENCHMARK_SUITE_DESC  mBenchmarkSuiteDesc[] = {
+  //
+  // Title--------------------Package-------------------BenchmarkNum--------BenchmarkDesc
+  //
+  { "HASH benchmarks", "CryptoPkg.BaseCryptLib", &mHashBenchmarkNum, mHashBenchmark },
+};
+
 EFI_STATUS
 EFIAPI
 CreateUnitTest (
@@ -66,6 +73,32 @@ CreateUnitTest (
     }
   }
 
+  for (SuiteIndex = 0; SuiteIndex < ARRAY_SIZE (mBenchmarkSuiteDesc); SuiteIndex++) {
+    UNIT_TEST_SUITE_HANDLE  Suite = NULL;
+    Status = CreateUnitTestSuite (&Suite, *Framework, mBenchmarkSuiteDesc[SuiteIndex].Title, mBenchmarkSuiteDesc[SuiteIndex].Package, NULL, NULL);
+    if (EFI_ERROR (Status)) {
+      Status = EFI_OUT_OF_RESOURCES;
+      goto EXIT;
+    }
+
+    for (TestIndex = 0; TestIndex < *mBenchmarkSuiteDesc[SuiteIndex].BenchmarkNum; TestIndex++) {
+      Status = AddBenchmarkCase (Suite, (mBenchmarkSuiteDesc[SuiteIndex].BenchmarkDesc + TestIndex)->Description, (mBenchmarkSuiteDesc[SuiteIndex].BenchmarkDesc + TestIndex)->ClassName, (mBenchmarkSuiteDesc[SuiteIndex].BenchmarkDesc + TestIndex)->Func, (mBenchmarkSuiteDesc[SuiteIndex].BenchmarkDesc + TestIndex)->PreReq, (mBenchmarkSuiteDesc[SuiteIndex].BenchmarkDesc + TestIndex)->CleanUp, (mBenchmarkSuiteDesc[SuiteIndex].BenchmarkDesc + TestIndex)->Context);
+      if (Status == EFI_UNSUPPORTED) {
+        //
+        // No performance counter to time benchmarks with, run the tests only.
+        //
+        DEBUG ((DEBUG_INFO, "Benchmarks are not enabled, skipping them\n"));
+        Status = EFI_SUCCESS;
+        goto EXIT;
+      }
+
+      if (EFI_ERROR (Status)) {
+        Status = EFI_OUT_OF_RESOURCES;
+        goto EXIT;
+      }
+    }
+  }
+
 EXIT:
   return Status;
 }
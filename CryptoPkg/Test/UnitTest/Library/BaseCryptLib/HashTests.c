@@ -200,3 +200,47 @@ TEST_DESC  mHashTest[] = {
 };
 
 UINTN  mHashTestNum = ARRAY_SIZE (mHashTest);
+
+//
+// Size of the message hashed by the benchmarks
+//
+#define HASH_BENCHMARK_DATA_SIZE  SIZE_4KB
+
+GLOBAL_REMOVE_IF_UNREFERENCED UINT8  mHashBenchmarkData[HASH_BENCHMARK_DATA_SIZE];
+
+/**
+  Hash a 4KB message with the HashAll() function of a HASH_TEST_CONTEXT.
+
+  @param[in]  Context     The HASH_TEST_CONTEXT of the algorithm.
+  @param[in]  Iterations  The number of messages to hash.
+**/
+VOID
+EFIAPI
+BenchmarkHashAll (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  HASH_TEST_CONTEXT  *HashTestContext;
+  UINT8              Digest[MAX_DIGEST_SIZE];
+  UINTN              Index;
+
+  HashTestContext = (HASH_TEST_CONTEXT *)Context;
+  for (Index = 0; Index < Iterations; Index++) {
+    HashTestContext->HashAll (mHashBenchmarkData, HASH_BENCHMARK_DATA_SIZE, Digest);
+  }
+
+  UT_BENCHMARK_KEEP (Digest[0]);
+}
+
+BENCHMARK_DESC  mHashBenchmark[] = {
+  //
+  // -----Description----------------Class-------------------------------Function----------Pre---Post--Context
+  //
+  { "Sha1HashAll() of 4KB",   "CryptoPkg.BaseCryptLib.Hash.Benchmark", BenchmarkHashAll, NULL, NULL, &mSha1TestCtx   },
+  { "Sha256HashAll() of 4KB", "CryptoPkg.BaseCryptLib.Hash.Benchmark", BenchmarkHashAll, NULL, NULL, &mSha256TestCtx },
+  { "Sha384HashAll() of 4KB", "CryptoPkg.BaseCryptLib.Hash.Benchmark", BenchmarkHashAll, NULL, NULL, &mSha384TestCtx },
+  { "Sha512HashAll() of 4KB", "CryptoPkg.BaseCryptLib.Hash.Benchmark", BenchmarkHashAll, NULL, NULL, &mSha512TestCtx },
+};
+
+UINTN  mHashBenchmarkNum = ARRAY_SIZE (mHashBenchmark);
@@ -44,6 +44,22 @@ typedef struct {
   TEST_DESC                   *TestDesc;
 } SUITE_DESC;
 
+typedef struct {
+  CHAR8                           *Description;
+  CHAR8                           *ClassName;
+  UNIT_TEST_BENCHMARK_FUNCTION    Func;
+  UNIT_TEST_PREREQUISITE          PreReq;
+  UNIT_TEST_CLEANUP               CleanUp;
+  UNIT_TEST_CONTEXT               Context;
+} BENCHMARK_DESC;
+
+typedef struct {
+  CHAR8             *Title;
+  CHAR8             *Package;
+  UINTN             *BenchmarkNum;
+  BENCHMARK_DESC    *BenchmarkDesc;
+} BENCHMARK_SUITE_DESC;
+
 extern UINTN      mPkcs7EkuTestNum;
 extern TEST_DESC  mPkcs7EkuTest[];
 
@@ -86,6 +102,9 @@ extern TEST_DESC  mOaepTest[];
 extern UINTN      mRsaPssTestNum;
 extern TEST_DESC  mRsaPssTest[];
 
+extern UINTN           mHashBenchmarkNum;
+extern BENCHMARK_DESC  mHashBenchmark[];
+
 /** Creates a framework you can use */
 EFI_STATUS
 EFIAPI
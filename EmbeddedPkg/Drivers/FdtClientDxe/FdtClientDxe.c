@@ -9,6 +9,7 @@
 
 #include <Library/BaseLib.h>
 #include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
 #include <Library/UefiDriverEntryPoint.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/HobLib.h>
@@ -22,6 +23,33 @@
 
 STATIC VOID  *mDeviceTreeBase;
 
+//
+// Index of the device tree, so that lookups do not have to walk the whole
+// DTB on every query. Each compatible string of each enabled node gets one
+// entry; the entries are sorted by string, then by node offset, so that all
+// nodes compatible with a given string are adjacent and in tree order.
+// The index refers to node offsets and to strings inside the DTB, so it is
+// dropped whenever the DTB is modified and rebuilt on the next lookup. Other
+// drivers may modify the DTB directly (ConsolePrefDxe deletes properties with
+// fdt_delprop (), for example), so the sizes of the DTB are recorded as well,
+// and the index is also rebuilt when they no longer match. In-place edits such
+// as fdt_nop_node () do not change the sizes, so a node found in the index is
+// checked against the DTB before it is returned; if the check fails, the DTB
+// is walked instead and the index is rebuilt on the next lookup.
+//
+typedef struct {
+  CONST CHAR8    *Compatible;
+  INT32          Node;
+} FDT_COMPATIBLE_ENTRY;
+
+STATIC BOOLEAN               mIndexValid;
+STATIC UINT32                mIndexStructSize;
+STATIC UINT32                mIndexTotalSize;
+STATIC FDT_COMPATIBLE_ENTRY  *mCompatibleIndex;
+STATIC UINTN                 mCompatibleIndexCount;
+STATIC INT32                 *mMemoryNodeIndex;
+STATIC UINTN                 mMemoryNodeIndexCount;
+
 STATIC
 EFI_STATUS
 EFIAPI
@@ -70,6 +98,11 @@ SetNodeProperty (
     return EFI_DEVICE_ERROR;
   }
 
+  //
+  // Setting a property may move the nodes and strings that follow it.
+  //
+  mIndexValid = FALSE;
+
   return EFI_SUCCESS;
 }
 
@@ -104,26 +137,250 @@ IsNodeEnabled (
 }
 
 STATIC
-EFI_STATUS
+BOOLEAN
+IsMemoryNode (
+  INT32  Node
+  )
+{
+  CONST CHAR8  *DeviceType;
+  INT32        Len;
+
+  DeviceType = fdt_getprop (mDeviceTreeBase, Node, "device_type", &Len);
+  return (BOOLEAN)((DeviceType != NULL) && (AsciiStrCmp (DeviceType, "memory") == 0));
+}
+
+/**
+  Compares two entries of the compatible index, by compatible string first and
+  by node offset second.
+
+  @param[in] Buffer1  The first FDT_COMPATIBLE_ENTRY.
+  @param[in] Buffer2  The second FDT_COMPATIBLE_ENTRY.
+
+  @return  <0, 0 or >0 if Buffer1 sorts before, equal to or after Buffer2.
+**/
+STATIC
+INTN
 EFIAPI
-FindNextCompatibleNode (
-  IN  FDT_CLIENT_PROTOCOL  *This,
-  IN  CONST CHAR8          *CompatibleString,
-  IN  INT32                PrevNode,
-  OUT INT32                *Node
+CompareCompatibleEntry (
+  IN CONST VOID  *Buffer1,
+  IN CONST VOID  *Buffer2
+  )
+{
+  CONST FDT_COMPATIBLE_ENTRY  *Entry1;
+  CONST FDT_COMPATIBLE_ENTRY  *Entry2;
+  INTN                        Cmp;
+
+  Entry1 = Buffer1;
+  Entry2 = Buffer2;
+
+  Cmp = AsciiStrCmp (Entry1->Compatible, Entry2->Compatible);
+  if (Cmp != 0) {
+    return Cmp;
+  }
+
+  return (INTN)Entry1->Node - (INTN)Entry2->Node;
+}
+
+/**
+  Walks the DTB once, counting or recording the compatible strings and the
+  memory nodes of all enabled nodes. The root node is not included, as it is
+  never returned by the lookup functions.
+
+  @param[out] CompatibleIndex  Receives mCompatibleIndexCount entries, or NULL
+                               to only count them.
+  @param[out] MemoryNodeIndex  Receives mMemoryNodeIndexCount node offsets, in
+                               tree order, or NULL to only count them.
+**/
+STATIC
+VOID
+IndexFdtNodes (
+  OUT FDT_COMPATIBLE_ENTRY  *CompatibleIndex OPTIONAL,
+  OUT INT32                 *MemoryNodeIndex OPTIONAL
+  )
+{
+  INT32        Node;
+  CONST CHAR8  *Type, *Compatible;
+  INT32        Len;
+
+  mCompatibleIndexCount = 0;
+  mMemoryNodeIndexCount = 0;
+
+  for (Node = fdt_next_node (mDeviceTreeBase, 0, NULL);
+       Node >= 0;
+       Node = fdt_next_node (mDeviceTreeBase, Node, NULL))
+  {
+    if (!IsNodeEnabled (Node)) {
+      if ((CompatibleIndex == NULL) && IsMemoryNode (Node)) {
+        DEBUG ((DEBUG_WARN, "%a: ignoring disabled memory node\n", __FUNCTION__));
+      }
+
+      continue;
+    }
+
+    if (IsMemoryNode (Node)) {
+      if (MemoryNodeIndex != NULL) {
+        MemoryNodeIndex[mMemoryNodeIndexCount] = Node;
+      }
+
+      mMemoryNodeIndexCount++;
+    }
+
+    Type = fdt_getprop (mDeviceTreeBase, Node, "compatible", &Len);
+    if (Type == NULL) {
+      continue;
+    }
+
+    //
+    // A 'compatible' node may contain a sequence of NUL terminated
+    // compatible strings so index each one
+    //
+    for (Compatible = Type; Compatible < Type + Len && *Compatible;
+         Compatible += 1 + AsciiStrLen (Compatible))
+    {
+      if (CompatibleIndex != NULL) {
+        CompatibleIndex[mCompatibleIndexCount].Compatible = Compatible;
+        CompatibleIndex[mCompatibleIndexCount].Node       = Node;
+      }
+
+      mCompatibleIndexCount++;
+    }
+  }
+}
+
+/**
+  Makes sure the index matches the current contents of the DTB, rebuilding it
+  if the DTB was modified since it was last built.
+
+  @retval TRUE   The index is valid.
+  @retval FALSE  The index could not be allocated; the caller must walk the
+                 DTB instead.
+**/
+STATIC
+BOOLEAN
+GetFdtIndex (
+  VOID
+  )
+{
+  VOID                  *Buffer;
+  FDT_COMPATIBLE_ENTRY  Swap;
+
+  if (mIndexValid &&
+      (mIndexStructSize == fdt_size_dt_struct (mDeviceTreeBase)) &&
+      (mIndexTotalSize == fdt_totalsize (mDeviceTreeBase)))
+  {
+    return TRUE;
+  }
+
+  mIndexValid = FALSE;
+  if (mCompatibleIndex != NULL) {
+    FreePool (mCompatibleIndex);
+    mCompatibleIndex = NULL;
+    mMemoryNodeIndex = NULL;
+  }
+
+  IndexFdtNodes (NULL, NULL);
+
+  if ((mCompatibleIndexCount + mMemoryNodeIndexCount) > 0) {
+    //
+    // Both tables share one allocation; the memory node offsets follow the
+    // compatible entries.
+    //
+    Buffer = AllocatePool (
+               mCompatibleIndexCount * sizeof (FDT_COMPATIBLE_ENTRY) +
+               mMemoryNodeIndexCount * sizeof (INT32)
+               );
+    if (Buffer == NULL) {
+      DEBUG ((DEBUG_WARN, "%a: out of resources, walking the DTB instead\n", __FUNCTION__));
+      mCompatibleIndexCount = 0;
+      mMemoryNodeIndexCount = 0;
+      return FALSE;
+    }
+
+    mCompatibleIndex = Buffer;
+    mMemoryNodeIndex = (INT32 *)(mCompatibleIndex + mCompatibleIndexCount);
+    IndexFdtNodes (mCompatibleIndex, mMemoryNodeIndex);
+
+    QuickSort (
+      mCompatibleIndex,
+      mCompatibleIndexCount,
+      sizeof (FDT_COMPATIBLE_ENTRY),
+      CompareCompatibleEntry,
+      &Swap
+      );
+  }
+
+  DEBUG ((
+    DEBUG_VERBOSE,
+    "%a: %Lu compatible strings, %Lu memory nodes\n",
+    __FUNCTION__,
+    (UINT64)mCompatibleIndexCount,
+    (UINT64)mMemoryNodeIndexCount
+    ));
+
+  mIndexStructSize = fdt_size_dt_struct (mDeviceTreeBase);
+  mIndexTotalSize  = fdt_totalsize (mDeviceTreeBase);
+  mIndexValid      = TRUE;
+  return TRUE;
+}
+
+/**
+  Returns the first enabled node after PrevNode, in tree order, that is
+  compatible with CompatibleString.
+
+  @param[in] CompatibleString  The compatible string to look for.
+  @param[in] PrevNode          The node to start after, 0 to start at the top.
+
+  @return  The offset of the node, or a negative libfdt error code.
+**/
+STATIC
+INT32
+NextCompatibleNode (
+  IN  CONST CHAR8  *CompatibleString,
+  IN  INT32        PrevNode
   )
 {
+  UINTN        Low, High, Mid;
+  INTN         Cmp;
   INT32        Prev, Next;
   CONST CHAR8  *Type, *Compatible;
   INT32        Len;
 
-  ASSERT (mDeviceTreeBase != NULL);
-  ASSERT (Node != NULL);
+  if (GetFdtIndex ()) {
+    //
+    // Find the first entry that sorts after (CompatibleString, PrevNode).
+    //
+    Low  = 0;
+    High = mCompatibleIndexCount;
+    while (Low < High) {
+      Mid = (Low + High) / 2;
+      Cmp = AsciiStrCmp (mCompatibleIndex[Mid].Compatible, CompatibleString);
+      if ((Cmp < 0) || ((Cmp == 0) && (mCompatibleIndex[Mid].Node <= PrevNode))) {
+        Low = Mid + 1;
+      } else {
+        High = Mid;
+      }
+    }
+
+    if ((Low >= mCompatibleIndexCount) ||
+        (AsciiStrCmp (mCompatibleIndex[Low].Compatible, CompatibleString) != 0))
+    {
+      return -FDT_ERR_NOTFOUND;
+    }
+
+    Next = mCompatibleIndex[Low].Node;
+    if (IsNodeEnabled (Next) &&
+        (fdt_node_check_compatible (mDeviceTreeBase, Next, CompatibleString) == 0))
+    {
+      return Next;
+    }
+
+    mIndexValid = FALSE;
+  }
 
   for (Prev = PrevNode; ; Prev = Next) {
     Next = fdt_next_node (mDeviceTreeBase, Prev, NULL);
     if (Next < 0) {
-      break;
+      return Next;
     }
 
     if (!IsNodeEnabled (Next)) {
@@ -135,21 +392,90 @@ FindNextCompatibleNode (
       continue;
     }
 
-    //
-    // A 'compatible' node may contain a sequence of NUL terminated
-    // compatible strings so check each one
-    //
     for (Compatible = Type; Compatible < Type + Len && *Compatible;
          Compatible += 1 + AsciiStrLen (Compatible))
     {
       if (AsciiStrCmp (CompatibleString, Compatible) == 0) {
-        *Node = Next;
-        return EFI_SUCCESS;
+        return Next;
       }
     }
   }
+}
 
-  return EFI_NOT_FOUND;
+/**
+  Returns the first enabled memory node after PrevNode, in tree order.
+
+  @param[in] PrevNode  The node to start after, 0 to start at the top.
+
+  @return  The offset of the node, or a negative libfdt error code.
+**/
+STATIC
+INT32
+NextMemoryNode (
+  IN  INT32  PrevNode
+  )
+{
+  UINTN  Low, High, Mid;
+  INT32  Prev, Next;
+
+  if (GetFdtIndex ()) {
+    Low  = 0;
+    High = mMemoryNodeIndexCount;
+    while (Low < High) {
+      Mid = (Low + High) / 2;
+      if (mMemoryNodeIndex[Mid] <= PrevNode) {
+        Low = Mid + 1;
+      } else {
+        High = Mid;
+      }
+    }
+
+    if (Low >= mMemoryNodeIndexCount) {
+      return -FDT_ERR_NOTFOUND;
+    }
+
+    Next = mMemoryNodeIndex[Low];
+    if (IsNodeEnabled (Next) && IsMemoryNode (Next)) {
+      return Next;
+    }
+
+    mIndexValid = FALSE;
+  }
+
+  for (Prev = PrevNode; ; Prev = Next) {
+    Next = fdt_next_node (mDeviceTreeBase, Prev, NULL);
+    if (Next < 0) {
+      return Next;
+    }
+
+    if (IsNodeEnabled (Next) && IsMemoryNode (Next)) {
+      return Next;
+    }
+  }
+}
+
+STATIC
+EFI_STATUS
+EFIAPI
+FindNextCompatibleNode (
+  IN  FDT_CLIENT_PROTOCOL  *This,
+  IN  CONST CHAR8          *CompatibleString,
+  IN  INT32                PrevNode,
+  OUT INT32                *Node
+  )
+{
+  INT32  Next;
+
+  ASSERT (mDeviceTreeBase != NULL);
+  ASSERT (Node != NULL);
+
+  Next = NextCompatibleNode (CompatibleString, PrevNode);
+  if (Next < 0) {
+    return EFI_NOT_FOUND;
+  }
+
+  *Node = Next;
+  return EFI_SUCCESS;
 }
 
 STATIC
@@ -248,57 +574,42 @@ FindNextMemoryNodeReg (
   OUT UINT32               *RegSize
   )
 {
-  INT32        Prev, Next;
-  CONST CHAR8  *DeviceType;
-  INT32        Len;
-  EFI_STATUS   Status;
+  INT32       Next;
+  EFI_STATUS  Status;
 
   ASSERT (mDeviceTreeBase != NULL);
   ASSERT (Node != NULL);
 
-  for (Prev = PrevNode; ; Prev = Next) {
-    Next = fdt_next_node (mDeviceTreeBase, Prev, NULL);
-    if (Next < 0) {
-      break;
+  for (Next = NextMemoryNode (PrevNode); Next >= 0; Next = NextMemoryNode (Next)) {
+    //
+    // Get the 'reg' property of this memory node. For now, we will assume
+    // 8 byte quantities for base and size, respectively.
+    // TODO use #cells root properties instead
+    //
+    Status = GetNodeProperty (This, Next, "reg", Reg, RegSize);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((
+        DEBUG_WARN,
+        "%a: ignoring memory node with no 'reg' property\n",
+        __FUNCTION__
+        ));
+      continue;
     }
 
-    if (!IsNodeEnabled (Next)) {
-      DEBUG ((DEBUG_WARN, "%a: ignoring disabled memory node\n", __FUNCTION__));
+    if ((*RegSize % 16) != 0) {
+      DEBUG ((
+        DEBUG_WARN,
+        "%a: ignoring memory node with invalid 'reg' property (size == 0x%x)\n",
+        __FUNCTION__,
+        *RegSize
+        ));
       continue;
     }
 
-    DeviceType = fdt_getprop (mDeviceTreeBase, Next, "device_type", &Len);
-    if ((DeviceType != NULL) && (AsciiStrCmp (DeviceType, "memory") == 0)) {
-      //
-      // Get the 'reg' property of this memory node. For now, we will assume
-      // 8 byte quantities for base and size, respectively.
-      // TODO use #cells root properties instead
-      //
-      Status = GetNodeProperty (This, Next, "reg", Reg, RegSize);
-      if (EFI_ERROR (Status)) {
-        DEBUG ((
-          DEBUG_WARN,
-          "%a: ignoring memory node with no 'reg' property\n",
-          __FUNCTION__
-          ));
-        continue;
-      }
-
-      if ((*RegSize % 16) != 0) {
-        DEBUG ((
-          DEBUG_WARN,
-          "%a: ignoring memory node with invalid 'reg' property (size == 0x%x)\n",
-          __FUNCTION__,
-          *RegSize
-          ));
-        continue;
-      }
-
-      *Node         = Next;
-      *AddressCells = 2;
-      *SizeCells    = 2;
-      return EFI_SUCCESS;
-    }
+    *Node         = Next;
+    *AddressCells = 2;
+    *SizeCells    = 2;
+    return EFI_SUCCESS;
   }
 
   return EFI_NOT_FOUND;
@@ -342,7 +653,8 @@ GetOrInsertChosenNode (
 
   NewNode = fdt_path_offset (mDeviceTreeBase, "/chosen");
   if (NewNode < 0) {
-    NewNode = fdt_add_subnode (mDeviceTreeBase, 0, "/chosen");
+    NewNode     = fdt_add_subnode (mDeviceTreeBase, 0, "/chosen");
+    mIndexValid = FALSE;
   }
 
   if (NewNode < 0) {
@@ -7,6 +7,85 @@ bbe
 
 #include "EmuBlockIo.h"
 
+/**
+  Signal the events of the non-blocking requests the host has completed.
+
+  The host sets Token->TransactionStatus to EFI_NOT_READY while a request is
+  in flight and stores the final status once it is done.
+
+  @param[in]  Event    The poll timer event, or NULL.
+  @param[in]  Context  The EMU_BLOCK_IO_PRIVATE of the device.
+
+**/
+VOID
+EFIAPI
+EmuBlockIo2PollTokens (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  EMU_BLOCK_IO_PRIVATE   *Private;
+  LIST_ENTRY             *Link;
+  EMU_BLOCK_IO2_PENDING  *Pending;
+
+  Private = Context;
+
+  Link = GetFirstNode (&Private->PendingTokens);
+  while (!IsNull (&Private->PendingTokens, Link)) {
+    Pending = BASE_CR (Link, EMU_BLOCK_IO2_PENDING, Link);
+    Link    = GetNextNode (&Private->PendingTokens, Link);
+
+    if (*(volatile EFI_STATUS *)&Pending->Token->TransactionStatus != EFI_NOT_READY) {
+      RemoveEntryList (&Pending->Link);
+      gBS->SignalEvent (Pending->Token->Event);
+      FreePool (Pending);
+    }
+  }
+
+  if (IsListEmpty (&Private->PendingTokens)) {
+    gBS->SetTimer (Private->PollEvent, TimerCancel, 0);
+  }
+}
+
+/**
+  Track a non-blocking request handed to the host, so that its event gets
+  signaled once the host completes it.
+
+  @param[in]  Private  The device.
+  @param[in]  Pending  The tracking entry allocated for the request, or NULL
+                       for a blocking request.
+  @param[in]  Token    The token of the request.
+  @param[in]  Status   The status the host returned for the request.
+
+**/
+VOID
+EmuBlockIo2TrackToken (
+  IN EMU_BLOCK_IO_PRIVATE   *Private,
+  IN EMU_BLOCK_IO2_PENDING  *Pending,
+  IN EFI_BLOCK_IO2_TOKEN    *Token,
+  IN EFI_STATUS             Status
+  )
+{
+  if (Pending == NULL) {
+    return;
+  }
+
+  if (EFI_ERROR (Status)) {
+    //
+    // The event of a failed request is not signaled.
+    //
+    FreePool (Pending);
+    return;
+  }
+
+  if (IsListEmpty (&Private->PendingTokens)) {
+    gBS->SetTimer (Private->PollEvent, TimerPeriodic, EMU_BLOCK_IO2_POLL_INTERVAL);
+  }
+
+  Pending->Token = Token;
+  InsertTailList (&Private->PendingTokens, &Pending->Link);
+}
+
 /**
   Reset the block device hardware.
 
@@ -85,15 +164,26 @@ EmuBlockIo2ReadBlocksEx (
   OUT VOID                       *Buffer
   )
 {
-  EFI_STATUS            Status;
-  EMU_BLOCK_IO_PRIVATE  *Private;
-  EFI_TPL               OldTpl;
+  EFI_STATUS             Status;
+  EMU_BLOCK_IO_PRIVATE   *Private;
+  EFI_TPL                OldTpl;
+  EMU_BLOCK_IO2_PENDING  *Pending;
 
   Private = EMU_BLOCK_IO2_PRIVATE_DATA_FROM_THIS (This);
 
   OldTpl = gBS->RaiseTPL (TPL_CALLBACK);
 
+  Pending = NULL;
+  if ((Token != NULL) && (Token->Event != NULL)) {
+    Pending = AllocatePool (sizeof (EMU_BLOCK_IO2_PENDING));
+    if (Pending == NULL) {
+      gBS->RestoreTPL (OldTpl);
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
   Status = Private->Io->ReadBlocks (Private->Io, MediaId, LBA, Token, BufferSize, Buffer);
+  EmuBlockIo2TrackToken (Private, Pending, Token, Status);
 
   gBS->RestoreTPL (OldTpl);
   return Status;
@@ -141,15 +231,26 @@ EmuBlockIo2WriteBlocksEx (
   IN     VOID                    *Buffer
   )
 {
-  EFI_STATUS            Status;
-  EMU_BLOCK_IO_PRIVATE  *Private;
-  EFI_TPL               OldTpl;
+  EFI_STATUS             Status;
+  EMU_BLOCK_IO_PRIVATE   *Private;
+  EFI_TPL                OldTpl;
+  EMU_BLOCK_IO2_PENDING  *Pending;
 
   Private = EMU_BLOCK_IO2_PRIVATE_DATA_FROM_THIS (This);
 
   OldTpl = gBS->RaiseTPL (TPL_CALLBACK);
 
+  Pending = NULL;
+  if ((Token != NULL) && (Token->Event != NULL)) {
+    Pending = AllocatePool (sizeof (EMU_BLOCK_IO2_PENDING));
+    if (Pending == NULL) {
+      gBS->RestoreTPL (OldTpl);
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
   Status = Private->Io->WriteBlocks (Private->Io, MediaId, LBA, Token, BufferSize, Buffer);
+  EmuBlockIo2TrackToken (Private, Pending, Token, Status);
 
   gBS->RestoreTPL (OldTpl);
   return Status;
@@ -184,15 +285,26 @@ EmuBlockIo2Flush (
   IN OUT EFI_BLOCK_IO2_TOKEN     *Token
   )
 {
-  EFI_STATUS            Status;
-  EMU_BLOCK_IO_PRIVATE  *Private;
-  EFI_TPL               OldTpl;
+  EFI_STATUS             Status;
+  EMU_BLOCK_IO_PRIVATE   *Private;
+  EFI_TPL                OldTpl;
+  EMU_BLOCK_IO2_PENDING  *Pending;
 
   Private = EMU_BLOCK_IO2_PRIVATE_DATA_FROM_THIS (This);
 
   OldTpl = gBS->RaiseTPL (TPL_CALLBACK);
 
+  Pending = NULL;
+  if ((Token != NULL) && (Token->Event != NULL)) {
+    Pending = AllocatePool (sizeof (EMU_BLOCK_IO2_PENDING));
+    if (Pending == NULL) {
+      gBS->RestoreTPL (OldTpl);
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
   Status = Private->Io->FlushBlocks (Private->Io, Token);
+  EmuBlockIo2TrackToken (Private, Pending, Token, Status);
 
   gBS->RestoreTPL (OldTpl);
   return Status;
@@ -539,6 +651,19 @@ EmuBlockIoDriverBindingStart (
 
   Private->ControllerNameTable = NULL;
 
+  InitializeListHead (&Private->PendingTokens);
+  Status = gBS->CreateEvent (
+                  EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                  TPL_CALLBACK,
+                  EmuBlockIo2PollTokens,
+                  Private,
+                  &Private->PollEvent
+                  );
+  if (EFI_ERROR (Status)) {
+    Private->PollEvent = NULL;
+    goto Done;
+  }
+
   Status = Private->Io->CreateMapping (Private->Io, &Private->Media);
   if (EFI_ERROR (Status)) {
     goto Done;
@@ -576,6 +701,10 @@ Done:
         FreeUnicodeStringTable (Private->ControllerNameTable);
       }
 
+      if (Private->PollEvent != NULL) {
+        gBS->CloseEvent (Private->PollEvent);
+      }
+
       gBS->FreePool (Private);
     }
 
@@ -668,6 +797,11 @@ EmuBlockIoDriverBindingStop (
     Status = Private->IoThunk->Close (Private->IoThunk);
     ASSERT_EFI_ERROR (Status);
     //
+    // The host has completed all the requests, signal the remaining ones.
+    //
+    EmuBlockIo2PollTokens (Private->PollEvent, Private);
+    gBS->CloseEvent (Private->PollEvent);
+    //
     // Free our instance data
     //
     FreeUnicodeStringTable (Private->ControllerNameTable);
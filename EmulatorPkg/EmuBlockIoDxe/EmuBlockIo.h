@@ -54,8 +54,24 @@ typedef struct {
   EFI_BLOCK_IO_MEDIA          Media;
 
   EFI_UNICODE_STRING_TABLE    *ControllerNameTable;
+
+  //
+  // Non-blocking BlockIo2 requests the host has not completed yet
+  //
+  LIST_ENTRY                  PendingTokens;
+  EFI_EVENT                   PollEvent;
 } EMU_BLOCK_IO_PRIVATE;
 
+//
+// Interval at which the pending non-blocking requests are polled, in 100ns units
+//
+#define EMU_BLOCK_IO2_POLL_INTERVAL  10000
+
+typedef struct {
+  LIST_ENTRY             Link;
+  EFI_BLOCK_IO2_TOKEN    *Token;
+} EMU_BLOCK_IO2_PENDING;
+
 #define EMU_BLOCK_IO_PRIVATE_DATA_FROM_THIS(a) \
          CR(a, EMU_BLOCK_IO_PRIVATE, BlockIo, EMU_BLOCK_IO_PRIVATE_SIGNATURE)
 
@@ -5,7 +5,32 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 **/
 
+#if !defined (__APPLE__) && !defined (_GNU_SOURCE)
+//
+// For O_DIRECT
+//
+#define _GNU_SOURCE
+#endif
+
 #include "Host.h"
+#include <pthread.h>
+
+//
+// Number of host threads that complete non-blocking BlockIo2 requests
+//
+#define EMU_BLOCK_IO_WORKER_THREADS  4
+
+typedef struct _EMU_BLOCK_IO_REQUEST EMU_BLOCK_IO_REQUEST;
+
+struct _EMU_BLOCK_IO_REQUEST {
+  EMU_BLOCK_IO_REQUEST    *Next;
+  BOOLEAN                 Write;
+  off_t                   Offset;
+  UINTN                   BufferSize;
+  VOID                    *Buffer;
+  EFI_BLOCK_IO2_TOKEN     *Token;
+  EFI_STATUS              Status;
+};
 
 #define EMU_BLOCK_IO_PRIVATE_SIGNATURE  SIGNATURE_32 ('E', 'M', 'b', 'k')
 typedef struct {
@@ -21,12 +46,32 @@ typedef struct {
 
   BOOLEAN                  RemovableMedia;
   BOOLEAN                  WriteProtected;
+  BOOLEAN                  DirectIo;
 
   UINT64                   NumberOfBlocks;
   UINT32                   BlockSize;
 
   EMU_BLOCK_IO_PROTOCOL    EmuBlockIo;
   EFI_BLOCK_IO_MEDIA       *Media;
+
+  //
+  // Non-blocking requests, queued for the worker threads
+  //
+  pthread_mutex_t          QueueLock;
+  pthread_cond_t           QueueCond;
+  pthread_cond_t           IdleCond;
+  EMU_BLOCK_IO_REQUEST     *QueueHead;
+  EMU_BLOCK_IO_REQUEST     *QueueTail;
+  //
+  // Completed requests, whose status is applied to Media by the firmware
+  // thread, which is the only one that touches Media
+  //
+  EMU_BLOCK_IO_REQUEST     *DoneHead;
+  EMU_BLOCK_IO_REQUEST     *DoneTail;
+  UINTN                    Outstanding;
+  BOOLEAN                  Shutdown;
+  UINTN                    WorkerCount;
+  pthread_t                Worker[EMU_BLOCK_IO_WORKER_THREADS];
 } EMU_BLOCK_IO_PRIVATE;
 
 #define EMU_BLOCK_IO_PRIVATE_DATA_FROM_THIS(a) \
@@ -95,6 +140,13 @@ EmuBlockIoOpenDevice (
     goto Done;
   }
 
+ #if __APPLE__
+  if (Private->DirectIo) {
+    fcntl (Private->fd, F_NOCACHE, 1);
+  }
+
+ #endif
+
   if (!Private->Media->MediaPresent) {
     //
     // BugBug: try to emulate if a CD appears - notify drivers to check it out
@@ -194,7 +246,7 @@ EmuBlockIoCreateMapping (
   Media->LogicalPartition = FALSE;
   Media->ReadOnly         = Private->WriteProtected;
   Media->WriteCaching     = FALSE;
-  Media->IoAlign          = 1;
+  Media->IoAlign          = Private->DirectIo ? Private->BlockSize : 1;
   Media->LastBlock        = 0; // Filled in by OpenDevice
 
   // EFI_BLOCK_IO_PROTOCOL_REVISION2
@@ -209,43 +261,115 @@ EmuBlockIoCreateMapping (
   return Status;
 }
 
+/**
+  Map errno after a failed transfer to the status of the request.
+
+  The media state is not updated here, as the transfer may have run on a
+  worker thread; see EmuBlockIoUpdateMedia().
+
+  @param[in]  Private  The block device.
+
+  @return The status of the failed request.
+
+**/
 EFI_STATUS
 EmuBlockIoError (
   IN EMU_BLOCK_IO_PRIVATE  *Private
   )
 {
-  EFI_STATUS  Status;
-  BOOLEAN     ReinstallBlockIoFlag;
-
   switch (errno) {
     case EAGAIN:
-      Status                       = EFI_NO_MEDIA;
+      return EFI_NO_MEDIA;
+
+    case EACCES:
+      return EFI_MEDIA_CHANGED;
+
+    case EROFS:
+      return EFI_WRITE_PROTECTED;
+
+    default:
+      return EFI_DEVICE_ERROR;
+  }
+}
+
+/**
+  Update the media state of a device from the status of a transfer.
+
+  Media is shared with the firmware, so this is only called on the firmware
+  thread.
+
+  @param[in]  Private  The block device.
+  @param[in]  Write    TRUE if the transfer was a write.
+  @param[in]  Status   The status of the transfer.
+
+**/
+VOID
+EmuBlockIoUpdateMedia (
+  IN EMU_BLOCK_IO_PRIVATE  *Private,
+  IN BOOLEAN               Write,
+  IN EFI_STATUS            Status
+  )
+{
+  switch (Status) {
+    case EFI_SUCCESS:
+      //
+      // If we read then media is present. If the write succeeded, we are
+      // not write protected either.
+      //
+      Private->Media->MediaPresent = TRUE;
+      if (Write) {
+        Private->Media->ReadOnly = FALSE;
+      }
+
+      break;
+
+    case EFI_NO_MEDIA:
       Private->Media->ReadOnly     = FALSE;
       Private->Media->MediaPresent = FALSE;
-      ReinstallBlockIoFlag         = FALSE;
       break;
 
-    case EACCES:
+    case EFI_MEDIA_CHANGED:
       Private->Media->ReadOnly     = FALSE;
       Private->Media->MediaPresent = TRUE;
       Private->Media->MediaId     += 1;
-      ReinstallBlockIoFlag         = TRUE;
-      Status                       = EFI_MEDIA_CHANGED;
       break;
 
-    case EROFS:
+    case EFI_WRITE_PROTECTED:
       Private->Media->ReadOnly = TRUE;
-      ReinstallBlockIoFlag     = FALSE;
-      Status                   = EFI_WRITE_PROTECTED;
       break;
 
     default:
-      ReinstallBlockIoFlag = FALSE;
-      Status               = EFI_DEVICE_ERROR;
       break;
   }
+}
 
-  return Status;
+/**
+  Apply the status of the non-blocking requests that the worker threads
+  completed to the media state, and free the requests.
+
+  @param[in]  Private  The block device.
+
+**/
+VOID
+EmuBlockIoReapRequests (
+  IN EMU_BLOCK_IO_PRIVATE  *Private
+  )
+{
+  EMU_BLOCK_IO_REQUEST  *Request;
+  EMU_BLOCK_IO_REQUEST  *Next;
+
+  pthread_mutex_lock (&Private->QueueLock);
+  Request           = Private->DoneHead;
+  Private->DoneHead = NULL;
+  Private->DoneTail = NULL;
+  pthread_mutex_unlock (&Private->QueueLock);
+
+  while (Request != NULL) {
+    Next = Request->Next;
+    EmuBlockIoUpdateMedia (Private, Request->Write, Request->Status);
+    free (Request);
+    Request = Next;
+  }
 }
 
 EFI_STATUS
@@ -261,8 +385,8 @@ EmuBlockIoReadWriteCommon (
   EFI_STATUS  Status;
   UINTN       BlockSize;
   UINT64      LastBlock;
-  INT64       DistanceToMove;
-  UINT64      DistanceMoved;
+
+  EmuBlockIoReapRequests (Private);
 
   if (Private->fd < 0) {
     Status = EmuBlockIoOpenDevice (Private);
@@ -304,20 +428,236 @@ EmuBlockIoReadWriteCommon (
     return EFI_INVALID_PARAMETER;
   }
 
-  //
-  // Seek to End of File
-  //
-  DistanceToMove = MultU64x32 (Lba, BlockSize);
-  Status         = SetFilePointer64 (Private, DistanceToMove, &DistanceMoved, SEEK_SET);
+  return EFI_SUCCESS;
+}
 
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_INIT, "WriteBlocks: SetFilePointer failed\n"));
-    return EmuBlockIoError (Private);
+/**
+  Read or write BufferSize bytes at Offset of the device, without using the
+  file pointer so that the worker threads can share the file descriptor.
+
+  @param[in]       Private    The block device.
+  @param[in]       Write      TRUE to write Buffer, FALSE to read into Buffer.
+  @param[in]       Offset     The byte offset in the device.
+  @param[in]       BufferSize The number of bytes to transfer.
+  @param[in, out]  Buffer     The data buffer.
+
+  @retval EFI_SUCCESS         All the data was transferred.
+  @retval Others              The transfer failed, see EmuBlockIoError().
+                              The caller updates the media state with
+                              EmuBlockIoUpdateMedia().
+
+**/
+EFI_STATUS
+EmuBlockIoTransfer (
+  IN     EMU_BLOCK_IO_PRIVATE  *Private,
+  IN     BOOLEAN               Write,
+  IN     off_t                 Offset,
+  IN     UINTN                 BufferSize,
+  IN OUT VOID                  *Buffer
+  )
+{
+  ssize_t  len;
+  UINT8    *Ptr;
+
+  Ptr = Buffer;
+  while (BufferSize > 0) {
+    if (Write) {
+      len = pwrite (Private->fd, Ptr, BufferSize, Offset);
+    } else {
+      len = pread (Private->fd, Ptr, BufferSize, Offset);
+    }
+
+    if (len < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+
+      return EmuBlockIoError (Private);
+    }
+
+    if (len == 0) {
+      //
+      // Unexpected end of file
+      //
+      errno = EIO;
+      return EmuBlockIoError (Private);
+    }
+
+    Ptr        += len;
+    Offset     += len;
+    BufferSize -= len;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Worker thread completing the queued non-blocking requests of a device.
+
+  The request status is stored in Token->TransactionStatus once the transfer
+  is done; it reads EFI_NOT_READY until then. Signaling Token->Event is left
+  to the firmware side, which polls the status. The request then goes on the
+  done list, and the firmware thread applies its status to the media state
+  on its next call into the device.
+
+  @param[in]  Context  The block device.
+
+  @return NULL
+
+**/
+VOID *
+EmuBlockIoWorker (
+  IN VOID  *Context
+  )
+{
+  EMU_BLOCK_IO_PRIVATE  *Private;
+  EMU_BLOCK_IO_REQUEST  *Request;
+  EFI_STATUS            Status;
+
+  Private = Context;
+
+  pthread_mutex_lock (&Private->QueueLock);
+  while (TRUE) {
+    while ((Private->QueueHead == NULL) && !Private->Shutdown) {
+      pthread_cond_wait (&Private->QueueCond, &Private->QueueLock);
+    }
+
+    Request = Private->QueueHead;
+    if (Request == NULL) {
+      break;
+    }
+
+    Private->QueueHead = Request->Next;
+    if (Private->QueueHead == NULL) {
+      Private->QueueTail = NULL;
+    }
+
+    pthread_mutex_unlock (&Private->QueueLock);
+
+    Status          = EmuBlockIoTransfer (Private, Request->Write, Request->Offset, Request->BufferSize, Request->Buffer);
+    Request->Status = Status;
+    Request->Next   = NULL;
+    __atomic_store_n (&Request->Token->TransactionStatus, Status, __ATOMIC_RELEASE);
+
+    pthread_mutex_lock (&Private->QueueLock);
+    if (Private->DoneTail == NULL) {
+      Private->DoneHead = Request;
+    } else {
+      Private->DoneTail->Next = Request;
+    }
+
+    Private->DoneTail = Request;
+    Private->Outstanding--;
+    if (Private->Outstanding == 0) {
+      pthread_cond_broadcast (&Private->IdleCond);
+    }
   }
 
+  pthread_mutex_unlock (&Private->QueueLock);
+  return NULL;
+}
+
+/**
+  Queue a non-blocking request for the worker threads, starting them on the
+  first request.
+
+  @param[in]       Private    The block device.
+  @param[in]       Write      TRUE for a write request, FALSE for a read.
+  @param[in]       Lba        The starting Logical Block Address.
+  @param[in, out]  Token      The token of the request, Token->Event is not NULL.
+  @param[in]       BufferSize The number of bytes to transfer.
+  @param[in, out]  Buffer     The data buffer.
+
+  @retval EFI_SUCCESS          The request is queued.
+  @retval EFI_OUT_OF_RESOURCES The request could not be queued.
+
+**/
+EFI_STATUS
+EmuBlockIoQueueRequest (
+  IN     EMU_BLOCK_IO_PRIVATE  *Private,
+  IN     BOOLEAN               Write,
+  IN     EFI_LBA               Lba,
+  IN OUT EFI_BLOCK_IO2_TOKEN   *Token,
+  IN     UINTN                 BufferSize,
+  IN OUT VOID                  *Buffer
+  )
+{
+  EMU_BLOCK_IO_REQUEST  *Request;
+  sigset_t              SigMask;
+  sigset_t              OldSigMask;
+
+  Request = malloc (sizeof (EMU_BLOCK_IO_REQUEST));
+  if (Request == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Request->Next       = NULL;
+  Request->Write      = Write;
+  Request->Offset     = (off_t)MultU64x32 (Lba, Private->Media->BlockSize);
+  Request->BufferSize = BufferSize;
+  Request->Buffer     = Buffer;
+  Request->Token      = Token;
+
+  pthread_mutex_lock (&Private->QueueLock);
+  if (Private->WorkerCount < EMU_BLOCK_IO_WORKER_THREADS) {
+    //
+    // Threads inherit the signal mask. Start the workers with all signals
+    // masked so that SIGALRM, the emulated timer interrupt, is only ever
+    // delivered to the firmware thread.
+    //
+    sigfillset (&SigMask);
+    pthread_sigmask (SIG_BLOCK, &SigMask, &OldSigMask);
+    while (Private->WorkerCount < EMU_BLOCK_IO_WORKER_THREADS) {
+      if (pthread_create (&Private->Worker[Private->WorkerCount], NULL, EmuBlockIoWorker, Private) != 0) {
+        break;
+      }
+
+      Private->WorkerCount++;
+    }
+
+    pthread_sigmask (SIG_SETMASK, &OldSigMask, NULL);
+  }
+
+  if (Private->WorkerCount == 0) {
+    pthread_mutex_unlock (&Private->QueueLock);
+    free (Request);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Token->TransactionStatus = EFI_NOT_READY;
+  if (Private->QueueTail == NULL) {
+    Private->QueueHead = Request;
+  } else {
+    Private->QueueTail->Next = Request;
+  }
+
+  Private->QueueTail = Request;
+  Private->Outstanding++;
+  pthread_cond_signal (&Private->QueueCond);
+  pthread_mutex_unlock (&Private->QueueLock);
+
   return EFI_SUCCESS;
 }
 
+/**
+  Wait for all the queued non-blocking requests of a device to complete.
+
+  @param[in]  Private  The block device.
+
+**/
+VOID
+EmuBlockIoDrain (
+  IN EMU_BLOCK_IO_PRIVATE  *Private
+  )
+{
+  pthread_mutex_lock (&Private->QueueLock);
+  while (Private->Outstanding != 0) {
+    pthread_cond_wait (&Private->IdleCond, &Private->QueueLock);
+  }
+
+  pthread_mutex_unlock (&Private->QueueLock);
+}
+
 /**
   Read BufferSize bytes from Lba into Buffer.
 
@@ -363,7 +703,6 @@ EmuBlockIoReadBlocks (
 {
   EFI_STATUS            Status;
   EMU_BLOCK_IO_PRIVATE  *Private;
-  ssize_t               len;
 
   Private = EMU_BLOCK_IO_PRIVATE_DATA_FROM_THIS (This);
 
@@ -372,19 +711,24 @@ EmuBlockIoReadBlocks (
     goto Done;
   }
 
-  len = read (Private->fd, Buffer, BufferSize);
-  if (len != BufferSize) {
+  if ((Token != NULL) && (Token->Event != NULL) && (BufferSize != 0)) {
+    //
+    // Non-blocking request, complete it on a worker thread. If it cannot be
+    // queued, complete it now.
+    //
+    Status = EmuBlockIoQueueRequest (Private, FALSE, LBA, Token, BufferSize, Buffer);
+    if (!EFI_ERROR (Status)) {
+      return EFI_SUCCESS;
+    }
+  }
+
+  Status = EmuBlockIoTransfer (Private, FALSE, (off_t)MultU64x32 (LBA, Private->Media->BlockSize), BufferSize, Buffer);
+  EmuBlockIoUpdateMedia (Private, FALSE, Status);
+  if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_INIT, "ReadBlocks: ReadFile failed.\n"));
-    Status = EmuBlockIoError (Private);
     goto Done;
   }
 
-  //
-  // If we read then media is present.
-  //
-  Private->Media->MediaPresent = TRUE;
-  Status                       = EFI_SUCCESS;
-
 Done:
   if (Token != NULL) {
     if (Token->Event != NULL) {
@@ -439,7 +783,6 @@ EmuBlockIoWriteBlocks (
   )
 {
   EMU_BLOCK_IO_PRIVATE  *Private;
-  ssize_t               len;
   EFI_STATUS            Status;
 
   Private = EMU_BLOCK_IO_PRIVATE_DATA_FROM_THIS (This);
@@ -449,20 +792,24 @@ EmuBlockIoWriteBlocks (
     goto Done;
   }
 
-  len = write (Private->fd, Buffer, BufferSize);
-  if (len != BufferSize) {
+  if ((Token != NULL) && (Token->Event != NULL) && (BufferSize != 0)) {
+    //
+    // Non-blocking request, complete it on a worker thread. If it cannot be
+    // queued, complete it now.
+    //
+    Status = EmuBlockIoQueueRequest (Private, TRUE, LBA, Token, BufferSize, Buffer);
+    if (!EFI_ERROR (Status)) {
+      return EFI_SUCCESS;
+    }
+  }
+
+  Status = EmuBlockIoTransfer (Private, TRUE, (off_t)MultU64x32 (LBA, Private->Media->BlockSize), BufferSize, Buffer);
+  EmuBlockIoUpdateMedia (Private, TRUE, Status);
+  if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_INIT, "ReadBlocks: WriteFile failed.\n"));
-    Status = EmuBlockIoError (Private);
     goto Done;
   }
 
-  //
-  // If the write succeeded, we are not write protected and media is present.
-  //
-  Private->Media->MediaPresent = TRUE;
-  Private->Media->ReadOnly     = FALSE;
-  Status                       = EFI_SUCCESS;
-
 Done:
   if (Token != NULL) {
     if (Token->Event != NULL) {
@@ -507,6 +854,12 @@ EmuBlockIoFlushBlocks (
 
   Private = EMU_BLOCK_IO_PRIVATE_DATA_FROM_THIS (This);
 
+  //
+  // Flush covers the non-blocking writes still in flight as well.
+  //
+  EmuBlockIoDrain (Private);
+  EmuBlockIoReapRequests (Private);
+
   if (Private->fd >= 0) {
     fsync (Private->fd);
  #if __APPLE__
@@ -548,6 +901,9 @@ EmuBlockIoReset (
 
   Private = EMU_BLOCK_IO_PRIVATE_DATA_FROM_THIS (This);
 
+  EmuBlockIoDrain (Private);
+  EmuBlockIoReapRequests (Private);
+
   if (Private->fd >= 0) {
     close (Private->fd);
     Private->fd = -1;
@@ -614,6 +970,18 @@ EmuBlockIoThunkOpen (
   CopyMem (&Private->EmuBlockIo, &gEmuBlockIoProtocol, sizeof (gEmuBlockIoProtocol));
   Private->fd        = -1;
   Private->BlockSize = 512;
+  Private->DirectIo  = FALSE;
+
+  pthread_mutex_init (&Private->QueueLock, NULL);
+  pthread_cond_init (&Private->QueueCond, NULL);
+  pthread_cond_init (&Private->IdleCond, NULL);
+  Private->QueueHead   = NULL;
+  Private->QueueTail   = NULL;
+  Private->DoneHead    = NULL;
+  Private->DoneTail    = NULL;
+  Private->Outstanding = 0;
+  Private->Shutdown    = FALSE;
+  Private->WorkerCount = 0;
 
   Private->Filename = StdDupUnicodeToAscii (This->ConfigString);
   if (Private->Filename == NULL) {
@@ -634,6 +1002,13 @@ EmuBlockIoThunkOpen (
         Private->WriteProtected = (BOOLEAN)(*Str == 'O');
       }
 
+      if (*Str == 'D') {
+        //
+        // Bypass the host page cache
+        //
+        Private->DirectIo = TRUE;
+      }
+
       if (*Str == ':') {
         Private->BlockSize = strtol (++Str, NULL, 0);
         break;
@@ -642,6 +1017,12 @@ EmuBlockIoThunkOpen (
   }
 
   Private->Mode = Private->WriteProtected ? O_RDONLY : O_RDWR;
+ #ifdef O_DIRECT
+  if (Private->DirectIo) {
+    Private->Mode |= O_DIRECT;
+  }
+
+ #endif
 
   This->Interface = &Private->EmuBlockIo;
   This->Private   = Private;
@@ -662,6 +1043,22 @@ EmuBlockIoThunkClose (
   Private = This->Private;
 
   if (This->Private != NULL) {
+    //
+    // Let the worker threads finish the queued requests and exit.
+    //
+    pthread_mutex_lock (&Private->QueueLock);
+    Private->Shutdown = TRUE;
+    pthread_cond_broadcast (&Private->QueueCond);
+    pthread_mutex_unlock (&Private->QueueLock);
+    while (Private->WorkerCount > 0) {
+      pthread_join (Private->Worker[--Private->WorkerCount], NULL);
+    }
+
+    EmuBlockIoReapRequests (Private);
+    pthread_cond_destroy (&Private->IdleCond);
+    pthread_cond_destroy (&Private->QueueCond);
+    pthread_mutex_destroy (&Private->QueueLock);
+
     if (Private->Filename != NULL) {
       free (Private->Filename);
     }
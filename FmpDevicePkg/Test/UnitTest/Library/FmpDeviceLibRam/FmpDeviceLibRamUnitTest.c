@@ -0,0 +1,357 @@
+/** @file
+  Unit tests and benchmarks of the RAM-backed FmpDeviceLib.
+
+  The benchmarks time FmpDeviceCheckImageWithStatus() followed by
+  FmpDeviceSetImageWithStatus() of the device library alone, for firmware
+  images of typical sizes. They do not include the capsule parsing,
+  authentication and dependency checks that FmpDxe performs in SetImage()
+  before it calls the device library.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Guid/SystemResourceTable.h>
+#include <LastAttemptStatus.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/FmpDeviceLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UnitTestLib.h>
+
+#define UNIT_TEST_APP_NAME     "FmpDeviceLibRam Unit Test Application"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+typedef struct {
+  UINTN    ImageSize;
+  UINT8    *Image;
+} FMP_DEVICE_BENCHMARK_CONTEXT;
+
+STATIC FMP_DEVICE_BENCHMARK_CONTEXT  mImage1MB  = { SIZE_1MB, NULL };
+STATIC FMP_DEVICE_BENCHMARK_CONTEXT  mImage16MB = { SIZE_16MB, NULL };
+STATIC FMP_DEVICE_BENCHMARK_CONTEXT  mImage64MB = { SIZE_64MB, NULL };
+
+STATIC UINTN    mProgressCalls;
+STATIC UINTN    mLastProgress;
+STATIC BOOLEAN  mProgressMonotonic;
+
+/**
+  Progress callback that records the values it is called with.
+
+  @param[in]  Completion  A value between 1 and 100 indicating the current
+                          completion progress of the firmware update.
+
+  @retval EFI_SUCCESS  The progress was recorded.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+RecordProgress (
+  IN UINTN  Completion
+  )
+{
+  if ((Completion <= mLastProgress) || (Completion > 100)) {
+    mProgressMonotonic = FALSE;
+  }
+
+  mLastProgress = Completion;
+  mProgressCalls++;
+  return EFI_SUCCESS;
+}
+
+/**
+  Fills Image with a pattern that differs from one firmware image to the next.
+
+  @param[out]  Image      The firmware image to fill.
+  @param[in]   ImageSize  The size of Image in bytes.
+  @param[in]   Seed       Selects the pattern.
+**/
+STATIC
+VOID
+FillImage (
+  OUT UINT8  *Image,
+  IN  UINTN  ImageSize,
+  IN  UINT8  Seed
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < ImageSize; Index++) {
+    Image[Index] = (UINT8)((Index * 31) + Seed);
+  }
+}
+
+/**
+  Check that an image written with FmpDeviceSetImageWithStatus() is read back
+  by FmpDeviceGetImage(), and that the version and progress are reported.
+
+  @param[in]  Context  Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+SetImageThenGetImage (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EFI_STATUS  Status;
+  UINT8       *Image;
+  UINT8       *ReadBack;
+  UINTN       ImageSize;
+  UINTN       ReadBackSize;
+  UINT32      Version;
+  UINT32      ImageUpdatable;
+  UINT32      LastAttemptStatus;
+  CHAR16      *AbortReason;
+
+  //
+  // Not a multiple of the block size, so the last block is a partial one.
+  //
+  ImageSize = SIZE_1MB + 123;
+  Image     = AllocatePool (ImageSize);
+  ReadBack  = AllocatePool (ImageSize);
+  UT_ASSERT_NOT_NULL (Image);
+  UT_ASSERT_NOT_NULL (ReadBack);
+  FillImage (Image, ImageSize, 0x5A);
+
+  Status = FmpDeviceCheckImageWithStatus (Image, ImageSize, &ImageUpdatable, &LastAttemptStatus);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  UT_ASSERT_EQUAL (ImageUpdatable, IMAGE_UPDATABLE_VALID);
+  UT_ASSERT_EQUAL (LastAttemptStatus, LAST_ATTEMPT_STATUS_SUCCESS);
+
+  mProgressCalls     = 0;
+  mLastProgress      = 0;
+  mProgressMonotonic = TRUE;
+  AbortReason        = NULL;
+  Status             = FmpDeviceSetImageWithStatus (Image, ImageSize, NULL, RecordProgress, 0x10002, &AbortReason, &LastAttemptStatus);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  UT_ASSERT_EQUAL (LastAttemptStatus, LAST_ATTEMPT_STATUS_SUCCESS);
+  UT_ASSERT_TRUE (mProgressMonotonic);
+  UT_ASSERT_NOT_EQUAL (mProgressCalls, 0);
+  UT_ASSERT_EQUAL (mLastProgress, 100);
+
+  Status = FmpDeviceGetVersion (&Version);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  UT_ASSERT_EQUAL (Version, 0x10002);
+
+  ReadBackSize = 0;
+  Status       = FmpDeviceGetImage (ReadBack, &ReadBackSize);
+  UT_ASSERT_STATUS_EQUAL (Status, EFI_BUFFER_TOO_SMALL);
+  UT_ASSERT_EQUAL (ReadBackSize, ImageSize);
+
+  Status = FmpDeviceGetImage (ReadBack, &ReadBackSize);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  UT_ASSERT_EQUAL (ReadBackSize, ImageSize);
+  UT_ASSERT_MEM_EQUAL (ReadBack, Image, ImageSize);
+
+  FreePool (Image);
+  FreePool (ReadBack);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Check that images the RAM-backed firmware device cannot hold are rejected.
+
+  @param[in]  Context  Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+RejectInvalidImage (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EFI_STATUS  Status;
+  UINT8       Image[16];
+  UINT32      ImageUpdatable;
+  UINT32      LastAttemptStatus;
+  CHAR16      *AbortReason;
+
+  ZeroMem (Image, sizeof (Image));
+
+  Status = FmpDeviceCheckImageWithStatus (Image, 0, &ImageUpdatable, &LastAttemptStatus);
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  UT_ASSERT_EQUAL (ImageUpdatable, IMAGE_UPDATABLE_INVALID);
+  UT_ASSERT_EQUAL (LastAttemptStatus, LAST_ATTEMPT_STATUS_DEVICE_LIBRARY_MIN_ERROR_CODE_VALUE);
+
+  Status = FmpDeviceCheckImageWithStatus (NULL, sizeof (Image), &ImageUpdatable, &LastAttemptStatus);
+  UT_ASSERT_STATUS_EQUAL (Status, EFI_INVALID_PARAMETER);
+
+  AbortReason = NULL;
+  Status      = FmpDeviceSetImageWithStatus (Image, 0, NULL, NULL, 1, &AbortReason, &LastAttemptStatus);
+  UT_ASSERT_STATUS_EQUAL (Status, EFI_ABORTED);
+  UT_ASSERT_EQUAL (LastAttemptStatus, LAST_ATTEMPT_STATUS_DEVICE_LIBRARY_MIN_ERROR_CODE_VALUE);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Allocate and fill the firmware image of a benchmark.
+
+  @param[in]  Context  The FMP_DEVICE_BENCHMARK_CONTEXT of the benchmark.
+
+  @retval  UNIT_TEST_PASSED                   The image was allocated.
+  @retval  UNIT_TEST_ERROR_PREREQUISITE_NOT_MET  Out of memory.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+ImagePrerequisite (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  FMP_DEVICE_BENCHMARK_CONTEXT  *Benchmark;
+
+  Benchmark        = (FMP_DEVICE_BENCHMARK_CONTEXT *)Context;
+  Benchmark->Image = AllocatePool (Benchmark->ImageSize);
+  if (Benchmark->Image == NULL) {
+    return UNIT_TEST_ERROR_PREREQUISITE_NOT_MET;
+  }
+
+  FillImage (Benchmark->Image, Benchmark->ImageSize, 0xA5);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Free the firmware image of a benchmark.
+
+  @param[in]  Context  The FMP_DEVICE_BENCHMARK_CONTEXT of the benchmark.
+**/
+VOID
+EFIAPI
+ImageCleanUp (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  FMP_DEVICE_BENCHMARK_CONTEXT  *Benchmark;
+
+  Benchmark = (FMP_DEVICE_BENCHMARK_CONTEXT *)Context;
+  if (Benchmark->Image != NULL) {
+    FreePool (Benchmark->Image);
+    Benchmark->Image = NULL;
+  }
+}
+
+/**
+  Check and program a firmware image with the device library only, as FmpDxe
+  does once the capsule has been authenticated.
+
+  @param[in]  Context     The FMP_DEVICE_BENCHMARK_CONTEXT of the benchmark.
+  @param[in]  Iterations  The number of updates.
+**/
+VOID
+EFIAPI
+DeviceLibCheckAndSetImage (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  FMP_DEVICE_BENCHMARK_CONTEXT  *Benchmark;
+  UINTN                         Index;
+  UINT32                        ImageUpdatable;
+  UINT32                        LastAttemptStatus;
+  CHAR16                        *AbortReason;
+  EFI_STATUS                    Status;
+
+  Benchmark = (FMP_DEVICE_BENCHMARK_CONTEXT *)Context;
+  for (Index = 0; Index < Iterations; Index++) {
+    Status = FmpDeviceCheckImageWithStatus (Benchmark->Image, Benchmark->ImageSize, &ImageUpdatable, &LastAttemptStatus);
+    ASSERT_EFI_ERROR (Status);
+    AbortReason = NULL;
+    Status      = FmpDeviceSetImageWithStatus (Benchmark->Image, Benchmark->ImageSize, NULL, RecordProgress, 1, &AbortReason, &LastAttemptStatus);
+    ASSERT_EFI_ERROR (Status);
+    mLastProgress = 0;
+  }
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the
+  RAM-backed FmpDeviceLib and run the unit tests and benchmarks.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Fw;
+  UNIT_TEST_SUITE_HANDLE      DeviceTests;
+  UNIT_TEST_SUITE_HANDLE      DeviceBenchmarks;
+
+  Fw = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  //
+  // Start setting up the test framework for running the tests.
+  //
+  Status = InitUnitTestFramework (&Fw, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  //
+  // Populate the FmpDeviceLibRam Unit Test Suite.
+  //
+  Status = CreateUnitTestSuite (&DeviceTests, Fw, "FmpDeviceLibRam tests", "FmpDeviceLibRam.Tests", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for DeviceTests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  // -----------Suite--------Description-------------------------------Class Name-------------Function---------------Pre---Post---Context
+  AddTestCase (DeviceTests, "SetImage() then GetImage() round trip", "SetImageThenGetImage", SetImageThenGetImage, NULL, NULL, NULL);
+  AddTestCase (DeviceTests, "Invalid images are rejected", "RejectInvalidImage", RejectInvalidImage, NULL, NULL, NULL);
+
+  //
+  // Populate the FmpDeviceLibRam Benchmark Suite.
+  //
+  Status = CreateUnitTestSuite (&DeviceBenchmarks, Fw, "FmpDeviceLibRam benchmarks", "FmpDeviceLibRam.Benchmark", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for DeviceBenchmarks\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  // ---------------Suite-------------Description-----------------------------------------Class Name----------------------Function-------------------Pre-----------------Post----------Context
+  AddBenchmarkCase (DeviceBenchmarks, "Device library check and set of a 1MB image", "DeviceLibCheckAndSetImage1MB", DeviceLibCheckAndSetImage, ImagePrerequisite, ImageCleanUp, &mImage1MB);
+  AddBenchmarkCase (DeviceBenchmarks, "Device library check and set of a 16MB image", "DeviceLibCheckAndSetImage16MB", DeviceLibCheckAndSetImage, ImagePrerequisite, ImageCleanUp, &mImage16MB);
+  AddBenchmarkCase (DeviceBenchmarks, "Device library check and set of a 64MB image", "DeviceLibCheckAndSetImage64MB", DeviceLibCheckAndSetImage, ImagePrerequisite, ImageCleanUp, &mImage64MB);
+
+  //
+  // Execute the tests.
+  //
+  Status = RunAllTestSuites (Fw);
+
+EXIT:
+  if (Fw) {
+    FreeUnitTestFramework (Fw);
+  }
+
+  return Status;
+}
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+**/
+int
+main (
+  int   argc,
+  char  *argv[]
+  )
+{
+  return UnitTestingEntry ();
+}
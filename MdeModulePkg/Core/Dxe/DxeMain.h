@@ -49,6 +49,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Guid/FirmwareFileSystem2.h>
 #include <Guid/FirmwareFileSystem3.h>
 #include <Guid/HobList.h>
+#include <Guid/HobListIndex.h>
 #include <Guid/DebugImageInfoTable.h>
 #include <Guid/FileInfo.h>
 #include <Guid/Apriori.h>
@@ -2353,6 +2354,19 @@ CloseSectionStream (
   IN  BOOLEAN  FreeStreamBuffer
   );
 
+/**
+  Builds the index of the HOB list and installs it into the EFI System
+  Configuration Table, so that HOB library instances find HOBs without
+  walking the HOB list.
+
+  @param  HobStart              The start of the relocated HOB list.
+
+**/
+VOID
+CoreInstallHobListIndexTable (
+  IN VOID  *HobStart
+  );
+
 /**
   Creates and initializes the DebugImageInfo Table.  Also creates the configuration
   table and registers it into the system table.
@@ -348,6 +348,11 @@ DxeMain (
   Status = CoreInstallConfigurationTable (&gEfiHobListGuid, HobStart);
   ASSERT_EFI_ERROR (Status);
 
+  //
+  // Install the index of the HOB List into the EFI System Tables's Configuration Table
+  //
+  CoreInstallHobListIndexTable (HobStart);
+
   //
   // Install Memory Type Information Table into the EFI System Tables's Configuration Table
   //
@@ -16,6 +16,14 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 //
 GLOBAL_REMOVE_IF_UNREFERENCED BOOLEAN  mOnGuarding = FALSE;
 
+//
+// Number of guarded pools currently allocated, and the state used to sample
+// pool allocations when PcdHeapGuardPoolSampleRate is larger than 1.
+//
+GLOBAL_REMOVE_IF_UNREFERENCED UINTN   mGuardedPoolCount    = 0;
+GLOBAL_REMOVE_IF_UNREFERENCED UINT32  mPoolGuardSampleSkip = 0;
+GLOBAL_REMOVE_IF_UNREFERENCED UINT32  mPoolGuardSampleSeed = 0x9E3779B9;
+
 //
 // Pointer to table tracking the Guarded memory with bitmap, in which  '1'
 // is used to indicate memory guarded. '0' might be free memory or Guard
@@ -645,6 +653,55 @@ IsPoolTypeToGuard (
            );
 }
 
+/**
+  Check to see if a pool allocation of the given type should be guarded or not.
+
+  Unlike IsPoolTypeToGuard(), only one in PcdHeapGuardPoolSampleRate
+  allocations on average is guarded, and at most PcdHeapGuardPoolSampleSlots
+  guarded pools are allocated at a time. Caller must hold the pool memory lock.
+
+  @param[in]  MemoryType      Pool type to check.
+
+  @return TRUE  This pool allocation should be guarded.
+  @return FALSE This pool allocation should not be guarded.
+**/
+BOOLEAN
+IsPoolAllocationToGuard (
+  IN EFI_MEMORY_TYPE  MemoryType
+  )
+{
+  UINT32  Rate;
+  UINT32  Slots;
+
+  if (!IsPoolTypeToGuard (MemoryType)) {
+    return FALSE;
+  }
+
+  Rate = PcdGet32 (PcdHeapGuardPoolSampleRate);
+  if (Rate <= 1) {
+    return TRUE;
+  }
+
+  if (mPoolGuardSampleSkip > 0) {
+    mPoolGuardSampleSkip--;
+    return FALSE;
+  }
+
+  //
+  // Skip a random number of allocations in [0, 2 * (Rate - 1)] before the
+  // next sample. Samples are still Rate allocations apart on average, but do
+  // not run in lockstep with allocation patterns that repeat periodically.
+  //
+  Rate                  = MIN (Rate, BIT30);
+  mPoolGuardSampleSeed ^= mPoolGuardSampleSeed << 13;
+  mPoolGuardSampleSeed ^= mPoolGuardSampleSeed >> 17;
+  mPoolGuardSampleSeed ^= mPoolGuardSampleSeed << 5;
+  mPoolGuardSampleSkip  = mPoolGuardSampleSeed % (2 * Rate - 1);
+
+  Slots = PcdGet32 (PcdHeapGuardPoolSampleSlots);
+  return (BOOLEAN)((Slots == 0) || (mGuardedPoolCount < Slots));
+}
+
 /**
   Check to see if the page at the given address should be guarded or not.
 
@@ -304,6 +304,23 @@ IsPoolTypeToGuard (
   IN EFI_MEMORY_TYPE  MemoryType
   );
 
+/**
+  Check to see if a pool allocation of the given type should be guarded or not.
+
+  Unlike IsPoolTypeToGuard(), only one in PcdHeapGuardPoolSampleRate
+  allocations on average is guarded, and at most PcdHeapGuardPoolSampleSlots
+  guarded pools are allocated at a time. Caller must hold the pool memory lock.
+
+  @param[in]  MemoryType      Pool type to check.
+
+  @return TRUE  This pool allocation should be guarded.
+  @return FALSE This pool allocation should not be guarded.
+**/
+BOOLEAN
+IsPoolAllocationToGuard (
+  IN EFI_MEMORY_TYPE  MemoryType
+  );
+
 /**
   Check to see if the page at the given address should be guarded or not.
 
@@ -463,5 +480,6 @@ PromoteGuardedFreePages (
   );
 
 extern BOOLEAN  mOnGuarding;
+extern UINTN    mGuardedPoolCount;
 
 #endif
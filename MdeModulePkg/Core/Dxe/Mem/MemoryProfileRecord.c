@@ -29,12 +29,30 @@ typedef struct {
 } MEMORY_PROFILE_DRIVER_INFO_DATA;
 
 typedef struct {
-  UINT32                       Signature;
-  MEMORY_PROFILE_ALLOC_INFO    AllocInfo;
-  CHAR8                        *ActionString;
-  LIST_ENTRY                   Link;
+  UINT32                             Signature;
+  MEMORY_PROFILE_ALLOC_INFO          AllocInfo;
+  CHAR8                              *ActionString;
+  LIST_ENTRY                         Link;
+  LIST_ENTRY                         HashLink;
+  MEMORY_PROFILE_DRIVER_INFO_DATA    *DriverInfoData;
 } MEMORY_PROFILE_ALLOC_INFO_DATA;
 
+typedef struct {
+  PHYSICAL_ADDRESS                   ImageBase;
+  PHYSICAL_ADDRESS                   ImageLimit;
+  MEMORY_PROFILE_DRIVER_INFO_DATA    *DriverInfoData;
+} MEMORY_PROFILE_IMAGE_RANGE;
+
+//
+// Number of image ranges in the index used to attribute allocations to the
+// calling driver, and number of buckets of the allocation record hash.
+//
+#define MEMORY_PROFILE_IMAGE_INDEX_SIZE  512
+#define MEMORY_PROFILE_ALLOC_HASH_SIZE   1024
+
+#define MEMORY_PROFILE_ALLOC_HASH(Buffer) \
+  ((((UINTN)(Buffer) >> 4) ^ ((UINTN)(Buffer) >> 14)) & (MEMORY_PROFILE_ALLOC_HASH_SIZE - 1))
+
 GLOBAL_REMOVE_IF_UNREFERENCED LIST_ENTRY                   mImageQueue           = INITIALIZE_LIST_HEAD_VARIABLE (mImageQueue);
 GLOBAL_REMOVE_IF_UNREFERENCED MEMORY_PROFILE_CONTEXT_DATA  mMemoryProfileContext = {
   MEMORY_PROFILE_CONTEXT_SIGNATURE,
@@ -62,6 +80,16 @@ GLOBAL_REMOVE_IF_UNREFERENCED BOOLEAN                   mMemoryProfileRecordingE
 GLOBAL_REMOVE_IF_UNREFERENCED EFI_DEVICE_PATH_PROTOCOL  *mMemoryProfileDriverPath;
 GLOBAL_REMOVE_IF_UNREFERENCED UINTN                     mMemoryProfileDriverPathSize;
 
+//
+// Image ranges of the recorded drivers sorted by base address, and allocation
+// records hashed by buffer address. Lookups fall back to walking the lists
+// if these could not be allocated, or once the index overflows.
+//
+GLOBAL_REMOVE_IF_UNREFERENCED MEMORY_PROFILE_IMAGE_RANGE  *mMemoryProfileImageIndex;
+GLOBAL_REMOVE_IF_UNREFERENCED UINTN                       mMemoryProfileImageIndexCount;
+GLOBAL_REMOVE_IF_UNREFERENCED BOOLEAN                     mMemoryProfileImageIndexValid;
+GLOBAL_REMOVE_IF_UNREFERENCED LIST_ENTRY                  *mMemoryProfileAllocHash;
+
 /**
   Get memory profile data.
 
@@ -351,6 +379,78 @@ InternalPeCoffGetEntryPoint (
   return RETURN_UNSUPPORTED;
 }
 
+/**
+  Add the image range of a driver to the image range index.
+
+  @param DriverInfoData Driver info.
+
+**/
+VOID
+InsertMemoryProfileImageRange (
+  IN MEMORY_PROFILE_DRIVER_INFO_DATA  *DriverInfoData
+  )
+{
+  MEMORY_PROFILE_DRIVER_INFO  *DriverInfo;
+  UINTN                       Index;
+
+  DriverInfo = &DriverInfoData->DriverInfo;
+  if (!mMemoryProfileImageIndexValid || (DriverInfo->ImageSize == 0)) {
+    return;
+  }
+
+  if (mMemoryProfileImageIndexCount == MEMORY_PROFILE_IMAGE_INDEX_SIZE) {
+    DEBUG ((DEBUG_WARN, "MemoryProfile: image range index is full, searching driver list\n"));
+    mMemoryProfileImageIndexValid = FALSE;
+    return;
+  }
+
+  for (Index = mMemoryProfileImageIndexCount; Index > 0; Index--) {
+    if (mMemoryProfileImageIndex[Index - 1].ImageBase <= DriverInfo->ImageBase) {
+      break;
+    }
+  }
+
+  CopyMem (
+    &mMemoryProfileImageIndex[Index + 1],
+    &mMemoryProfileImageIndex[Index],
+    (mMemoryProfileImageIndexCount - Index) * sizeof (MEMORY_PROFILE_IMAGE_RANGE)
+    );
+  mMemoryProfileImageIndex[Index].ImageBase      = DriverInfo->ImageBase;
+  mMemoryProfileImageIndex[Index].ImageLimit     = DriverInfo->ImageBase + DriverInfo->ImageSize;
+  mMemoryProfileImageIndex[Index].DriverInfoData = DriverInfoData;
+  mMemoryProfileImageIndexCount++;
+}
+
+/**
+  Remove the image range of a driver from the image range index.
+
+  @param DriverInfoData Driver info.
+
+**/
+VOID
+RemoveMemoryProfileImageRange (
+  IN MEMORY_PROFILE_DRIVER_INFO_DATA  *DriverInfoData
+  )
+{
+  UINTN  Index;
+
+  if (!mMemoryProfileImageIndexValid) {
+    return;
+  }
+
+  for (Index = 0; Index < mMemoryProfileImageIndexCount; Index++) {
+    if (mMemoryProfileImageIndex[Index].DriverInfoData == DriverInfoData) {
+      mMemoryProfileImageIndexCount--;
+      CopyMem (
+        &mMemoryProfileImageIndex[Index],
+        &mMemoryProfileImageIndex[Index + 1],
+        (mMemoryProfileImageIndexCount - Index) * sizeof (MEMORY_PROFILE_IMAGE_RANGE)
+        );
+      return;
+    }
+  }
+}
+
 /**
   Build driver info.
 
@@ -450,6 +550,7 @@ BuildDriverInfo (
   }
 
   InsertTailList (ContextData->DriverInfoList, &DriverInfoData->Link);
+  InsertMemoryProfileImageRange (DriverInfoData);
   ContextData->Context.ImageCount++;
   ContextData->Context.TotalImageSize += DriverInfo->ImageSize;
 
@@ -594,6 +695,8 @@ MemoryProfileInit (
   )
 {
   MEMORY_PROFILE_CONTEXT_DATA  *ContextData;
+  EFI_STATUS                   Status;
+  UINTN                        Index;
 
   if (!IS_UEFI_MEMORY_PROFILE_ENABLED) {
     return;
@@ -604,6 +707,24 @@ MemoryProfileInit (
     return;
   }
 
+  //
+  // Use CoreInternalAllocatePool() that will not update profile for this AllocatePool action.
+  //
+  Status = CoreInternalAllocatePool (
+             EfiBootServicesData,
+             MEMORY_PROFILE_IMAGE_INDEX_SIZE * sizeof (MEMORY_PROFILE_IMAGE_RANGE) +
+             MEMORY_PROFILE_ALLOC_HASH_SIZE * sizeof (LIST_ENTRY),
+             (VOID **)&mMemoryProfileImageIndex
+             );
+  if (!EFI_ERROR (Status)) {
+    mMemoryProfileImageIndexCount = 0;
+    mMemoryProfileImageIndexValid = TRUE;
+    mMemoryProfileAllocHash       = (LIST_ENTRY *)(mMemoryProfileImageIndex + MEMORY_PROFILE_IMAGE_INDEX_SIZE);
+    for (Index = 0; Index < MEMORY_PROFILE_ALLOC_HASH_SIZE; Index++) {
+      InitializeListHead (&mMemoryProfileAllocHash[Index]);
+    }
+  }
+
   mMemoryProfileGettingStatus = FALSE;
   if ((PcdGet8 (PcdMemoryProfilePropertyMask) & BIT7) != 0) {
     mMemoryProfileRecordingEnable = MEMORY_PROFILE_RECORDING_DISABLE;
@@ -794,6 +915,31 @@ GetMemoryProfileDriverInfoFromAddress (
   MEMORY_PROFILE_DRIVER_INFO_DATA  *DriverInfoData;
   LIST_ENTRY                       *DriverLink;
   LIST_ENTRY                       *DriverInfoList;
+  UINTN                            Low;
+  UINTN                            High;
+  UINTN                            Middle;
+
+  if (mMemoryProfileImageIndexValid) {
+    //
+    // Find the last image range starting at or below Address.
+    //
+    Low  = 0;
+    High = mMemoryProfileImageIndexCount;
+    while (Low < High) {
+      Middle = (Low + High) / 2;
+      if (mMemoryProfileImageIndex[Middle].ImageBase <= Address) {
+        Low = Middle + 1;
+      } else {
+        High = Middle;
+      }
+    }
+
+    if ((Low > 0) && (Address < mMemoryProfileImageIndex[Low - 1].ImageLimit)) {
+      return mMemoryProfileImageIndex[Low - 1].DriverInfoData;
+    }
+
+    return NULL;
+  }
 
   DriverInfoList = ContextData->DriverInfoList;
 
@@ -880,6 +1026,7 @@ UnregisterMemoryProfileImage (
   }
 
   ContextData->Context.TotalImageSize -= DriverInfoData->DriverInfo.ImageSize;
+  RemoveMemoryProfileImageRange (DriverInfoData);
 
   // Keep the ImageBase for RVA calculation in Application.
   // DriverInfoData->DriverInfo.ImageBase = 0;
@@ -1055,7 +1202,11 @@ CoreUpdateProfileAllocate (
     AllocInfoData->ActionString   = NULL;
   }
 
+  AllocInfoData->DriverInfoData = DriverInfoData;
   InsertTailList (DriverInfoData->AllocInfoList, &AllocInfoData->Link);
+  if (mMemoryProfileAllocHash != NULL) {
+    InsertTailList (&mMemoryProfileAllocHash[MEMORY_PROFILE_ALLOC_HASH (Buffer)], &AllocInfoData->HashLink);
+  }
 
   Context    = &ContextData->Context;
   DriverInfo = &DriverInfoData->DriverInfo;
@@ -1091,6 +1242,50 @@ CoreUpdateProfileAllocate (
   return EFI_SUCCESS;
 }
 
+/**
+  Get memory profile alloc info of a pool from the allocation record hash.
+
+  @param DriverInfoData     Driver info, or NULL to match the records of any driver.
+  @param Buffer             Pool buffer address.
+
+  @return Pointer to memory profile alloc info.
+
+**/
+MEMORY_PROFILE_ALLOC_INFO_DATA *
+GetMemoryProfilePoolAllocInfo (
+  IN MEMORY_PROFILE_DRIVER_INFO_DATA  *DriverInfoData OPTIONAL,
+  IN VOID                             *Buffer
+  )
+{
+  LIST_ENTRY                      *Bucket;
+  LIST_ENTRY                      *HashLink;
+  MEMORY_PROFILE_ALLOC_INFO       *AllocInfo;
+  MEMORY_PROFILE_ALLOC_INFO_DATA  *AllocInfoData;
+
+  Bucket = &mMemoryProfileAllocHash[MEMORY_PROFILE_ALLOC_HASH (Buffer)];
+
+  for (HashLink = Bucket->ForwardLink;
+       HashLink != Bucket;
+       HashLink = HashLink->ForwardLink)
+  {
+    AllocInfoData = CR (
+                      HashLink,
+                      MEMORY_PROFILE_ALLOC_INFO_DATA,
+                      HashLink,
+                      MEMORY_PROFILE_ALLOC_INFO_SIGNATURE
+                      );
+    AllocInfo = &AllocInfoData->AllocInfo;
+    if (((DriverInfoData == NULL) || (AllocInfoData->DriverInfoData == DriverInfoData)) &&
+        ((AllocInfo->Action & MEMORY_PROFILE_ACTION_BASIC_MASK) == MemoryProfileActionAllocatePool) &&
+        (AllocInfo->Buffer == (PHYSICAL_ADDRESS)(UINTN)Buffer))
+    {
+      return AllocInfoData;
+    }
+  }
+
+  return NULL;
+}
+
 /**
   Get memory profile alloc info from memory profile.
 
@@ -1115,6 +1310,10 @@ GetMemoryProfileAllocInfoFromAddress (
   MEMORY_PROFILE_ALLOC_INFO       *AllocInfo;
   MEMORY_PROFILE_ALLOC_INFO_DATA  *AllocInfoData;
 
+  if ((BasicAction == MemoryProfileActionAllocatePool) && (mMemoryProfileAllocHash != NULL)) {
+    return GetMemoryProfilePoolAllocInfo (DriverInfoData, Buffer);
+  }
+
   AllocInfoList = DriverInfoData->AllocInfoList;
 
   for (AllocLink = AllocInfoList->ForwardLink;
@@ -1230,34 +1429,44 @@ CoreUpdateProfileFree (
       //
       // Legal case, because driver A might free memory allocated by driver B, by some protocol.
       //
-      DriverInfoList = ContextData->DriverInfoList;
-
-      for (DriverLink = DriverInfoList->ForwardLink;
-           DriverLink != DriverInfoList;
-           DriverLink = DriverLink->ForwardLink)
-      {
-        ThisDriverInfoData = CR (
-                               DriverLink,
-                               MEMORY_PROFILE_DRIVER_INFO_DATA,
-                               Link,
-                               MEMORY_PROFILE_DRIVER_INFO_SIGNATURE
-                               );
-        switch (BasicAction) {
-          case MemoryProfileActionFreePages:
-            AllocInfoData = GetMemoryProfileAllocInfoFromAddress (ThisDriverInfoData, MemoryProfileActionAllocatePages, Size, Buffer);
-            break;
-          case MemoryProfileActionFreePool:
-            AllocInfoData = GetMemoryProfileAllocInfoFromAddress (ThisDriverInfoData, MemoryProfileActionAllocatePool, 0, Buffer);
-            break;
-          default:
-            ASSERT (FALSE);
-            AllocInfoData = NULL;
-            break;
+      if ((BasicAction == MemoryProfileActionFreePool) && (mMemoryProfileAllocHash != NULL)) {
+        //
+        // Pool records are hashed by buffer address, whichever driver owns them.
+        //
+        AllocInfoData = GetMemoryProfilePoolAllocInfo (NULL, Buffer);
+        if (AllocInfoData != NULL) {
+          DriverInfoData = AllocInfoData->DriverInfoData;
         }
+      } else {
+        DriverInfoList = ContextData->DriverInfoList;
 
-        if (AllocInfoData != NULL) {
-          DriverInfoData = ThisDriverInfoData;
-          break;
+        for (DriverLink = DriverInfoList->ForwardLink;
+             DriverLink != DriverInfoList;
+             DriverLink = DriverLink->ForwardLink)
+        {
+          ThisDriverInfoData = CR (
+                                 DriverLink,
+                                 MEMORY_PROFILE_DRIVER_INFO_DATA,
+                                 Link,
+                                 MEMORY_PROFILE_DRIVER_INFO_SIGNATURE
+                                 );
+          switch (BasicAction) {
+            case MemoryProfileActionFreePages:
+              AllocInfoData = GetMemoryProfileAllocInfoFromAddress (ThisDriverInfoData, MemoryProfileActionAllocatePages, Size, Buffer);
+              break;
+            case MemoryProfileActionFreePool:
+              AllocInfoData = GetMemoryProfileAllocInfoFromAddress (ThisDriverInfoData, MemoryProfileActionAllocatePool, 0, Buffer);
+              break;
+            default:
+              ASSERT (FALSE);
+              AllocInfoData = NULL;
+              break;
+          }
+
+          if (AllocInfoData != NULL) {
+            DriverInfoData = ThisDriverInfoData;
+            break;
+          }
         }
       }
 
@@ -1298,6 +1507,9 @@ CoreUpdateProfileFree (
     }
 
     RemoveEntryList (&AllocInfoData->Link);
+    if (mMemoryProfileAllocHash != NULL) {
+      RemoveEntryList (&AllocInfoData->HashLink);
+    }
 
     if (BasicAction == MemoryProfileActionFreePages) {
       if (AllocInfo->Buffer != (PHYSICAL_ADDRESS)(UINTN)Buffer) {
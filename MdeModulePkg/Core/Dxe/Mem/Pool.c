@@ -232,8 +232,6 @@ CoreInternalAllocatePool (
     return EFI_OUT_OF_RESOURCES;
   }
 
-  NeedGuard = IsPoolTypeToGuard (PoolType) && !mOnGuarding;
-
   //
   // Acquire the memory lock and make the allocation
   //
@@ -242,7 +240,12 @@ CoreInternalAllocatePool (
     return EFI_OUT_OF_RESOURCES;
   }
 
-  *Buffer = CoreAllocatePoolI (PoolType, Size, NeedGuard);
+  NeedGuard = !mOnGuarding && IsPoolAllocationToGuard (PoolType);
+  *Buffer   = CoreAllocatePoolI (PoolType, Size, NeedGuard);
+  if (NeedGuard && (*Buffer != NULL)) {
+    mGuardedPoolCount++;
+  }
+
   CoreReleaseLock (&mPoolMemoryLock);
   return (*Buffer != NULL) ? EFI_SUCCESS : EFI_OUT_OF_RESOURCES;
 }
@@ -789,6 +792,9 @@ CoreFreePoolI (
         (EFI_PHYSICAL_ADDRESS)(UINTN)Head,
         NoPages
         );
+      if (mGuardedPoolCount > 0) {
+        mGuardedPoolCount--;
+      }
     } else {
       CoreFreePoolPagesI (
         Pool->MemoryType,
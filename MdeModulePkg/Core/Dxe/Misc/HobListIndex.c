@@ -0,0 +1,92 @@
+/** @file
+  Builds the index of the HOB list and installs it into the EFI System
+  Configuration Table.
+
+Copyright (c) 2026, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "DxeMain.h"
+
+/**
+  Builds the index of the HOB list and installs it into the EFI System
+  Configuration Table, so that HOB library instances find HOBs without
+  walking the HOB list.
+
+  The HOB list must not move after this function has been called. If the
+  index cannot be allocated, no table is installed and HOB lookups walk the
+  HOB list.
+
+  @param  HobStart              The start of the relocated HOB list.
+
+**/
+VOID
+CoreInstallHobListIndexTable (
+  IN VOID  *HobStart
+  )
+{
+  EFI_PEI_HOB_POINTERS  Hob;
+  EDKII_HOB_LIST_INDEX  *Index;
+  EFI_HOB_GUID_TYPE     **GuidHobs;
+  VOID                  *FirstHobOfType[EFI_HOB_TYPE_FV3 + 1];
+  UINTN                 GuidHobCount;
+  UINTN                 SlotCount;
+  UINTN                 Slot;
+  EFI_STATUS            Status;
+
+  ZeroMem (FirstHobOfType, sizeof (FirstHobOfType));
+  GuidHobCount = 0;
+  for (Hob.Raw = HobStart; !END_OF_HOB_LIST (Hob); Hob.Raw = GET_NEXT_HOB (Hob)) {
+    if ((Hob.Header->HobType < ARRAY_SIZE (FirstHobOfType)) &&
+        (FirstHobOfType[Hob.Header->HobType] == NULL))
+    {
+      FirstHobOfType[Hob.Header->HobType] = Hob.Raw;
+    }
+
+    if (Hob.Header->HobType == EFI_HOB_TYPE_GUID_EXTENSION) {
+      GuidHobCount++;
+    }
+  }
+
+  //
+  // Keep the GUID HOB table at most half full.
+  //
+  SlotCount = 16;
+  while (SlotCount < GuidHobCount * 2) {
+    SlotCount <<= 1;
+  }
+
+  Index = AllocateZeroPool (sizeof (*Index) + SlotCount * sizeof (*GuidHobs));
+  if (Index == NULL) {
+    return;
+  }
+
+  Index->Revision         = EDKII_HOB_LIST_INDEX_REVISION;
+  Index->GuidHobSlotCount = (UINT32)SlotCount;
+  Index->HobList          = HobStart;
+  CopyMem (Index->FirstHobOfType, FirstHobOfType, sizeof (FirstHobOfType));
+
+  GuidHobs = EDKII_HOB_LIST_INDEX_GUID_HOBS (Index);
+  Hob.Raw  = FirstHobOfType[EFI_HOB_TYPE_GUID_EXTENSION];
+  while (Hob.Raw != NULL) {
+    Slot = EDKII_HOB_LIST_INDEX_HASH_GUID (&Hob.Guid->Name) & (SlotCount - 1);
+    while ((GuidHobs[Slot] != NULL) &&
+           !CompareGuid (&GuidHobs[Slot]->Name, &Hob.Guid->Name))
+    {
+      Slot = (Slot + 1) & (SlotCount - 1);
+    }
+
+    if (GuidHobs[Slot] == NULL) {
+      GuidHobs[Slot] = Hob.Guid;
+    }
+
+    Hob.Raw = GetNextHob (EFI_HOB_TYPE_GUID_EXTENSION, GET_NEXT_HOB (Hob));
+  }
+
+  Status = CoreInstallConfigurationTable (&gEdkiiHobListIndexGuid, Index);
+  ASSERT_EFI_ERROR (Status);
+  if (EFI_ERROR (Status)) {
+    FreePool (Index);
+  }
+}
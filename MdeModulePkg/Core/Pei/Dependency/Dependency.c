@@ -250,3 +250,57 @@ PeimDispatchReadiness (
     }
   }
 }
+
+/**
+  Returns the set of PPI index hash buckets that the GUIDs pushed by a
+  dependency expression fall into.
+
+  The result of a dependency expression can only change when a PPI that it
+  pushes is installed or reinstalled, so the dispatcher uses this mask to
+  decide whether a DEPEX that evaluated to FALSE has to be evaluated again.
+
+  @param DependencyExpression   Pointer to a dependency expression.
+
+  @return A mask with bit N set for each hash bucket N, or MAX_UINT64 if the
+          expression contains an opcode that is not understood.
+
+**/
+UINT64
+PeimDependencyPpiBuckets (
+  IN VOID  *DependencyExpression
+  )
+{
+  DEPENDENCY_EXPRESSION_OPERAND  *Iterator;
+  EFI_GUID                       PpiGuid;
+  UINT64                         Buckets;
+
+  Iterator = DependencyExpression;
+  Buckets  = 0;
+
+  while (TRUE) {
+    switch (*(Iterator++)) {
+      case (EFI_DEP_PUSH):
+        //
+        // Copy the GUID into a local variable so that there are no
+        // possibilities of alignment faults.
+        //
+        CopyMem (&PpiGuid, Iterator, sizeof (EFI_GUID));
+        Buckets |= LShiftU64 (1, PpiGuidHash (&PpiGuid));
+        Iterator = Iterator + sizeof (EFI_GUID);
+        break;
+
+      case (EFI_DEP_AND):
+      case (EFI_DEP_OR):
+      case (EFI_DEP_NOT):
+      case (EFI_DEP_TRUE):
+      case (EFI_DEP_FALSE):
+        break;
+
+      case (EFI_DEP_END):
+        return Buckets;
+
+      default:
+        return MAX_UINT64;
+    }
+  }
+}
@@ -115,11 +115,13 @@ DiscoverPeimsAndOrderWithApriori (
   }
 
   //
-  // Record PeimCount, allocate buffer for PeimState and FvFileHandles.
+  // Record PeimCount, allocate buffer for PeimState, DepexWait and FvFileHandles.
   //
   CoreFileHandle->PeimCount = PeimCount;
   CoreFileHandle->PeimState = AllocateZeroPool (sizeof (UINT8) * PeimCount);
   ASSERT (CoreFileHandle->PeimState != NULL);
+  CoreFileHandle->DepexWait = AllocateZeroPool (sizeof (PEI_DEPEX_WAIT) * PeimCount);
+  ASSERT (CoreFileHandle->DepexWait != NULL);
   CoreFileHandle->FvFileHandles = AllocateZeroPool (sizeof (EFI_PEI_FILE_HANDLE) * PeimCount);
   ASSERT (CoreFileHandle->FvFileHandles != NULL);
 
@@ -1684,6 +1686,10 @@ InitializeDispatcherData (
   decides if the module can be executed.
 
 
+  A DEPEX that evaluated to FALSE is not evaluated again until a PPI whose
+  GUID falls into one of the hash buckets it refers to has been installed or
+  reinstalled.
+
   @param Private         PeiCore's private data structure
   @param FileHandle      PEIM's file handle
   @param PeimCount       Peim count in all dispatched PEIMs.
@@ -1702,6 +1708,11 @@ DepexSatisfied (
   EFI_STATUS        Status;
   VOID              *DepexData;
   EFI_FV_FILE_INFO  FileInfo;
+  PEI_PPI_LIST      *PpiList;
+  PEI_DEPEX_WAIT    *Wait;
+  UINT64            Buckets;
+  UINTN             Bucket;
+  BOOLEAN           Result;
 
   Status = PeiServicesFfsGetFileInfo (FileHandle, &FileInfo);
   if (EFI_ERROR (Status)) {
@@ -1718,6 +1729,25 @@ DepexSatisfied (
     return TRUE;
   }
 
+  PpiList = &Private->PpiData.PpiList;
+  Wait    = &Private->Fv[Private->CurrentPeimFvCount].DepexWait[PeimCount];
+  if (Wait->Blocked) {
+    for (Buckets = Wait->PpiBuckets, Bucket = 0; Buckets != 0; Buckets = RShiftU64 (Buckets, 1), Bucket++) {
+      if (((Buckets & 1) != 0) && (PpiList->BucketGeneration[Bucket] > Wait->Generation)) {
+        break;
+      }
+    }
+
+    if (Buckets == 0) {
+      //
+      // None of the PPIs that the DEPEX refers to has changed since it
+      // evaluated to FALSE.
+      //
+      DEBUG ((DEBUG_DISPATCH, "  RESULT = FALSE (Unchanged)\n"));
+      return FALSE;
+    }
+  }
+
   //
   // Depex section not in the encapsulated section.
   //
@@ -1738,7 +1768,15 @@ DepexSatisfied (
   //
   // Evaluate a given DEPEX
   //
-  return PeimDispatchReadiness (&Private->Ps, DepexData);
+  Result = PeimDispatchReadiness (&Private->Ps, DepexData);
+
+  Wait->Blocked    = (BOOLEAN) !Result;
+  Wait->Generation = PpiList->Generation;
+  if (!Result) {
+    Wait->PpiBuckets = PeimDependencyPpiBuckets (DepexData);
+  }
+
+  return Result;
 }
 
 /**
@@ -68,6 +68,11 @@ typedef union {
 #define CALLBACK_NOTIFY_GROWTH_STEP  32
 #define DISPATCH_NOTIFY_GROWTH_STEP  8
 
+///
+/// Number of hash buckets indexing the PPI list by GUID. Must be a power of two.
+///
+#define PPI_HASH_BUCKETS  64
+
 typedef struct {
   UINTN                    CurrentCount;
   UINTN                    MaxCount;
@@ -76,6 +81,31 @@ typedef struct {
   /// MaxCount number of entries.
   ///
   PEI_PPI_LIST_POINTERS    *PpiPtrs;
+  ///
+  /// MaxCount number of entries. Chains the entries of PpiPtrs whose GUIDs
+  /// fall into the same hash bucket, in ascending order. Each element holds
+  /// the index of the next entry plus one, or zero at the end of the chain.
+  ///
+  /// The index stores no pointers, so it survives the migration of the PPI
+  /// descriptors from temporary memory.
+  ///
+  UINT32                   *PpiNext;
+  ///
+  /// Head of the chain for each hash bucket, in the same format as PpiNext.
+  ///
+  UINT32                   Bucket[PPI_HASH_BUCKETS];
+  ///
+  /// Incremented each time an entry is added to or removed from the index.
+  /// BucketGeneration records the value of Generation at the last change of
+  /// each hash bucket.
+  ///
+  UINT32                   Generation;
+  UINT32                   BucketGeneration[PPI_HASH_BUCKETS];
+  ///
+  /// Number of PeiLocatePpi() calls, and of GUID comparisons they made.
+  ///
+  UINT32                   LocateCount;
+  UINT32                   LocateCompareCount;
 } PEI_PPI_LIST;
 
 typedef struct {
@@ -131,6 +161,27 @@ typedef struct {
 //
 #define FV_GROWTH_STEP  8
 
+///
+/// Remembers why the DEPEX of a PEIM last evaluated to FALSE, so that the
+/// dispatcher does not evaluate it again before a PPI it refers to has been
+/// installed or reinstalled.
+///
+typedef struct {
+  ///
+  /// Bit N is set if the DEPEX refers to a PPI GUID of hash bucket N.
+  /// PPI_HASH_BUCKETS must therefore not exceed 64.
+  ///
+  UINT64     PpiBuckets;
+  ///
+  /// PEI_PPI_LIST.Generation when the DEPEX was evaluated.
+  ///
+  UINT32     Generation;
+  ///
+  /// TRUE if the DEPEX evaluated to FALSE.
+  ///
+  BOOLEAN    Blocked;
+} PEI_DEPEX_WAIT;
+
 typedef struct {
   EFI_FIRMWARE_VOLUME_HEADER     *FvHeader;
   EFI_PEI_FIRMWARE_VOLUME_PPI    *FvPpi;
@@ -143,6 +194,10 @@ typedef struct {
   //
   // Pointer to the buffer with the PeimCount number of Entries.
   //
+  PEI_DEPEX_WAIT                 *DepexWait;
+  //
+  // Pointer to the buffer with the PeimCount number of Entries.
+  //
   EFI_PEI_FILE_HANDLE            *FvFileHandles;
   BOOLEAN                        ScanFv;
   UINT32                         AuthenticationStatus;
@@ -395,6 +450,21 @@ PeimDispatchReadiness (
   IN VOID              *DependencyExpression
   );
 
+/**
+  Returns the set of PPI index hash buckets that the GUIDs pushed by a
+  dependency expression fall into.
+
+  @param DependencyExpression   Pointer to a dependency expression.
+
+  @return A mask with bit N set for each hash bucket N, or MAX_UINT64 if the
+          expression contains an opcode that is not understood.
+
+**/
+UINT64
+PeimDependencyPpiBuckets (
+  IN VOID  *DependencyExpression
+  );
+
 /**
   Migrate a PEIM from temporary RAM to permanent memory.
 
@@ -484,6 +554,20 @@ DepexSatisfied (
 // PPI support functions
 //
 
+/**
+
+  Returns the hash bucket of a PPI GUID in the PPI list index.
+
+  @param Guid            Pointer to the GUID.
+
+  @return The index of the bucket in PEI_PPI_LIST.Bucket.
+
+**/
+UINTN
+PpiGuidHash (
+  IN CONST EFI_GUID  *Guid
+  );
+
 /**
 
   Initialize PPI services.
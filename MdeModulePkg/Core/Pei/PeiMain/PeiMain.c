@@ -219,6 +219,10 @@ PeiCore (
           OldCoreData->PpiData.PpiList.PpiPtrs = (PEI_PPI_LIST_POINTERS *)((UINT8 *)OldCoreData->PpiData.PpiList.PpiPtrs + OldCoreData->HeapOffset);
         }
 
+        if (OldCoreData->PpiData.PpiList.PpiNext != NULL) {
+          OldCoreData->PpiData.PpiList.PpiNext = (UINT32 *)((UINT8 *)OldCoreData->PpiData.PpiList.PpiNext + OldCoreData->HeapOffset);
+        }
+
         if (OldCoreData->PpiData.CallbackNotifyList.NotifyPtrs != NULL) {
           OldCoreData->PpiData.CallbackNotifyList.NotifyPtrs = (PEI_PPI_LIST_POINTERS *)((UINT8 *)OldCoreData->PpiData.CallbackNotifyList.NotifyPtrs + OldCoreData->HeapOffset);
         }
@@ -233,6 +237,10 @@ PeiCore (
             OldCoreData->Fv[Index].PeimState = (UINT8 *)OldCoreData->Fv[Index].PeimState + OldCoreData->HeapOffset;
           }
 
+          if (OldCoreData->Fv[Index].DepexWait != NULL) {
+            OldCoreData->Fv[Index].DepexWait = (PEI_DEPEX_WAIT *)((UINT8 *)OldCoreData->Fv[Index].DepexWait + OldCoreData->HeapOffset);
+          }
+
           if (OldCoreData->Fv[Index].FvFileHandles != NULL) {
             OldCoreData->Fv[Index].FvFileHandles = (EFI_PEI_FILE_HANDLE *)((UINT8 *)OldCoreData->Fv[Index].FvFileHandles + OldCoreData->HeapOffset);
           }
@@ -254,6 +262,10 @@ PeiCore (
           OldCoreData->PpiData.PpiList.PpiPtrs = (PEI_PPI_LIST_POINTERS *)((UINT8 *)OldCoreData->PpiData.PpiList.PpiPtrs - OldCoreData->HeapOffset);
         }
 
+        if (OldCoreData->PpiData.PpiList.PpiNext != NULL) {
+          OldCoreData->PpiData.PpiList.PpiNext = (UINT32 *)((UINT8 *)OldCoreData->PpiData.PpiList.PpiNext - OldCoreData->HeapOffset);
+        }
+
         if (OldCoreData->PpiData.CallbackNotifyList.NotifyPtrs != NULL) {
           OldCoreData->PpiData.CallbackNotifyList.NotifyPtrs = (PEI_PPI_LIST_POINTERS *)((UINT8 *)OldCoreData->PpiData.CallbackNotifyList.NotifyPtrs - OldCoreData->HeapOffset);
         }
@@ -268,6 +280,10 @@ PeiCore (
             OldCoreData->Fv[Index].PeimState = (UINT8 *)OldCoreData->Fv[Index].PeimState - OldCoreData->HeapOffset;
           }
 
+          if (OldCoreData->Fv[Index].DepexWait != NULL) {
+            OldCoreData->Fv[Index].DepexWait = (PEI_DEPEX_WAIT *)((UINT8 *)OldCoreData->Fv[Index].DepexWait - OldCoreData->HeapOffset);
+          }
+
           if (OldCoreData->Fv[Index].FvFileHandles != NULL) {
             OldCoreData->Fv[Index].FvFileHandles = (EFI_PEI_FILE_HANDLE *)((UINT8 *)OldCoreData->Fv[Index].FvFileHandles - OldCoreData->HeapOffset);
           }
@@ -500,6 +516,14 @@ PeiCore (
   //
   PERF_INMODULE_END ("PostMem");
 
+  DEBUG ((
+    DEBUG_INFO,
+    "PPI database: %u PPIs, %u LocatePpi calls, %u GUID comparisons\n",
+    (UINT32)PrivateData.PpiData.PpiList.CurrentCount,
+    PrivateData.PpiData.PpiList.LocateCount,
+    PrivateData.PpiData.PpiList.LocateCompareCount
+    ));
+
   //
   // Lookup DXE IPL PPI
   //
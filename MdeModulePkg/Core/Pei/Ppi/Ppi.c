@@ -354,6 +354,86 @@ ConvertPpiPointersFv (
   }
 }
 
+/**
+
+  Returns the hash bucket of a PPI GUID in the PPI list index.
+
+  @param Guid            Pointer to the GUID.
+
+  @return The index of the bucket in PEI_PPI_LIST.Bucket.
+
+**/
+UINTN
+PpiGuidHash (
+  IN CONST EFI_GUID  *Guid
+  )
+{
+  return (((UINT32 *)Guid)[0] ^ ((UINT32 *)Guid)[3]) & (PPI_HASH_BUCKETS - 1);
+}
+
+/**
+
+  Adds an entry of the PPI list to the GUID index, keeping the chain of its
+  bucket in ascending order.
+
+  @param PpiList         Pointer to the PPI list.
+  @param Index           Index of the entry in PpiList->PpiPtrs.
+
+**/
+STATIC
+VOID
+LinkPpiIndex (
+  IN OUT PEI_PPI_LIST  *PpiList,
+  IN     UINTN         Index
+  )
+{
+  UINTN   Bucket;
+  UINT32  *Link;
+
+  Bucket                            = PpiGuidHash (PpiList->PpiPtrs[Index].Ppi->Guid);
+  PpiList->BucketGeneration[Bucket] = ++PpiList->Generation;
+
+  Link = &PpiList->Bucket[Bucket];
+  while ((*Link != 0) && (*Link - 1 < Index)) {
+    Link = &PpiList->PpiNext[*Link - 1];
+  }
+
+  PpiList->PpiNext[Index] = *Link;
+  *Link                   = (UINT32)(Index + 1);
+}
+
+/**
+
+  Removes an entry of the PPI list from the GUID index.
+
+  @param PpiList         Pointer to the PPI list.
+  @param Index           Index of the entry in PpiList->PpiPtrs.
+
+**/
+STATIC
+VOID
+UnlinkPpiIndex (
+  IN OUT PEI_PPI_LIST  *PpiList,
+  IN     UINTN         Index
+  )
+{
+  UINTN   Bucket;
+  UINT32  *Link;
+
+  Bucket                            = PpiGuidHash (PpiList->PpiPtrs[Index].Ppi->Guid);
+  PpiList->BucketGeneration[Bucket] = ++PpiList->Generation;
+
+  Link = &PpiList->Bucket[Bucket];
+  while ((*Link != 0) && (*Link - 1 != Index)) {
+    Link = &PpiList->PpiNext[*Link - 1];
+  }
+
+  ASSERT (*Link != 0);
+  if (*Link != 0) {
+    *Link = PpiList->PpiNext[Index];
+  }
+}
+
 /**
 
   Dumps the PPI lists to debug output.
@@ -499,7 +579,18 @@ InternalPeiInstallPpi (
         PpiListPointer->PpiPtrs,
         sizeof (PEI_PPI_LIST_POINTERS) * PpiListPointer->MaxCount
         );
-      PpiListPointer->PpiPtrs  = TempPtr;
+      PpiListPointer->PpiPtrs = TempPtr;
+
+      TempPtr = AllocateZeroPool (
+                  sizeof (UINT32) * (PpiListPointer->MaxCount + PPI_GROWTH_STEP)
+                  );
+      ASSERT (TempPtr != NULL);
+      CopyMem (
+        TempPtr,
+        PpiListPointer->PpiNext,
+        sizeof (UINT32) * PpiListPointer->MaxCount
+        );
+      PpiListPointer->PpiNext  = TempPtr;
       PpiListPointer->MaxCount = PpiListPointer->MaxCount + PPI_GROWTH_STEP;
     }
 
@@ -528,6 +619,13 @@ InternalPeiInstallPpi (
     PpiList++;
   }
 
+  //
+  // Index the new PPIs only now that the whole list has been accepted.
+  //
+  for (Index = LastCount; Index < PpiListPointer->CurrentCount; Index++) {
+    LinkPpiIndex (PpiListPointer, Index);
+  }
+
   //
   // Process any callback level notifies for newly installed PPIs.
   //
@@ -624,7 +722,9 @@ PeiReInstallPpi (
   // Replace the old PPI with the new one.
   //
   DEBUG ((DEBUG_INFO, "Reinstall PPI: %g\n", NewPpi->Guid));
+  UnlinkPpiIndex (&PrivateData->PpiData.PpiList, Index);
   PrivateData->PpiData.PpiList.PpiPtrs[Index].Ppi = (EFI_PEI_PPI_DESCRIPTOR *)NewPpi;
+  LinkPpiIndex (&PrivateData->PpiData.PpiList, Index);
 
   //
   // Process any callback level notifies for the newly installed PPI.
@@ -668,18 +768,24 @@ PeiLocatePpi (
   )
 {
   PEI_CORE_INSTANCE       *PrivateData;
-  UINTN                   Index;
+  PEI_PPI_LIST            *PpiList;
+  UINT32                  Link;
   EFI_GUID                *CheckGuid;
   EFI_PEI_PPI_DESCRIPTOR  *TempPtr;
 
   PrivateData = PEI_CORE_INSTANCE_FROM_PS_THIS (PeiServices);
+  PpiList     = &PrivateData->PpiData.PpiList;
+  PpiList->LocateCount++;
 
   //
-  // Search the data base for the matching instance of the GUIDed PPI.
+  // Search the data base for the matching instance of the GUIDed PPI. Only
+  // the PPIs in the GUID's hash bucket need to be checked; they are chained in
+  // installation order.
   //
-  for (Index = 0; Index < PrivateData->PpiData.PpiList.CurrentCount; Index++) {
-    TempPtr   = PrivateData->PpiData.PpiList.PpiPtrs[Index].Ppi;
+  for (Link = PpiList->Bucket[PpiGuidHash (Guid)]; Link != 0; Link = PpiList->PpiNext[Link - 1]) {
+    TempPtr   = PpiList->PpiPtrs[Link - 1].Ppi;
     CheckGuid = TempPtr->Guid;
+    PpiList->LocateCompareCount++;
 
     //
     // Don't use CompareGuid function here for performance reasons.
@@ -968,9 +1074,13 @@ ProcessNotify (
 {
   INTN                       Index1;
   INTN                       Index2;
+  UINT32                     Link;
   EFI_GUID                   *SearchGuid;
   EFI_GUID                   *CheckGuid;
   EFI_PEI_NOTIFY_DESCRIPTOR  *NotifyDescriptor;
+  PEI_PPI_LIST               *PpiList;
+
+  PpiList = &PrivateData->PpiData.PpiList;
 
   for (Index1 = NotifyStartIndex; Index1 < NotifyStopIndex; Index1++) {
     if (NotifyType == EFI_PEI_PPI_DESCRIPTOR_NOTIFY_CALLBACK) {
@@ -981,8 +1091,23 @@ ProcessNotify (
 
     CheckGuid = NotifyDescriptor->Guid;
 
-    for (Index2 = InstallStartIndex; Index2 < InstallStopIndex; Index2++) {
-      SearchGuid = PrivateData->PpiData.PpiList.PpiPtrs[Index2].Ppi->Guid;
+    //
+    // Walk the PPIs with the notify GUID's hash, in installation order. The
+    // link is fetched before the notify function may modify the list.
+    //
+    Link = PpiList->Bucket[PpiGuidHash (CheckGuid)];
+    while (Link != 0) {
+      Index2 = (INTN)Link - 1;
+      Link   = PpiList->PpiNext[Index2];
+      if (Index2 < InstallStartIndex) {
+        continue;
+      }
+
+      if (Index2 >= InstallStopIndex) {
+        break;
+      }
+
+      SearchGuid = PpiList->PpiPtrs[Index2].Ppi->Guid;
       //
       // Don't use CompareGuid function here for performance reasons.
       // Instead we compare the GUID as INT32 at a time and branch
@@ -1002,7 +1127,7 @@ ProcessNotify (
         NotifyDescriptor->Notify (
                             (EFI_PEI_SERVICES **)GetPeiServicesTablePointer (),
                             NotifyDescriptor,
-                            (PrivateData->PpiData.PpiList.PpiPtrs[Index2].Ppi)->Ppi
+                            (PpiList->PpiPtrs[Index2].Ppi)->Ppi
                             );
       }
     }
@@ -54,6 +54,7 @@
 #include <Library/PerformanceLib.h>
 #include <Library/HobLib.h>
 #include <Library/SmmMemLib.h>
+#include <Library/TimerLib.h>
 
 #include "PiSmmCorePrivateData.h"
 #include "HeapGuard.h"
@@ -74,13 +75,16 @@ typedef struct {
 
 #define SMI_ENTRY_SIGNATURE  SIGNATURE_32('s','m','i','e')
 
-typedef struct {
+typedef struct _SMI_ENTRY SMI_ENTRY;
+
+struct _SMI_ENTRY {
   UINTN         Signature;
   LIST_ENTRY    AllEntries; // All entries
 
   EFI_GUID      HandlerType; // Type of interrupt
   LIST_ENTRY    SmiHandlers; // All handlers
-} SMI_ENTRY;
+  SMI_ENTRY     *HashNext;   // Next entry in the same bucket of mSmiEntryHash
+};
 
 #define SMI_HANDLER_SIGNATURE  SIGNATURE_32('s','m','i','h')
 
@@ -92,6 +96,8 @@ typedef struct {
   SMI_ENTRY                       *SmiEntry;
   VOID                            *Context;    // for profile
   UINTN                           ContextSize; // for profile
+  UINT64                          DispatchCount; // for profile
+  UINT64                          DispatchTicks; // for profile, in performance counter ticks
 } SMI_HANDLER;
 
 //
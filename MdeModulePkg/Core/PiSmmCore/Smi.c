@@ -10,6 +10,20 @@
 
 LIST_ENTRY  mSmiEntryList = INITIALIZE_LIST_HEAD_VARIABLE (mSmiEntryList);
 
+//
+// The entries of mSmiEntryList hashed by handler type, so that the SMI entry
+// of a GUID is found without walking all the registered handler types.
+//
+#define SMI_ENTRY_HASH_BUCKETS  64
+
+SMI_ENTRY  *mSmiEntryHash[SMI_ENTRY_HASH_BUCKETS];
+
+//
+// Performance counter properties, for the SMI handler dispatch statistics
+//
+UINT64  mSmiPerformanceCounterStart;
+UINT64  mSmiPerformanceCounterEnd;
+
 SMI_ENTRY  mRootSmiEntry = {
   SMI_ENTRY_SIGNATURE,
   INITIALIZE_LIST_HEAD_VARIABLE (mRootSmiEntry.AllEntries),
@@ -17,6 +31,56 @@ SMI_ENTRY  mRootSmiEntry = {
   INITIALIZE_LIST_HEAD_VARIABLE (mRootSmiEntry.SmiHandlers),
 };
 
+/**
+  Returns the bucket of mSmiEntryHash for a handler type.
+
+  @param  HandlerType            The type of the interrupt
+
+  @return Index in mSmiEntryHash
+
+**/
+STATIC
+UINTN
+SmiEntryHash (
+  IN CONST EFI_GUID  *HandlerType
+  )
+{
+  return (ReadUnaligned32 ((CONST UINT32 *)HandlerType) ^
+          ReadUnaligned32 ((CONST UINT32 *)HandlerType + 3)) & (SMI_ENTRY_HASH_BUCKETS - 1);
+}
+
+/**
+  Returns the number of performance counter ticks elapsed since Begin.
+
+  @param  Begin                  Performance counter value at the start.
+
+  @return Elapsed ticks
+
+**/
+STATIC
+UINT64
+SmiElapsedTicks (
+  IN UINT64  Begin
+  )
+{
+  UINT64  Now;
+
+  Now = GetPerformanceCounter ();
+  if (mSmiPerformanceCounterStart < mSmiPerformanceCounterEnd) {
+    if (Now >= Begin) {
+      return Now - Begin;
+    }
+
+    return (mSmiPerformanceCounterEnd - Begin) + (Now - mSmiPerformanceCounterStart) + 1;
+  }
+
+  if (Begin >= Now) {
+    return Begin - Now;
+  }
+
+  return (Begin - mSmiPerformanceCounterEnd) + (mSmiPerformanceCounterStart - Now) + 1;
+}
+
 /**
   Finds the SMI entry for the requested handler type.
 
@@ -33,19 +97,17 @@ SmmCoreFindSmiEntry (
   IN BOOLEAN   Create
   )
 {
-  LIST_ENTRY  *Link;
-  SMI_ENTRY   *Item;
-  SMI_ENTRY   *SmiEntry;
+  UINTN      Bucket;
+  SMI_ENTRY  *Item;
+  SMI_ENTRY  *SmiEntry;
 
   //
-  // Search the SMI entry list for the matching GUID
+  // Search the bucket of the GUID for the matching SMI entry
   //
   SmiEntry = NULL;
-  for (Link = mSmiEntryList.ForwardLink;
-       Link != &mSmiEntryList;
-       Link = Link->ForwardLink)
-  {
-    Item = CR (Link, SMI_ENTRY, AllEntries, SMI_ENTRY_SIGNATURE);
+  Bucket   = SmiEntryHash (HandlerType);
+  for (Item = mSmiEntryHash[Bucket]; Item != NULL; Item = Item->HashNext) {
+    ASSERT (Item->Signature == SMI_ENTRY_SIGNATURE);
     if (CompareGuid (&Item->HandlerType, HandlerType)) {
       //
       // This is the SMI entry
@@ -70,9 +132,11 @@ SmmCoreFindSmiEntry (
       InitializeListHead (&SmiEntry->SmiHandlers);
 
       //
-      // Add it to SMI entry list
+      // Add it to SMI entry list and index
       //
       InsertTailList (&mSmiEntryList, &SmiEntry->AllEntries);
+      SmiEntry->HashNext    = mSmiEntryHash[Bucket];
+      mSmiEntryHash[Bucket] = SmiEntry;
     }
   }
 
@@ -108,9 +172,13 @@ SmiManage (
   SMI_HANDLER  *SmiHandler;
   BOOLEAN      SuccessReturn;
   EFI_STATUS   Status;
+  BOOLEAN      Profile;
+  UINT64       Begin;
 
   Status        = EFI_NOT_FOUND;
   SuccessReturn = FALSE;
+  Profile       = (BOOLEAN)((PcdGet8 (PcdSmiHandlerProfilePropertyMask) & 0x1) != 0);
+  Begin         = 0;
   if (HandlerType == NULL) {
     //
     // Root SMI handler
@@ -134,6 +202,10 @@ SmiManage (
   for (Link = Head->ForwardLink; Link != Head; Link = Link->ForwardLink) {
     SmiHandler = CR (Link, SMI_HANDLER, Link, SMI_HANDLER_SIGNATURE);
 
+    if (Profile) {
+      Begin = GetPerformanceCounter ();
+    }
+
     Status = SmiHandler->Handler (
                            (EFI_HANDLE)SmiHandler,
                            Context,
@@ -141,6 +213,14 @@ SmiManage (
                            CommBufferSize
                            );
 
+    if (Profile) {
+      //
+      // Dispatch statistics reported by the SMI handler profile
+      //
+      SmiHandler->DispatchCount++;
+      SmiHandler->DispatchTicks += SmiElapsedTicks (Begin);
+    }
+
     switch (Status) {
       case EFI_INTERRUPT_PENDING:
         //
@@ -275,6 +355,7 @@ SmiHandlerUnRegister (
 {
   SMI_HANDLER  *SmiHandler;
   SMI_ENTRY    *SmiEntry;
+  SMI_ENTRY    **Link;
   LIST_ENTRY   *EntryLink;
   LIST_ENTRY   *HandlerLink;
 
@@ -333,6 +414,12 @@ SmiHandlerUnRegister (
     // No handler registered for this interrupt now, remove the SMI_ENTRY
     //
     RemoveEntryList (&SmiEntry->AllEntries);
+    for (Link = &mSmiEntryHash[SmiEntryHash (&SmiEntry->HandlerType)]; *Link != NULL; Link = &(*Link)->HashNext) {
+      if (*Link == SmiEntry) {
+        *Link = SmiEntry->HashNext;
+        break;
+      }
+    }
 
     FreePool (SmiEntry);
   }
@@ -70,9 +70,27 @@ InternalPeCoffGetEntryPoint (
   OUT VOID  **EntryPoint
   );
 
+/**
+  Finds the SMI entry for the requested handler type.
+
+  @param  HandlerType            The type of the interrupt
+  @param  Create                 Create a new entry if not found
+
+  @return SMI entry
+
+**/
+SMI_ENTRY  *
+EFIAPI
+SmmCoreFindSmiEntry (
+  IN EFI_GUID  *HandlerType,
+  IN BOOLEAN   Create
+  );
+
 extern LIST_ENTRY  mSmiEntryList;
 extern LIST_ENTRY  mHardwareSmiEntryList;
 extern SMI_ENTRY   mRootSmiEntry;
+extern UINT64      mSmiPerformanceCounterStart;
+extern UINT64      mSmiPerformanceCounterEnd;
 
 extern SMI_HANDLER_PROFILE_PROTOCOL  mSmiHandlerProfile;
 
@@ -737,6 +755,8 @@ GetSmmSmiHandlerDataOnSmiEntry (
     SmiHandlerStruct->Handler           = (UINTN)SmiHandler->Handler;
     SmiHandlerStruct->ImageRef          = AddressToImageRef ((UINTN)SmiHandler->Handler);
     SmiHandlerStruct->ContextBufferSize = (UINT32)SmiHandler->ContextSize;
+    SmiHandlerStruct->DispatchCount     = SmiHandler->DispatchCount;
+    SmiHandlerStruct->DispatchTime      = GetTimeInNanoSecond (SmiHandler->DispatchTicks);
     if (SmiHandler->ContextSize != 0) {
       SmiHandlerStruct->ContextBufferOffset = sizeof (SMM_CORE_SMI_HANDLER_STRUCTURE);
       CopyMem ((UINT8 *)SmiHandlerStruct + SmiHandlerStruct->ContextBufferOffset, SmiHandler->Context, SmiHandler->ContextSize);
@@ -882,6 +902,69 @@ BuildSmiHandlerProfileDatabase (
   }
 }
 
+/**
+  Refresh the dispatch statistics of the root and GUID SMI handlers in the
+  SMI handler profile database.
+
+  The database is built once at SmmReadyToLock, while the handlers keep being
+  dispatched afterwards, so the counters are updated in place before the
+  database is reported.
+**/
+VOID
+RefreshSmiHandlerDispatchStatistics (
+  VOID
+  )
+{
+  SMM_CORE_SMI_DATABASE_STRUCTURE  *SmiStruct;
+  SMM_CORE_SMI_HANDLER_STRUCTURE   *SmiHandlerStruct;
+  SMI_ENTRY                        *SmiEntry;
+  SMI_HANDLER                      *SmiHandler;
+  LIST_ENTRY                       *ListEntry;
+  UINTN                            Offset;
+  UINT32                           Index;
+
+  if (mSmiHandlerProfileDatabase == NULL) {
+    return;
+  }
+
+  //
+  // Root and GUID SMI databases follow the image database. Hardware handlers
+  // are not dispatched by the SMM core so have no statistics.
+  //
+  for (Offset = mSmmImageDatabaseSize;
+       Offset < mSmmImageDatabaseSize + mSmmRootSmiDatabaseSize + mSmmSmiDatabaseSize;
+       Offset += SmiStruct->Header.Length)
+  {
+    SmiStruct = (SMM_CORE_SMI_DATABASE_STRUCTURE *)((UINT8 *)mSmiHandlerProfileDatabase + Offset);
+    if (SmiStruct->HandlerCategory == SmmCoreSmiHandlerCategoryRootHandler) {
+      SmiEntry = &mRootSmiEntry;
+    } else {
+      SmiEntry = SmmCoreFindSmiEntry (&SmiStruct->HandlerType, FALSE);
+    }
+
+    SmiHandlerStruct = (SMM_CORE_SMI_HANDLER_STRUCTURE *)(SmiStruct + 1);
+    for (Index = 0; Index < SmiStruct->HandlerCount; Index++) {
+      if (SmiEntry != NULL) {
+        for (ListEntry = SmiEntry->SmiHandlers.ForwardLink;
+             ListEntry != &SmiEntry->SmiHandlers;
+             ListEntry = ListEntry->ForwardLink)
+        {
+          SmiHandler = CR (ListEntry, SMI_HANDLER, Link, SMI_HANDLER_SIGNATURE);
+          if (((UINTN)SmiHandler->Handler == SmiHandlerStruct->Handler) &&
+              ((UINTN)SmiHandler->CallerAddr == SmiHandlerStruct->CallerAddr))
+          {
+            SmiHandlerStruct->DispatchCount = SmiHandler->DispatchCount;
+            SmiHandlerStruct->DispatchTime  = GetTimeInNanoSecond (SmiHandler->DispatchTicks);
+            break;
+          }
+        }
+      }
+
+      SmiHandlerStruct = (SMM_CORE_SMI_HANDLER_STRUCTURE *)((UINTN)SmiHandlerStruct + SmiHandlerStruct->Length);
+    }
+  }
+}
+
 /**
   Copy SMI handler profile data.
 
@@ -932,6 +1015,8 @@ SmiHandlerProfileHandlerGetInfo (
   SmiHandlerProfileRecordingStatus  = mSmiHandlerProfileRecordingStatus;
   mSmiHandlerProfileRecordingStatus = FALSE;
 
+  RefreshSmiHandlerDispatchStatistics ();
+
   SmiHandlerProfileParameterGetInfo->DataSize            = mSmiHandlerProfileDatabaseSize;
   SmiHandlerProfileParameterGetInfo->Header.ReturnStatus = 0;
 
@@ -1400,6 +1485,8 @@ SmmCoreInitializeSmiHandlerProfile (
   if ((PcdGet8 (PcdSmiHandlerProfilePropertyMask) & 0x1) != 0) {
     InsertTailList (&mRootSmiEntryList, &mRootSmiEntry.AllEntries);
 
+    GetPerformanceCounterProperties (&mSmiPerformanceCounterStart, &mSmiPerformanceCounterEnd);
+
     Status = gSmst->SmmRegisterProtocolNotify (
                       &gEfiSmmReadyToLockProtocolGuid,
                       SmmReadyToLockInSmiHandlerProfile,
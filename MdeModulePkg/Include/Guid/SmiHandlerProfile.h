@@ -42,7 +42,7 @@ typedef struct {
 } SMM_CORE_IMAGE_DATABASE_STRUCTURE;
 
 #define SMM_CORE_SMI_DATABASE_SIGNATURE  SIGNATURE_32 ('S','C','S','D')
-#define SMM_CORE_SMI_DATABASE_REVISION   0x0001
+#define SMM_CORE_SMI_DATABASE_REVISION   0x0002
 
 typedef enum {
   SmmCoreSmiHandlerCategoryRootHandler,
@@ -85,6 +85,13 @@ typedef struct {
   UINT16              ContextBufferOffset;
   UINT8               Reserved[2];
   UINT32              ContextBufferSize;
+  //
+  // Added in SMM_CORE_SMI_DATABASE_REVISION 0x0002.
+  // Number of dispatches and total time spent in the handler, in nanoseconds.
+  // Always 0 for SmmCoreSmiHandlerCategoryHardwareHandler.
+  //
+  UINT64              DispatchCount;
+  UINT64              DispatchTime;
   // UINT8                 ContextBuffer[];
 } SMM_CORE_SMI_HANDLER_STRUCTURE;
 
@@ -77,6 +77,10 @@ typedef struct {
 // The payload for this function is SMM_VARIABLE_COMMUNICATE_GET_RUNTIME_CACHE_INFO
 //
 #define SMM_VARIABLE_FUNCTION_GET_RUNTIME_CACHE_INFO  14
+//
+// The payload for this function is SMM_VARIABLE_COMMUNICATE_GET_NEXT_VARIABLE_NAME_BATCH
+//
+#define SMM_VARIABLE_FUNCTION_GET_NEXT_VARIABLE_NAME_BATCH  15
 
 ///
 /// Size of SMM communicate header, without including the payload.
@@ -118,6 +122,31 @@ typedef struct {
   UINT32    Attributes;
 } SMM_VARIABLE_COMMUNICATE_QUERY_VARIABLE_INFO;
 
+///
+/// This structure is used to communicate with SMI handler by GetNextVariableName
+/// to fetch the names of several consecutive variables at once.
+///
+/// On input, Guid and Name identify the variable to start after, and the rest
+/// of the payload is available for the result. On output, Name holds EntryCount
+/// SMM_VARIABLE_COMMUNICATE_VARIABLE_NAME_ENTRY structures, each aligned on a
+/// UINTN boundary, taking DataSize bytes in total.
+///
+typedef struct {
+  EFI_GUID    Guid;
+  UINTN       EntryCount;
+  UINTN       DataSize;
+  CHAR16      Name[1];
+} SMM_VARIABLE_COMMUNICATE_GET_NEXT_VARIABLE_NAME_BATCH;
+
+///
+/// A variable name returned by SMM_VARIABLE_FUNCTION_GET_NEXT_VARIABLE_NAME_BATCH.
+///
+typedef struct {
+  EFI_GUID    Guid;
+  UINTN       NameSize;
+  CHAR16      Name[1];
+} SMM_VARIABLE_COMMUNICATE_VARIABLE_NAME_ENTRY;
+
 typedef SMM_VARIABLE_COMMUNICATE_GET_NEXT_VARIABLE_NAME SMM_VARIABLE_COMMUNICATE_LOCK_VARIABLE;
 
 typedef struct {
@@ -1408,6 +1408,43 @@ CoDClearCapsuleRelocationInfo (
                 );
 }
 
+/**
+  Append data to the Capsule On Disk relocation file.
+
+  @param[in]  File       The relocation file.
+  @param[in]  Buffer     The data to append.
+  @param[in]  Size       The size of Buffer in bytes.
+
+  @retval EFI_SUCCESS       The data was appended.
+  @retval EFI_DEVICE_ERROR  Part of the data could not be written.
+  @retval Others            The error returned by File->Write().
+
+**/
+static
+EFI_STATUS
+WriteRelocationFile (
+  IN EFI_FILE_HANDLE  File,
+  IN VOID             *Buffer,
+  IN UINTN            Size
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       DataSize;
+
+  DataSize = Size;
+  Status   = File->Write (File, &DataSize, Buffer);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "RelocateCapsule: Write TemCoD.tmp error. %x\n", Status));
+    return Status;
+  }
+
+  if (DataSize != Size) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  return EFI_SUCCESS;
+}
+
 /**
   Relocate Capsule on Disk from EFI system partition to a platform-specific NV storage device
   with BlockIo protocol. Relocation device path, identified by PcdCodRelocationDevPath, must
@@ -1442,12 +1479,11 @@ RelocateCapsuleToDisk (
   EFI_HANDLE                       *HandleBuffer;
   UINTN                            NumberOfHandles;
   EFI_BLOCK_IO_PROTOCOL            *BlockIo;
-  UINT8                            *CapsuleDataBuf;
-  UINT8                            *CapsulePtr;
   EFI_SIMPLE_FILE_SYSTEM_PROTOCOL  *Fs;
   EFI_FILE_HANDLE                  RootDir;
   EFI_FILE_HANDLE                  TempCodFile;
   UINT64                           TempCodFileSize;
+  UINT64                           TotalSize;
   EFI_DEVICE_PATH                  *TempDevicePath;
   BOOLEAN                          RelocationInfo;
   UINT16                           LoadOptionNumber;
@@ -1456,7 +1492,6 @@ RelocateCapsuleToDisk (
   RootDir          = NULL;
   TempCodFile      = NULL;
   HandleBuffer     = NULL;
-  CapsuleDataBuf   = NULL;
   CapsuleOnDiskBuf = NULL;
   NumberOfHandles  = 0;
 
@@ -1582,43 +1617,6 @@ RelocateCapsuleToDisk (
     goto EXIT;
   }
 
-  CapsuleDataBuf = AllocatePool ((UINTN)TempCodFileSize);
-  if (CapsuleDataBuf == NULL) {
-    Status = EFI_OUT_OF_RESOURCES;
-    goto EXIT;
-  }
-
-  //
-  // First UINT64 reserved for total image size, including capsule name capsule.
-  //
-  *(UINT64 *)CapsuleDataBuf = TotalImageSize + sizeof (EFI_CAPSULE_HEADER) + TotalImageNameSize;
-
-  //
-  // Line up all the Capsule on Disk and write to relocation disk at one time. It could save some time in disk write
-  //
-  for (Index = 0, CapsulePtr = CapsuleDataBuf + sizeof (UINT64); Index < CapsuleOnDiskNum; Index++) {
-    CopyMem (CapsulePtr, CapsuleOnDiskBuf[Index].ImageAddress, (UINTN)CapsuleOnDiskBuf[Index].FileInfo->FileSize);
-    CapsulePtr += CapsuleOnDiskBuf[Index].FileInfo->FileSize;
-  }
-
-  //
-  // Line the capsule header for capsule name capsule.
-  //
-  CopyGuid (&FileNameCapsuleHeader.CapsuleGuid, &gEdkiiCapsuleOnDiskNameGuid);
-  FileNameCapsuleHeader.CapsuleImageSize = (UINT32)TotalImageNameSize + sizeof (EFI_CAPSULE_HEADER);
-  FileNameCapsuleHeader.Flags            = CAPSULE_FLAGS_PERSIST_ACROSS_RESET;
-  FileNameCapsuleHeader.HeaderSize       = sizeof (EFI_CAPSULE_HEADER);
-  CopyMem (CapsulePtr, &FileNameCapsuleHeader, FileNameCapsuleHeader.HeaderSize);
-  CapsulePtr += FileNameCapsuleHeader.HeaderSize;
-
-  //
-  // Line up all the Capsule file names.
-  //
-  for (Index = 0; Index < CapsuleOnDiskNum; Index++) {
-    CopyMem (CapsulePtr, CapsuleOnDiskBuf[Index].FileInfo->FileName, StrSize (CapsuleOnDiskBuf[Index].FileInfo->FileName));
-    CapsulePtr += StrSize (CapsuleOnDiskBuf[Index].FileInfo->FileName);
-  }
-
   //
   // 5. Flash all Capsules on Disk to TempCoD.tmp under RootDir
   //
@@ -1655,24 +1653,56 @@ RelocateCapsuleToDisk (
   }
 
   //
-  // Always write at the begining of TempCap file
+  // Always write at the begining of TempCap file. The capsules are written
+  // straight from the buffers they were loaded into, rather than lined up in
+  // one more buffer of the same total size first.
   //
-  DataSize = (UINTN)TempCodFileSize;
-  Status   = TempCodFile->Write (
-                            TempCodFile,
-                            &DataSize,
-                            CapsuleDataBuf
-                            );
+  // First UINT64 reserved for total image size, including capsule name capsule.
+  //
+  TotalSize = TotalImageSize + sizeof (EFI_CAPSULE_HEADER) + TotalImageNameSize;
+  Status    = WriteRelocationFile (TempCodFile, &TotalSize, sizeof (TotalSize));
   if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "RelocateCapsule: Write TemCoD.tmp error. %x\n", Status));
     goto EXIT;
   }
 
-  if (DataSize != TempCodFileSize) {
-    Status = EFI_DEVICE_ERROR;
+  for (Index = 0; Index < CapsuleOnDiskNum; Index++) {
+    Status = WriteRelocationFile (
+               TempCodFile,
+               CapsuleOnDiskBuf[Index].ImageAddress,
+               (UINTN)CapsuleOnDiskBuf[Index].FileInfo->FileSize
+               );
+    if (EFI_ERROR (Status)) {
+      goto EXIT;
+    }
+  }
+
+  //
+  // Line the capsule header for capsule name capsule.
+  //
+  CopyGuid (&FileNameCapsuleHeader.CapsuleGuid, &gEdkiiCapsuleOnDiskNameGuid);
+  FileNameCapsuleHeader.CapsuleImageSize = (UINT32)TotalImageNameSize + sizeof (EFI_CAPSULE_HEADER);
+  FileNameCapsuleHeader.Flags            = CAPSULE_FLAGS_PERSIST_ACROSS_RESET;
+  FileNameCapsuleHeader.HeaderSize       = sizeof (EFI_CAPSULE_HEADER);
+
+  Status = WriteRelocationFile (TempCodFile, &FileNameCapsuleHeader, FileNameCapsuleHeader.HeaderSize);
+  if (EFI_ERROR (Status)) {
     goto EXIT;
   }
 
+  //
+  // Line up all the Capsule file names.
+  //
+  for (Index = 0; Index < CapsuleOnDiskNum; Index++) {
+    Status = WriteRelocationFile (
+               TempCodFile,
+               CapsuleOnDiskBuf[Index].FileInfo->FileName,
+               StrSize (CapsuleOnDiskBuf[Index].FileInfo->FileName)
+               );
+    if (EFI_ERROR (Status)) {
+      goto EXIT;
+    }
+  }
+
   //
   // Save Capsule On Disk relocation info to "CodRelocationInfo" Var
   // It is used in next reboot by TCB
@@ -1700,10 +1730,6 @@ RelocateCapsuleToDisk (
 
 EXIT:
 
-  if (CapsuleDataBuf != NULL) {
-    FreePool (CapsuleDataBuf);
-  }
-
   if (CapsuleOnDiskBuf != NULL) {
     //
     // Free resources allocated by CodLibGetAllCapsuleOnDisk
@@ -25,6 +25,10 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define STRING_SIZE                (FPDT_STRING_EVENT_RECORD_NAME_LENGTH * sizeof (CHAR8))
 #define FIRMWARE_RECORD_BUFFER     0x10000
 #define CACHE_HANDLE_GUID_COUNT    0x800
+#define CACHE_HANDLE_GUID_BUCKETS  0x200
+
+#define CACHE_HANDLE_GUID_HASH(Handle) \
+  ((((UINTN)(Handle) >> 3) ^ ((UINTN)(Handle) >> 12)) & (CACHE_HANDLE_GUID_BUCKETS - 1))
 
 BOOT_PERFORMANCE_TABLE  *mAcpiBootPerformanceTable    = NULL;
 BOOT_PERFORMANCE_TABLE  mBootPerformanceTableTemplate = {
@@ -54,10 +58,16 @@ typedef struct {
   EFI_HANDLE    Handle;
   CHAR8         NameString[FPDT_STRING_EVENT_RECORD_NAME_LENGTH];
   EFI_GUID      ModuleGuid;
+  UINT16        Next;
 } HANDLE_GUID_MAP;
 
 HANDLE_GUID_MAP  mCacheHandleGuidTable[CACHE_HANDLE_GUID_COUNT];
 UINTN            mCachePairCount = 0;
+//
+// Chains of the cached pairs hashed by handle, newest first. A link is the
+// index of a pair plus one, so 0 ends a chain.
+//
+UINT16  mCacheHandleGuidHash[CACHE_HANDLE_GUID_BUCKETS];
 
 UINT32  mLoadImageCount       = 0;
 UINT32  mPerformanceLength    = 0;
@@ -460,7 +470,8 @@ GetModuleInfoFromHandle (
   EFI_GUID                           *TempGuid;
   UINTN                              StartIndex;
   UINTN                              Index;
-  INTN                               Count;
+  UINT16                             Link;
+  UINTN                              Bucket;
   BOOLEAN                            ModuleGuidIsGet;
   UINTN                              StringSize;
   CHAR16                             *StringPtr;
@@ -474,13 +485,12 @@ GetModuleInfoFromHandle (
   //
   // Try to get the ModuleGuid and name string form the caached array.
   //
-  if (mCachePairCount > 0) {
-    for (Count = mCachePairCount -1; Count >= 0; Count--) {
-      if (Handle == mCacheHandleGuidTable[Count].Handle) {
-        CopyGuid (ModuleGuid, &mCacheHandleGuidTable[Count].ModuleGuid);
-        AsciiStrCpyS (NameString, FPDT_STRING_EVENT_RECORD_NAME_LENGTH, mCacheHandleGuidTable[Count].NameString);
-        return EFI_SUCCESS;
-      }
+  Bucket = CACHE_HANDLE_GUID_HASH (Handle);
+  for (Link = mCacheHandleGuidHash[Bucket]; Link != 0; Link = mCacheHandleGuidTable[Link - 1].Next) {
+    if (Handle == mCacheHandleGuidTable[Link - 1].Handle) {
+      CopyGuid (ModuleGuid, &mCacheHandleGuidTable[Link - 1].ModuleGuid);
+      AsciiStrCpyS (NameString, FPDT_STRING_EVENT_RECORD_NAME_LENGTH, mCacheHandleGuidTable[Link - 1].NameString);
+      return EFI_SUCCESS;
     }
   }
 
@@ -666,6 +676,8 @@ Done:
     mCacheHandleGuidTable[mCachePairCount].Handle = Handle;
     CopyGuid (&mCacheHandleGuidTable[mCachePairCount].ModuleGuid, ModuleGuid);
     AsciiStrCpyS (mCacheHandleGuidTable[mCachePairCount].NameString, FPDT_STRING_EVENT_RECORD_NAME_LENGTH, NameString);
+    mCacheHandleGuidTable[mCachePairCount].Next = mCacheHandleGuidHash[Bucket];
+    mCacheHandleGuidHash[Bucket]                = (UINT16)(mCachePairCount + 1);
     mCachePairCount++;
   }
 
@@ -168,6 +168,68 @@ FtwAllocate (
   return EFI_SUCCESS;
 }
 
+/**
+  Mark a write record as destination completed, and the write header as
+  completed if the record is the last one of the header.
+
+  @param FtwDevice       The private data of FTW driver.
+  @param Header          The write header of the record.
+  @param Record          The write record whose target has been updated.
+
+  @retval  EFI_SUCCESS          The function completed successfully
+  @retval  EFI_ABORTED          The function could not complete successfully
+
+**/
+STATIC
+EFI_STATUS
+FtwCompleteWriteRecord (
+  IN EFI_FTW_DEVICE                   *FtwDevice,
+  IN EFI_FAULT_TOLERANT_WRITE_HEADER  *Header,
+  IN EFI_FAULT_TOLERANT_WRITE_RECORD  *Record
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       Offset;
+
+  //
+  // Record the DestionationComplete in record
+  //
+  Offset = (UINT8 *)Record - FtwDevice->FtwWorkSpace;
+  Status = FtwUpdateFvState (
+             FtwDevice->FtwFvBlock,
+             FtwDevice->WorkBlockSize,
+             FtwDevice->FtwWorkSpaceLba,
+             FtwDevice->FtwWorkSpaceBase + Offset,
+             DEST_COMPLETED
+             );
+  if (EFI_ERROR (Status)) {
+    return EFI_ABORTED;
+  }
+
+  Record->DestinationComplete = FTW_VALID_STATE;
+
+  //
+  // If this is the last Write in these write sequence,
+  // set the complete flag of write header.
+  //
+  if (IsLastRecordOfWrites (Header, Record)) {
+    Offset = (UINT8 *)Header - FtwDevice->FtwWorkSpace;
+    Status = FtwUpdateFvState (
+               FtwDevice->FtwFvBlock,
+               FtwDevice->WorkBlockSize,
+               FtwDevice->FtwWorkSpaceLba,
+               FtwDevice->FtwWorkSpaceBase + Offset,
+               WRITES_COMPLETED
+               );
+    Header->Complete = FTW_VALID_STATE;
+    if (EFI_ERROR (Status)) {
+      return EFI_ABORTED;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
 /**
   Write a record with fault tolerant manner.
   Since the content has already backuped in spare block, the write is
@@ -244,43 +306,7 @@ FtwWriteRecord (
     return EFI_ABORTED;
   }
 
-  //
-  // Record the DestionationComplete in record
-  //
-  Offset = (UINT8 *)Record - FtwDevice->FtwWorkSpace;
-  Status = FtwUpdateFvState (
-             FtwDevice->FtwFvBlock,
-             FtwDevice->WorkBlockSize,
-             FtwDevice->FtwWorkSpaceLba,
-             FtwDevice->FtwWorkSpaceBase + Offset,
-             DEST_COMPLETED
-             );
-  if (EFI_ERROR (Status)) {
-    return EFI_ABORTED;
-  }
-
-  Record->DestinationComplete = FTW_VALID_STATE;
-
-  //
-  // If this is the last Write in these write sequence,
-  // set the complete flag of write header.
-  //
-  if (IsLastRecordOfWrites (Header, Record)) {
-    Offset = (UINT8 *)Header - FtwDevice->FtwWorkSpace;
-    Status = FtwUpdateFvState (
-               FtwDevice->FtwFvBlock,
-               FtwDevice->WorkBlockSize,
-               FtwDevice->FtwWorkSpaceLba,
-               FtwDevice->FtwWorkSpaceBase + Offset,
-               WRITES_COMPLETED
-               );
-    Header->Complete = FTW_VALID_STATE;
-    if (EFI_ERROR (Status)) {
-      return EFI_ABORTED;
-    }
-  }
-
-  return EFI_SUCCESS;
+  return FtwCompleteWriteRecord (FtwDevice, Header, Record);
 }
 
 /**
@@ -338,6 +364,7 @@ FtwWrite (
   UINTN                               NumberOfBlocks;
   UINTN                               NumberOfWriteBlocks;
   UINTN                               WriteLength;
+  BOOLEAN                             SpareErased;
 
   FtwDevice = FTW_CONTEXT_FROM_THIS (This);
 
@@ -490,6 +517,25 @@ FtwWrite (
     Ptr += MyLength;
   }
 
+  //
+  // If the target already holds the data, there is nothing to update.
+  // Close the record without the spare and target erase/program cycles;
+  // the target is valid at any point, so this is fault tolerant as well.
+  //
+  if (CompareMem (MyBuffer + Offset, Buffer, Length) == 0) {
+    FreePool (MyBuffer);
+    Status = FtwCompleteWriteRecord (FtwDevice, Header, Record);
+    DEBUG ((
+      DEBUG_INFO,
+      "Ftw: Write() unchanged, (Lba:Offset)=(%lx:0x%x), Length: 0x%x - %r\n",
+      Lba,
+      Offset,
+      Length,
+      Status
+      ));
+    return Status;
+  }
+
   //
   // Overwrite the updating range data with
   // the input buffer content
@@ -526,15 +572,23 @@ FtwWrite (
     Ptr += MyLength;
   }
 
+  //
+  // The spare block is normally left erased by the previous write, in which
+  // case it neither needs to be erased now nor to be programmed back later.
+  //
+  SpareErased = IsErasedFlashBuffer (SpareBuffer, SpareBufferSize);
+
   //
   // Write the memory buffer to spare block
   // Do not assume Spare Block and Target Block have same block size
   //
-  Status = FtwEraseSpareBlock (FtwDevice);
-  if (EFI_ERROR (Status)) {
-    FreePool (MyBuffer);
-    FreePool (SpareBuffer);
-    return EFI_ABORTED;
+  if (!SpareErased) {
+    Status = FtwEraseSpareBlock (FtwDevice);
+    if (EFI_ERROR (Status)) {
+      FreePool (MyBuffer);
+      FreePool (SpareBuffer);
+      return EFI_ABORTED;
+    }
   }
 
   Ptr = MyBuffer;
@@ -605,7 +659,7 @@ FtwWrite (
   }
 
   Ptr = SpareBuffer;
-  for (Index = 0; Index < FtwDevice->NumberOfSpareBlock; Index += 1) {
+  for (Index = 0; !SpareErased && (Index < FtwDevice->NumberOfSpareBlock); Index += 1) {
     MyLength = FtwDevice->SpareBlockSize;
     Status   = FtwDevice->FtwBackupFvb->Write (
                                           FtwDevice->FtwBackupFvb,
@@ -424,6 +424,78 @@ SmmVariableGetStatistics (
   return EFI_SUCCESS;
 }
 
+/**
+  Returns the names of the variables following a given one, as many as fit
+  in the communicate buffer.
+
+  Caution: This function may receive untrusted input.
+  The name in NameBatch is external input; the caller has checked that it is
+  Null-terminated within NameBufferSize bytes.
+
+  @param[in, out] NameBatch       On input, the variable to start after. On output,
+                                  the variable names following it.
+  @param[in]      NameBufferSize  Size of the NameBatch->Name buffer.
+
+  @retval EFI_SUCCESS             At least one variable name is returned.
+  @retval EFI_NOT_FOUND           There is no variable after the input one.
+  @retval EFI_BUFFER_TOO_SMALL    The next variable name does not fit in the buffer.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to process the request.
+  @retval Others                  Error returned by VariableServiceGetNextVariableName().
+
+**/
+STATIC
+EFI_STATUS
+SmmGetNextVariableNameBatch (
+  IN OUT SMM_VARIABLE_COMMUNICATE_GET_NEXT_VARIABLE_NAME_BATCH  *NameBatch,
+  IN     UINTN                                                  NameBufferSize
+  )
+{
+  EFI_STATUS                                    Status;
+  CHAR16                                        *VariableName;
+  EFI_GUID                                      VendorGuid;
+  UINTN                                         VariableNameSize;
+  UINTN                                         EntrySize;
+  SMM_VARIABLE_COMMUNICATE_VARIABLE_NAME_ENTRY  *Entry;
+
+  //
+  // The result overwrites the input name, so work on a copy of it.
+  //
+  VariableName = AllocateCopyPool (NameBufferSize, NameBatch->Name);
+  if (VariableName == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  CopyGuid (&VendorGuid, &NameBatch->Guid);
+  NameBatch->EntryCount = 0;
+  NameBatch->DataSize   = 0;
+
+  while (TRUE) {
+    VariableNameSize = NameBufferSize;
+    Status           = VariableServiceGetNextVariableName (&VariableNameSize, VariableName, &VendorGuid);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    EntrySize = ALIGN_VALUE (OFFSET_OF (SMM_VARIABLE_COMMUNICATE_VARIABLE_NAME_ENTRY, Name) + VariableNameSize, sizeof (UINTN));
+    if (EntrySize > NameBufferSize - NameBatch->DataSize) {
+      Status = EFI_BUFFER_TOO_SMALL;
+      break;
+    }
+
+    Entry = (SMM_VARIABLE_COMMUNICATE_VARIABLE_NAME_ENTRY *)((UINT8 *)NameBatch->Name + NameBatch->DataSize);
+    CopyGuid (&Entry->Guid, &VendorGuid);
+    Entry->NameSize = VariableNameSize;
+    CopyMem (Entry->Name, VariableName, VariableNameSize);
+
+    NameBatch->DataSize += EntrySize;
+    NameBatch->EntryCount++;
+  }
+
+  FreePool (VariableName);
+
+  return (NameBatch->EntryCount > 0) ? EFI_SUCCESS : Status;
+}
+
 /**
   Communication service SMI Handler entry.
 
@@ -463,6 +535,7 @@ SmmVariableHandler (
   SMM_VARIABLE_COMMUNICATE_HEADER                          *SmmVariableFunctionHeader;
   SMM_VARIABLE_COMMUNICATE_ACCESS_VARIABLE                 *SmmVariableHeader;
   SMM_VARIABLE_COMMUNICATE_GET_NEXT_VARIABLE_NAME          *GetNextVariableName;
+  SMM_VARIABLE_COMMUNICATE_GET_NEXT_VARIABLE_NAME_BATCH    *GetNextVariableNameBatch;
   SMM_VARIABLE_COMMUNICATE_QUERY_VARIABLE_INFO             *QueryVariableInfo;
   SMM_VARIABLE_COMMUNICATE_GET_PAYLOAD_SIZE                *GetPayloadSize;
   SMM_VARIABLE_COMMUNICATE_RUNTIME_VARIABLE_CACHE_CONTEXT  *RuntimeVariableCacheContext;
@@ -608,6 +681,31 @@ SmmVariableHandler (
       CopyMem (SmmVariableFunctionHeader->Data, mVariableBufferPayload, CommBufferPayloadSize);
       break;
 
+    case SMM_VARIABLE_FUNCTION_GET_NEXT_VARIABLE_NAME_BATCH:
+      if (CommBufferPayloadSize < OFFSET_OF (SMM_VARIABLE_COMMUNICATE_GET_NEXT_VARIABLE_NAME_BATCH, Name)) {
+        DEBUG ((DEBUG_ERROR, "GetNextVariableNameBatch: SMM communication buffer size invalid!\n"));
+        return EFI_SUCCESS;
+      }
+
+      //
+      // Copy the input communicate buffer payload to pre-allocated SMM variable buffer payload.
+      //
+      CopyMem (mVariableBufferPayload, SmmVariableFunctionHeader->Data, CommBufferPayloadSize);
+      GetNextVariableNameBatch = (SMM_VARIABLE_COMMUNICATE_GET_NEXT_VARIABLE_NAME_BATCH *)mVariableBufferPayload;
+
+      NameBufferSize = CommBufferPayloadSize - OFFSET_OF (SMM_VARIABLE_COMMUNICATE_GET_NEXT_VARIABLE_NAME_BATCH, Name);
+      if ((NameBufferSize < sizeof (CHAR16)) || (GetNextVariableNameBatch->Name[NameBufferSize/sizeof (CHAR16) - 1] != L'\0')) {
+        //
+        // Make sure input VariableName is A Null-terminated string.
+        //
+        Status = EFI_ACCESS_DENIED;
+        goto EXIT;
+      }
+
+      Status = SmmGetNextVariableNameBatch (GetNextVariableNameBatch, NameBufferSize);
+      CopyMem (SmmVariableFunctionHeader->Data, mVariableBufferPayload, CommBufferPayloadSize);
+      break;
+
     case SMM_VARIABLE_FUNCTION_SET_VARIABLE:
       if (CommBufferPayloadSize < OFFSET_OF (SMM_VARIABLE_COMMUNICATE_ACCESS_VARIABLE, Name)) {
         DEBUG ((DEBUG_ERROR, "SetVariable: SMM communication buffer size invalid!\n"));
@@ -58,6 +58,8 @@ UINTN                           mVariableRuntimeHobCacheBufferSize;
 UINTN                           mVariableRuntimeNvCacheBufferSize;
 UINTN                           mVariableRuntimeVolatileCacheBufferSize;
 UINTN                           mVariableBufferPayloadSize;
+UINT8                           *mVariableNameBatch                  = NULL;
+UINTN                           mVariableNameBatchCount;
 BOOLEAN                         mVariableRuntimeCachePendingUpdate;
 BOOLEAN                         mVariableRuntimeCacheReadLock;
 BOOLEAN                         mVariableAuthFormat;
@@ -944,6 +946,126 @@ GetNextVariableNameInRuntimeCache (
   return Status;
 }
 
+/**
+  Returns the variable name that follows the given one from the batch of names
+  last fetched from SMM.
+
+  @param[in, out] VariableNameSize   Size of the variable name.
+  @param[in, out] VariableName       Pointer to variable name.
+  @param[in, out] VendorGuid         Variable Vendor Guid.
+  @param[in]      FirstEntry         TRUE to return the first name of the batch,
+                                     which follows the variable the batch was fetched for.
+
+  @retval EFI_SUCCESS                Find the specified variable.
+  @retval EFI_BUFFER_TO_SMALL        DataSize is too small for the result.
+  @retval EFI_NOT_FOUND              The next variable name is not in the batch.
+
+**/
+STATIC
+EFI_STATUS
+GetNextVariableNameInBatch (
+  IN OUT  UINTN     *VariableNameSize,
+  IN OUT  CHAR16    *VariableName,
+  IN OUT  EFI_GUID  *VendorGuid,
+  IN      BOOLEAN   FirstEntry
+  )
+{
+  SMM_VARIABLE_COMMUNICATE_VARIABLE_NAME_ENTRY  *Entry;
+  UINTN                                         Index;
+  BOOLEAN                                       Found;
+
+  Found = FirstEntry;
+  Entry = (SMM_VARIABLE_COMMUNICATE_VARIABLE_NAME_ENTRY *)mVariableNameBatch;
+
+  for (Index = 0; Index < mVariableNameBatchCount; Index++) {
+    if (Found) {
+      if (*VariableNameSize < Entry->NameSize) {
+        *VariableNameSize = Entry->NameSize;
+        return EFI_BUFFER_TOO_SMALL;
+      }
+
+      CopyGuid (VendorGuid, &Entry->Guid);
+      CopyMem (VariableName, Entry->Name, Entry->NameSize);
+      *VariableNameSize = Entry->NameSize;
+      return EFI_SUCCESS;
+    }
+
+    Found = (BOOLEAN)(CompareGuid (VendorGuid, &Entry->Guid) && (StrCmp (VariableName, Entry->Name) == 0));
+    Entry = (SMM_VARIABLE_COMMUNICATE_VARIABLE_NAME_ENTRY *)((UINT8 *)Entry +
+                                                             ALIGN_VALUE (OFFSET_OF (SMM_VARIABLE_COMMUNICATE_VARIABLE_NAME_ENTRY, Name) + Entry->NameSize, sizeof (UINTN)));
+  }
+
+  return EFI_NOT_FOUND;
+}
+
+/**
+  Fetches from SMM the names of the variables that follow the given one, as
+  many as fit in the communicate buffer, into mVariableNameBatch.
+
+  @param[in] VariableName            Pointer to variable name.
+  @param[in] VendorGuid              Variable Vendor Guid.
+
+  @retval EFI_SUCCESS                At least one variable name was fetched.
+  @retval EFI_NOT_FOUND              There is no variable after the given one.
+  @retval EFI_UNSUPPORTED            The SMM variable driver does not support batches.
+  @retval Others                     The batch could not be fetched.
+
+**/
+STATIC
+EFI_STATUS
+FetchVariableNameBatchFromSmm (
+  IN  CHAR16    *VariableName,
+  IN  EFI_GUID  *VendorGuid
+  )
+{
+  EFI_STATUS                                             Status;
+  UINTN                                                  PayloadSize;
+  SMM_VARIABLE_COMMUNICATE_GET_NEXT_VARIABLE_NAME_BATCH  *SmmNameBatch;
+  UINTN                                                  InVariableNameSize;
+
+  mVariableNameBatchCount = 0;
+  InVariableNameSize      = StrSize (VariableName);
+  SmmNameBatch            = NULL;
+
+  if (InVariableNameSize > mVariableBufferPayloadSize - OFFSET_OF (SMM_VARIABLE_COMMUNICATE_GET_NEXT_VARIABLE_NAME_BATCH, Name)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Hand the whole payload to SMM so that it can return as many names as fit.
+  //
+  PayloadSize = mVariableBufferPayloadSize;
+  Status      = InitCommunicateBuffer ((VOID **)&SmmNameBatch, PayloadSize, SMM_VARIABLE_FUNCTION_GET_NEXT_VARIABLE_NAME_BATCH);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  ASSERT (SmmNameBatch != NULL);
+
+  CopyGuid (&SmmNameBatch->Guid, VendorGuid);
+  CopyMem (SmmNameBatch->Name, VariableName, InVariableNameSize);
+  ZeroMem (
+    (UINT8 *)SmmNameBatch->Name + InVariableNameSize,
+    PayloadSize - OFFSET_OF (SMM_VARIABLE_COMMUNICATE_GET_NEXT_VARIABLE_NAME_BATCH, Name) - InVariableNameSize
+    );
+
+  Status = SendCommunicateBuffer (PayloadSize);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  if ((SmmNameBatch->EntryCount == 0) ||
+      (SmmNameBatch->DataSize > PayloadSize - OFFSET_OF (SMM_VARIABLE_COMMUNICATE_GET_NEXT_VARIABLE_NAME_BATCH, Name)))
+  {
+    return EFI_NOT_FOUND;
+  }
+
+  CopyMem (mVariableNameBatch, SmmNameBatch->Name, SmmNameBatch->DataSize);
+  mVariableNameBatchCount = SmmNameBatch->EntryCount;
+
+  return EFI_SUCCESS;
+}
+
 /**
   Finds the next available variable in a SMM variable store.
 
@@ -970,6 +1092,34 @@ GetNextVariableNameInSmm (
   UINTN                                            OutVariableNameSize;
   UINTN                                            InVariableNameSize;
 
+  //
+  // Enumerating variables takes one name per call, so serve the names from a
+  // batch fetched in a single SMI whenever the SMM driver supports it.
+  //
+  if (mVariableNameBatch != NULL) {
+    //
+    // A new enumeration starts with an empty name. The SMM side may have
+    // changed since the batch was fetched, so fetch a fresh one.
+    //
+    if (VariableName[0] == 0) {
+      mVariableNameBatchCount = 0;
+    }
+
+    Status = GetNextVariableNameInBatch (VariableNameSize, VariableName, VendorGuid, FALSE);
+    if (Status != EFI_NOT_FOUND) {
+      return Status;
+    }
+
+    Status = FetchVariableNameBatchFromSmm (VariableName, VendorGuid);
+    if (Status == EFI_UNSUPPORTED) {
+      mVariableNameBatch = NULL;
+    } else if (Status == EFI_NOT_FOUND) {
+      return Status;
+    } else if (!EFI_ERROR (Status)) {
+      return GetNextVariableNameInBatch (VariableNameSize, VariableName, VendorGuid, TRUE);
+    }
+  }
+
   OutVariableNameSize    = *VariableNameSize;
   InVariableNameSize     = StrSize (VariableName);
   SmmGetNextVariableName = NULL;
@@ -1159,6 +1309,11 @@ RuntimeServiceSetVariable (
 
   AcquireLockOnlyAtBootTime (&mVariableServicesLock);
 
+  //
+  // The variable may be created or deleted, drop the cached variable names.
+  //
+  mVariableNameBatchCount = 0;
+
   //
   // Init the communicate buffer. The buffer data size is:
   // SMM_COMMUNICATE_HEADER_SIZE + SMM_VARIABLE_COMMUNICATE_HEADER_SIZE + PayloadSize.
@@ -1286,6 +1441,12 @@ OnExitBootServices (
   IN      VOID       *Context
   )
 {
+  //
+  // Boot service only variables are not visible at runtime, drop the cached
+  // variable names that may include them.
+  //
+  mVariableNameBatchCount = 0;
+
   //
   // Init the communicate buffer. The buffer data size is:
   // SMM_COMMUNICATE_HEADER_SIZE + SMM_VARIABLE_COMMUNICATE_HEADER_SIZE.
@@ -1361,6 +1522,7 @@ VariableAddressChangeEvent (
   EfiConvertPointer (EFI_OPTIONAL_PTR, (VOID **)&mVariableRuntimeHobCacheBuffer);
   EfiConvertPointer (EFI_OPTIONAL_PTR, (VOID **)&mVariableRuntimeNvCacheBuffer);
   EfiConvertPointer (EFI_OPTIONAL_PTR, (VOID **)&mVariableRuntimeVolatileCacheBuffer);
+  EfiConvertPointer (EFI_OPTIONAL_PTR, (VOID **)&mVariableNameBatch);
 }
 
 /**
@@ -1657,6 +1819,12 @@ SmmVariableReady (
   //
   mVariableBufferPhysical = mVariableBuffer;
 
+  //
+  // Allocate memory for the variable names fetched from SMM in one batch.
+  // GetNextVariableName() falls back to one SMI per name if this fails.
+  //
+  mVariableNameBatch = AllocateRuntimePool (mVariableBufferPayloadSize);
+
   if (FeaturePcdGet (PcdEnableVariableRuntimeCache)) {
     DEBUG ((DEBUG_INFO, "Variable driver runtime cache is enabled.\n"));
     //
@@ -0,0 +1,65 @@
+/** @file
+  GUID and data structure of the HOB list index configuration table.
+
+  The DXE Core builds an index of the HOB list once, after the HOB list has
+  been relocated, and installs it into the EFI System Configuration Table.
+  HOB library instances use it to find the first HOB of a type, or the first
+  GUID HOB of a GUID, without walking the HOB list.
+
+  HOBs may be marked EFI_HOB_TYPE_UNUSED after the index has been built, so a
+  HOB found in the index is only a starting point for a search.
+
+  Copyright (c) 2026, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef __HOB_LIST_INDEX_GUID_H__
+#define __HOB_LIST_INDEX_GUID_H__
+
+#define EDKII_HOB_LIST_INDEX_GUID \
+  { \
+    0x9306ad59, 0x7d71, 0x4bc6, { 0x89, 0xc1, 0x08, 0x21, 0xc7, 0x18, 0x16, 0xf5 } \
+  }
+
+#define EDKII_HOB_LIST_INDEX_REVISION  1
+
+//
+// Hashes a GUID. The slot of a GUID in the GUID HOB table is the hash masked
+// with (GuidHobSlotCount - 1); collisions go to the next slot.
+//
+#define EDKII_HOB_LIST_INDEX_HASH_GUID(Guid) \
+  ((UINTN)(Guid)->Data1 ^ ((UINTN)(Guid)->Data2 << 16) ^ (Guid)->Data3 ^ \
+   ((UINTN)(Guid)->Data4[6] << 8) ^ (Guid)->Data4[7])
+
+typedef struct {
+  UINT32               Revision;
+  ///
+  /// Number of slots in the GUID HOB table, a power of two.
+  ///
+  UINT32               GuidHobSlotCount;
+  ///
+  /// The HOB list that is indexed.
+  ///
+  VOID                 *HobList;
+  ///
+  /// The first HOB of each type, or NULL.
+  ///
+  VOID                 *FirstHobOfType[EFI_HOB_TYPE_FV3 + 1];
+  ///
+  /// EFI_HOB_GUID_TYPE  *GuidHob[GuidHobSlotCount];
+  ///
+  /// The GUID HOB table, an open addressing hash table holding the first GUID
+  /// HOB of each GUID. Empty slots are NULL.
+  ///
+} EDKII_HOB_LIST_INDEX;
+
+//
+// Returns the GUID HOB table that follows an EDKII_HOB_LIST_INDEX.
+//
+#define EDKII_HOB_LIST_INDEX_GUID_HOBS(Index) \
+  ((EFI_HOB_GUID_TYPE **)((EDKII_HOB_LIST_INDEX *)(Index) + 1))
+
+extern EFI_GUID  gEdkiiHobListIndexGuid;
+
+#endif
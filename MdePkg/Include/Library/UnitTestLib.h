@@ -159,6 +159,31 @@ VOID
   VOID
   );
 
+/**
+  The prototype for a single UnitTest benchmark case function.
+
+  Functions with this prototype are registered with AddBenchmarkCase() and are
+  timed by the UnitTest framework.  The framework picks the number of
+  iterations so that one call lasts long enough to be measured with the
+  performance counter, then repeats the call to collect the min, median and
+  99th percentile time of a single iteration.
+
+  @param[in]  Context     [Optional] An optional parameter that enables
+                          benchmark-case reuse with varied parameters.  This
+                          parameter is a VOID* and it is the responsibility of
+                          the test author to ensure that the contents are well
+                          understood by all benchmark cases that may consume it.
+  @param[in]  Iterations  The number of times the function must run the
+                          operation being measured.
+
+**/
+typedef
+VOID
+(EFIAPI *UNIT_TEST_BENCHMARK_FUNCTION)(
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  );
+
 /**
   Method to Initialize the Unit Test framework.  This function registers the
   test name and also initializes the internal state of the test framework to
@@ -265,6 +290,70 @@ AddTestCase (
   IN UNIT_TEST_CONTEXT       Context       OPTIONAL
   );
 
+/**
+  Adds benchmark case to Suite
+
+  A benchmark case is run in sequence with the test cases of Suite.  It passes
+  unless its prerequisite fails or it triggers a test assertion, and its timing
+  statistics are reported through UnitTestResultReportLib and the test log.
+
+  @param[in]  SuiteHandle   Unit test suite to add benchmark to.
+  @param[in]  Description   Null-terminated ASCII string that is the user
+                            friendly description of a benchmark.  String is
+                            copied.
+  @param[in]  Name          Null-terminated ASCII string that is the short name
+                            of the benchmark with no spaces.  String is copied.
+  @param[in]  Function      Benchmark function.
+  @param[in]  Prerequisite  Prerequisite function, runs before benchmark.  This
+                            is an optional parameter that may be NULL.
+  @param[in]  CleanUp       Clean up function, runs after benchmark.  This is
+                            an optional parameter that may be NULL.
+  @param[in]  Context       Pointer to context.    This is an optional parameter
+                            that may be NULL.
+
+  @retval  EFI_SUCCESS            The benchmark case was added to Suite.
+  @retval  EFI_INVALID_PARAMETER  SuiteHandle is NULL.
+  @retval  EFI_INVALID_PARAMETER  Description is NULL.
+  @retval  EFI_INVALID_PARAMETER  Name is NULL.
+  @retval  EFI_INVALID_PARAMETER  Function is NULL.
+  @retval  EFI_UNSUPPORTED        PcdUnitTestBenchmarkEnable is FALSE, so there
+                                  is no performance counter to time the
+                                  benchmark with.
+  @retval  EFI_OUT_OF_RESOURCES   There are not enough resources available to
+                                  add the benchmark case to Suite.
+**/
+EFI_STATUS
+EFIAPI
+AddBenchmarkCase (
+  IN UNIT_TEST_SUITE_HANDLE        SuiteHandle,
+  IN CHAR8                         *Description,
+  IN CHAR8                         *Name,
+  IN UNIT_TEST_BENCHMARK_FUNCTION  Function,
+  IN UNIT_TEST_PREREQUISITE        Prerequisite  OPTIONAL,
+  IN UNIT_TEST_CLEANUP             CleanUp       OPTIONAL,
+  IN UNIT_TEST_CONTEXT             Context       OPTIONAL
+  );
+
+/**
+  This macro adds the benchmark function Function to the unit test suite
+  SuiteHandle, using the name of the function as description and name.
+
+  @param[in]  SuiteHandle  Unit test suite to add benchmark to.
+  @param[in]  Function     Benchmark function.
+  @param[in]  Context      Pointer to context, may be NULL.
+**/
+#define UT_ADD_BENCHMARK(SuiteHandle, Function, Context) \
+  AddBenchmarkCase ((SuiteHandle), #Function, #Function, (Function), NULL, NULL, (Context))
+
+/**
+  This macro consumes Value so that the compiler cannot discard the operation
+  that produced it from a benchmark loop.
+
+  @param[in]  Value  Integer or pointer result of the measured operation.
+**/
+#define UT_BENCHMARK_KEEP(Value) \
+  UnitTestBenchmarkKeep ((UINT64)(UINTN)(Value))
+
 /**
   Execute all unit test cases in all unit test suites added to a Framework.
 
@@ -824,6 +913,18 @@ UnitTestExpectAssertFailure (
 #define UT_LOG_VERBOSE(Format, ...)  \
   UnitTestLog (UNIT_TEST_LOG_LEVEL_VERBOSE, Format, ##__VA_ARGS__)
 
+/**
+  Sink for values produced in benchmark loops.  Use UT_BENCHMARK_KEEP() rather
+  than calling this function directly.
+
+  @param[in]  Value  Value to consume.
+**/
+VOID
+EFIAPI
+UnitTestBenchmarkKeep (
+  IN UINT64  Value
+  );
+
 /**
   Test logging function that records a messages in the test framework log.
   Record is associated with the currently executing test case.
@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <PiDxe.h>
 
 #include <Guid/HobList.h>
+#include <Guid/HobListIndex.h>
 
 #include <Library/HobLib.h>
 #include <Library/UefiLib.h>
@@ -17,6 +18,12 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 VOID  *mHobList = NULL;
 
+//
+// Index of the HOB list installed by the DXE Core, looked up by the library
+// constructor. Lookups walk the HOB list when there is no index.
+//
+STATIC EDKII_HOB_LIST_INDEX  *mHobListIndex = NULL;
+
 /**
   Returns the pointer to the HOB list.
 
@@ -53,8 +60,8 @@ GetHobList (
 }
 
 /**
-  The constructor function caches the pointer to HOB list by calling GetHobList()
-  and will always return EFI_SUCCESS.
+  The constructor function caches the pointer to HOB list by calling GetHobList(),
+  looks up the index of the HOB list, and will always return EFI_SUCCESS.
 
   @param  ImageHandle   The firmware allocated handle for the EFI image.
   @param  SystemTable   A pointer to the EFI System Table.
@@ -69,8 +76,19 @@ HobLibConstructor (
   IN EFI_SYSTEM_TABLE  *SystemTable
   )
 {
+  EFI_STATUS            Status;
+  EDKII_HOB_LIST_INDEX  *Index;
+
   GetHobList ();
 
+  Status = EfiGetSystemConfigurationTable (&gEdkiiHobListIndexGuid, (VOID **)&Index);
+  if (!EFI_ERROR (Status) && (Index != NULL) &&
+      (Index->Revision == EDKII_HOB_LIST_INDEX_REVISION) &&
+      (Index->HobList == mHobList))
+  {
+    mHobListIndex = Index;
+  }
+
   return EFI_SUCCESS;
 }
 
@@ -138,6 +156,11 @@ GetFirstHob (
 {
   VOID  *HobList;
 
+  if ((mHobListIndex != NULL) && (Type < ARRAY_SIZE (mHobListIndex->FirstHobOfType))) {
+    HobList = mHobListIndex->FirstHobOfType[Type];
+    return (HobList == NULL) ? NULL : GetNextHob (Type, HobList);
+  }
+
   HobList = GetHobList ();
   return GetNextHob (Type, HobList);
 }
@@ -209,7 +232,25 @@ GetFirstGuidHob (
   IN CONST EFI_GUID  *Guid
   )
 {
-  VOID  *HobList;
+  VOID               *HobList;
+  EFI_HOB_GUID_TYPE  **GuidHobs;
+  UINTN              Mask;
+  UINTN              Slot;
+
+  if (mHobListIndex != NULL) {
+    GuidHobs = EDKII_HOB_LIST_INDEX_GUID_HOBS (mHobListIndex);
+    Mask     = mHobListIndex->GuidHobSlotCount - 1;
+    Slot     = EDKII_HOB_LIST_INDEX_HASH_GUID (Guid) & Mask;
+    while (GuidHobs[Slot] != NULL) {
+      if (CompareGuid (&GuidHobs[Slot]->Name, Guid)) {
+        return GetNextGuidHob (Guid, GuidHobs[Slot]);
+      }
+
+      Slot = (Slot + 1) & Mask;
+    }
+
+    return NULL;
+  }
 
   HobList = GetHobList ();
   return GetNextGuidHob (Guid, HobList);
@@ -0,0 +1,762 @@
+/** @file
+  Benchmarks of the BaseMemoryLib, BaseLib string, SafeIntLib and
+  UefiDecompressLib APIs.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/SafeIntLib.h>
+#include <Library/UefiDecompressLib.h>
+#include <Library/UnitTestLib.h>
+
+#define UNIT_TEST_APP_NAME     "MdePkg Benchmark Application"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+#define BENCHMARK_BUFFER_SIZE  SIZE_4KB
+#define BENCHMARK_STRING_SIZE  256
+
+///
+/// 16KB of text, "Line %04d: The quick brown fox jumps over the lazy dog
+/// %08X.\n" for increasing line numbers and pseudo-random values, compressed
+/// with the UEFI compression algorithm.
+///
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT8  mCompressedText[] = {
+  0xc8, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x08, 0x5f, 0x7e, 0x96, 0xcd, 0x81, 0x2d, 0x4a,
+  0x5d, 0x8e, 0xf0, 0x03, 0xb9, 0x47, 0xd6, 0xcb, 0x2c, 0xb2, 0x98, 0x76, 0xdb, 0x66, 0x13, 0x88,
+  0xe4, 0xa0, 0x78, 0x0f, 0x2a, 0x9d, 0x51, 0x45, 0x03, 0x87, 0x19, 0xa1, 0xd3, 0xbf, 0xf0, 0x1f,
+  0xb2, 0x77, 0x00, 0x07, 0x73, 0xea, 0x94, 0x5f, 0xe7, 0xf9, 0xff, 0x0f, 0xcb, 0xe2, 0x8f, 0xf3,
+  0xf4, 0xfc, 0x7f, 0xa7, 0xef, 0xfc, 0xbe, 0x3f, 0xef, 0xf9, 0x7e, 0x7f, 0xaf, 0xfd, 0xfe, 0x3f,
+  0x57, 0xf1, 0xfb, 0x7f, 0xff, 0xf0, 0xf8, 0xfd, 0xbf, 0x6f, 0xe7, 0xf1, 0xfe, 0xdf, 0xcb, 0xfe,
+  0x7f, 0xeb, 0xff, 0x3e, 0x3e, 0xdf, 0xfd, 0xf9, 0x7f, 0x1f, 0x8f, 0xfd, 0x7f, 0xbd, 0xff, 0x1f,
+  0xeb, 0xfd, 0x7f, 0xa7, 0xc7, 0xec, 0xfb, 0x7e, 0xef, 0xed, 0xfa, 0x3f, 0x3f, 0x3f, 0x47, 0xf9,
+  0x7f, 0x8c, 0x05, 0x7e, 0xb0, 0x19, 0xf5, 0xb1, 0x8c, 0xee, 0xa3, 0x00, 0x5f, 0x58, 0x0b, 0x71,
+  0x3c, 0xd6, 0x42, 0x18, 0x0b, 0x7d, 0x60, 0x3b, 0xad, 0x22, 0x76, 0xb6, 0x18, 0x03, 0xfa, 0xc0,
+  0x61, 0x7b, 0xdf, 0x27, 0x0c, 0x60, 0x2f, 0xf5, 0x80, 0xae, 0x2b, 0x74, 0xa6, 0x2e, 0x30, 0x09,
+  0xf5, 0x80, 0xdd, 0xcf, 0x9d, 0xd1, 0x20, 0xc0, 0x63, 0xeb, 0x01, 0x7b, 0x29, 0xde, 0xdd, 0xc0,
+  0xc0, 0x2f, 0xd6, 0x01, 0xab, 0xbd, 0xf3, 0xaa, 0xa3, 0x01, 0x9f, 0xac, 0x02, 0xb3, 0x58, 0xf1,
+  0x6c, 0xfe, 0x30, 0x15, 0x81, 0x12, 0x5e, 0x2d, 0x72, 0x9e, 0xd0, 0xc0, 0x40, 0x89, 0xe7, 0x10,
+  0xad, 0xac, 0xec, 0x60, 0x20, 0x44, 0xa6, 0xb3, 0x9d, 0x99, 0xf0, 0x60, 0x20, 0x44, 0xd1, 0x7b,
+  0x52, 0xeb, 0x74, 0x60, 0x20, 0x44, 0xeb, 0x14, 0x5d, 0x63, 0x5e, 0x18, 0x08, 0x11, 0x27, 0x73,
+  0xa1, 0x56, 0xec, 0x30, 0x10, 0x22, 0x7e, 0xe7, 0x34, 0x20, 0x7d, 0x60, 0x44, 0xad, 0x74, 0xd5,
+  0x3e, 0x04, 0x0f, 0xac, 0x08, 0x9a, 0xb7, 0x91, 0x7d, 0x80, 0x81, 0xf5, 0x81, 0x13, 0xbf, 0x57,
+  0xd4, 0x52, 0x08, 0x1e, 0x50, 0x22, 0x6f, 0xcb, 0xdd, 0x6b, 0xd0, 0x81, 0xe5, 0x02, 0x25, 0xb4,
+  0xbc, 0x6d, 0xa8, 0x40, 0xf2, 0x81, 0x13, 0x95, 0xe1, 0xe2, 0xf6, 0x08, 0x1e, 0x50, 0x22, 0x6c,
+  0x8d, 0xbf, 0x7b, 0xc1, 0x03, 0xca, 0x04, 0x4f, 0x6f, 0x6b, 0x22, 0xe4, 0x20, 0x79, 0x40, 0x89,
+  0xc5, 0x93, 0x5e, 0x23, 0x08, 0x1e, 0x50, 0x22, 0x6b, 0x5d, 0x15, 0xf6, 0xc1, 0x03, 0xca, 0x04,
+  0x4e, 0x9b, 0xb9, 0xed, 0xf4, 0x10, 0x3c, 0xa0, 0x44, 0x9f, 0xab, 0x53, 0x6b, 0x84, 0x0f, 0x28,
+  0x11, 0x3e, 0xe1, 0xaf, 0x33, 0x40, 0x81, 0xf6, 0x81, 0x12, 0xba, 0x5a, 0x19, 0x6c, 0x20, 0x7d,
+  0xa0, 0x44, 0x92, 0xef, 0x1b, 0xe2, 0x04, 0x0f, 0xb4, 0x08, 0x9f, 0xbb, 0xce, 0x04, 0x0f, 0xb4,
+  0x08, 0x94, 0xb9, 0x23, 0xfa, 0x24, 0x20, 0x7d, 0xa0, 0x44, 0xd2, 0xd7, 0xf1, 0x65, 0x42, 0x07,
+  0xda, 0x04, 0x4e, 0xab, 0x9b, 0xea, 0xd6, 0x08, 0x1f, 0x68, 0x11, 0x36, 0x6e, 0x76, 0xbc, 0xf0,
+  0x40, 0xfb, 0x40, 0x89, 0xef, 0xa8, 0x79, 0x4c, 0x84, 0x0f, 0xb4, 0x08, 0x9c, 0x72, 0xdc, 0xad,
+  0x0c, 0x20, 0x7d, 0xa0, 0x44, 0xd7, 0x58, 0xb2, 0xe5, 0x82, 0x07, 0x9c, 0x08, 0x9d, 0xae, 0xb7,
+  0x4b, 0x68, 0x20, 0x79, 0xc0, 0x89, 0xba, 0x78, 0xb1, 0xdb, 0x84, 0x0f, 0x38, 0x11, 0x2d, 0x7a,
+  0xbf, 0xf8, 0x14, 0x08, 0x1e, 0x70, 0x22, 0x73, 0x6b, 0xd7, 0x14, 0xd8, 0x40, 0xf3, 0x81, 0x13,
+  0x6a, 0xaa, 0xfb, 0x48, 0x10, 0x3c, 0xe0, 0x44, 0xf1, 0xb9, 0x44, 0x3a, 0x84, 0x0f, 0x38, 0x11,
+  0x29, 0xd6, 0xc7, 0x7b, 0xc0, 0x81, 0xe7, 0x02, 0x26, 0x9c, 0x26, 0xbe, 0x30, 0x10, 0x3c, 0xe0,
+  0x44, 0xfd, 0xf9, 0xb5, 0x84, 0x0f, 0x38, 0x11, 0x26, 0xb9, 0xf1, 0xeb, 0xc1, 0x03, 0xef, 0x02,
+  0x27, 0xc9, 0xdb, 0xf0, 0xf2, 0x10, 0x3e, 0xf0, 0x22, 0x56, 0xf4, 0xed, 0xbc, 0x61, 0x03, 0xef,
+  0x02, 0x24, 0xac, 0x67, 0xbc, 0x30, 0x40, 0xfb, 0xc0, 0x89, 0xe5, 0x5c, 0xe8, 0x57, 0x41, 0x03,
+  0xef, 0x02, 0x26, 0xed, 0xbb, 0x6b, 0x77, 0x08, 0x1f, 0x78, 0x11, 0x2d, 0xdf, 0x6c, 0xaf, 0x40,
+  0x81, 0xf7, 0x81, 0x13, 0x9e, 0x11, 0x67, 0xdb, 0x08, 0x1f, 0x78, 0x11, 0x36, 0xd5, 0xf5, 0x55,
+  0x40, 0x81, 0xf7, 0x81, 0x13, 0xd5, 0xcd, 0x72, 0x55, 0x08, 0x1f, 0x78, 0x11, 0x38, 0x47, 0x79,
+  0xbd, 0xf0, 0x20, 0x7a, 0x40, 0x89, 0xad, 0xdf, 0xab, 0x35, 0xf0, 0x10, 0x3d, 0x20, 0x44, 0xee,
+  0xd6, 0xc3, 0x31, 0x04, 0x0f, 0x48, 0x11, 0x37, 0xaa, 0x33, 0xf6, 0xbd, 0x08, 0x1e, 0x90, 0x22,
+  0x7c, 0xda, 0x46, 0x25, 0x08, 0x1e, 0x90, 0x22, 0x7e, 0xfd, 0xce, 0x82, 0x07, 0xa4, 0x08, 0x92,
+  0xe5, 0x6f, 0xeb, 0xb0, 0x40, 0xf4, 0x81, 0x13, 0xcd, 0x1f, 0x6e, 0xda, 0x08, 0x1e, 0x90, 0x22,
+  0x51, 0x54, 0xfb, 0x9b, 0x84, 0x0f, 0x48, 0x11, 0x34, 0x4d, 0xf2, 0xf6, 0xa0, 0x40, 0xf4, 0x81,
+  0x13, 0xa3, 0x6b, 0x73, 0x9b, 0x08, 0x1f, 0x88, 0x11, 0x27, 0x62, 0xd9, 0xa2, 0x04, 0x0f, 0xc4,
+  0x08, 0x9f, 0x55, 0x0b, 0x8f, 0xd7, 0xac, 0x60, 0x20, 0x44, 0xe1, 0xb3, 0xab, 0x67, 0x81, 0x03,
+  0xf1, 0x02, 0x26, 0xbd, 0xed, 0x77, 0x6c, 0x04, 0x0f, 0xc4, 0x08, 0x9d, 0xf2, 0x99, 0x2e, 0x90,
+  0x40, 0xfc, 0x40, 0x89, 0xbe, 0x8e, 0x9a, 0x4e, 0x84, 0x0f, 0xc4, 0x08, 0x96, 0x5c, 0x29, 0x51,
+  0x42, 0x07, 0xe2, 0x04, 0x4e, 0x5f, 0x99, 0x4b, 0xf9, 0x18, 0x20, 0x7e, 0x20, 0x44, 0xd8, 0xfd,
+  0x8a, 0xdb, 0xc1, 0x03, 0xf1, 0x02, 0x27, 0xb6, 0xaf, 0x97, 0xb9, 0x08, 0x1e, 0xb0, 0x22, 0x7e,
+  0xf1, 0x84, 0x84, 0x0f, 0x58, 0x11, 0x34, 0x65, 0xea, 0xd6, 0x81, 0x03, 0xd6, 0x04, 0x4e, 0xbb,
+  0xc3, 0x6d, 0x6c, 0x20, 0x7a, 0xc0, 0x89, 0x3d, 0xb7, 0x30, 0x68, 0x10, 0x3d, 0x60, 0x44, 0xf9,
+  0xfa, 0x36, 0xfb, 0xd5, 0x08, 0x1e, 0xb0, 0x22, 0x55, 0x53, 0x69, 0x8e, 0x04, 0x0f, 0x58, 0x11,
+  0x2f, 0xd5, 0xc8, 0xbd, 0x5c, 0x04, 0x0f, 0x58, 0x11, 0x3c, 0x3e, 0xea, 0xfb, 0x20, 0x81, 0xeb,
+  0x02, 0x25, 0x2d, 0x57, 0x85, 0x07, 0xa1, 0x03, 0xd6, 0x04, 0x4b, 0xc6, 0x77, 0x93, 0xf2, 0x84,
+  0x0f, 0xcc, 0x08, 0x9c, 0xb2, 0xd3, 0x8b, 0x60, 0x81, 0xf9, 0x81, 0x13, 0x6e, 0xed, 0x4e, 0xbe,
+  0x08, 0x1f, 0x98, 0x11, 0x3d, 0xdf, 0x9b, 0x7b, 0xc8, 0x40, 0xfc, 0xc0, 0x89, 0xc6, 0x8b, 0x16,
+  0xb9, 0x84, 0x0f, 0xcc, 0x08, 0x9a, 0xad, 0xfd, 0xaf, 0x30, 0x40, 0xfc, 0xc0, 0x89, 0xda, 0x65,
+  0x09, 0x74, 0x10, 0x3f, 0x30, 0x22, 0x7e, 0xf3, 0x6c, 0x04, 0x0f, 0xcc, 0x08, 0x96, 0xb3, 0xf3,
+  0xe0, 0xe5, 0x42, 0x07, 0xe6, 0x04, 0x4e, 0x6b, 0x6e, 0x66, 0xfc, 0x08, 0x1f, 0x98, 0x11, 0x24,
+  0xd8, 0x3a, 0x36, 0x3f, 0x08, 0x1f, 0x59, 0xa5, 0x8d, 0xfc, 0x03, 0xb5, 0xc9, 0x18, 0xc0, 0x40,
+  0x89, 0x4d, 0xfa, 0xd4, 0x2e, 0xdc, 0x60, 0x20, 0x44, 0xd3, 0x4f, 0x00, 0x07, 0x15, 0x06, 0x02,
+  0x04, 0x4e, 0x96, 0xf5, 0x64, 0xb6, 0x06, 0x02, 0x04, 0x49, 0xbc, 0x89, 0x88, 0xde, 0x51, 0x80,
+  0x81, 0x13, 0xe3, 0x7a, 0x07, 0x33, 0x9c, 0x8c, 0x04, 0x08, 0x95, 0x26, 0x54, 0xb1, 0xe8, 0x60,
+  0x20, 0x44, 0x95, 0x49, 0xba, 0xf2, 0xeb, 0x8c, 0x04, 0x08, 0x9d, 0xb2, 0x62, 0xe9, 0xae, 0x0c,
+  0x04, 0x08, 0x9b, 0xf7, 0x3e, 0xed, 0x2f, 0xf8, 0x40, 0xfa, 0xcd, 0x2c, 0x6d, 0xbe, 0xa1, 0xea,
+  0x9e, 0x18, 0x09, 0xaf, 0xb7, 0x54, 0xef, 0x2d, 0xb6, 0x18, 0x09, 0xaf, 0xb7, 0xfb, 0xd5, 0x4f,
+  0x41, 0x80, 0x9a, 0xfb, 0x5d, 0xc6, 0x37, 0x82, 0xa8, 0xc0, 0x4d, 0x7d, 0xa7, 0xb3, 0xb5, 0x3a,
+  0x43, 0x01, 0x35, 0xf6, 0x97, 0xb7, 0xad, 0x28, 0x40, 0xf9, 0xa5, 0x8f, 0x75, 0x2b, 0x11, 0xd8,
+  0x20, 0x7c, 0xd2, 0xc6, 0xf3, 0x4a, 0x6b, 0x3d, 0xf0, 0x40, 0xf9, 0xa5, 0x8f, 0xdd, 0x7e, 0xe7,
+  0x38, 0xc8, 0x40, 0xf9, 0xa5, 0x8d, 0x77, 0xcc, 0xe6, 0xa6, 0x10, 0x3e, 0x69, 0x63, 0x2d, 0x38,
+  0xfe, 0xd3, 0x04, 0x0f, 0x9a, 0x58, 0xdd, 0xf6, 0x9f, 0xad, 0xbe, 0x82, 0x07, 0xcd, 0x2c, 0x6f,
+  0xd4, 0xb9, 0x9b, 0xd7, 0x08, 0x1f, 0x34, 0xb1, 0xd0, 0xf5, 0x8c, 0x2d, 0x02, 0x07, 0xcd, 0x2c,
+  0x7a, 0x2e, 0xf9, 0xed, 0x77, 0x08, 0x1f, 0x34, 0xb1, 0x9b, 0x87, 0xa7, 0xe4, 0x52, 0x10, 0x3e,
+  0x69, 0x63, 0xeb, 0x1b, 0x84, 0x6a, 0x84, 0x0f, 0x9a, 0x58, 0xf1, 0xd5, 0xbd, 0xfd, 0xc0, 0x81,
+  0xf3, 0x4b, 0x1f, 0xde, 0xe7, 0x60, 0x81, 0xf3, 0x4b, 0x1e, 0xf2, 0xc7, 0x72, 0xb0, 0x40, 0xf9,
+  0xa5, 0x8e, 0xea, 0x4f, 0x10, 0x27, 0x82, 0x07, 0xcd, 0x2c, 0x6c, 0x8e, 0xca, 0xd7, 0xc8, 0x40,
+  0xf9, 0xa5, 0x8f, 0x27, 0x9d, 0x6d, 0x8c, 0x20, 0x7c, 0xd2, 0xc7, 0x67, 0xed, 0xef, 0x65, 0x60,
+  0x81, 0xf3, 0x4b, 0x1f, 0x5d, 0xa2, 0xb6, 0x5a, 0x08, 0x1f, 0x34, 0xb1, 0xa3, 0x1d, 0x4b, 0x97,
+  0x08, 0x1f, 0x34, 0xb1, 0xd3, 0xb8, 0x5d, 0x25, 0x02, 0x07, 0xcd, 0x2c, 0x7a, 0xde, 0xe9, 0x56,
+  0xd8, 0x40, 0xf9, 0xa5, 0x8c, 0xf3, 0xec, 0x65, 0xfb, 0xc0, 0x8c, 0x04, 0xd7, 0xda, 0xb5, 0x67,
+  0x07, 0x81, 0x03, 0xe6, 0x96, 0x35, 0x4b, 0xa2, 0xf3, 0x81, 0x03, 0xe6, 0x96, 0x32, 0x35, 0xf3,
+  0xc5, 0xfc, 0x10, 0x3e, 0x69, 0x63, 0xe3, 0xfb, 0x0d, 0x68, 0x41, 0x03, 0xe6, 0x96, 0x34, 0xa3,
+  0x71, 0xb3, 0xd0, 0x81, 0xf3, 0x4b, 0x1b, 0x35, 0x8f, 0x16, 0xc8, 0x40, 0xf9, 0xa5, 0x8f, 0x3d,
+  0x7e, 0x65, 0xbd, 0x30, 0x81, 0xf3, 0x4b, 0x1d, 0xb7, 0xab, 0x3b, 0x0d, 0x04, 0x0f, 0x9a, 0x58,
+  0xde, 0xe7, 0x5d, 0x7a, 0x9a, 0x08, 0x1f, 0x34, 0xb1, 0xe1, 0x5d, 0x82, 0x75, 0x70, 0x81, 0xf3,
+  0x4b, 0x1d, 0x50, 0xf3, 0xd3, 0xa0, 0x40, 0xf9, 0xa5, 0x8f, 0x66, 0xb5, 0x3e, 0xec, 0x20, 0x7c,
+  0xd2, 0xc7, 0x72, 0xda, 0xf3, 0x08, 0x10, 0x3e, 0x69, 0x63, 0x6a, 0x33, 0xd8, 0xc5, 0x50, 0x81,
+  0xf3, 0x4b, 0x1a, 0xb1, 0x63, 0x7a, 0xe0, 0x40, 0xf9, 0xa5, 0x8d, 0xfa, 0xb7, 0xfc, 0x88, 0xb0,
+  0x81, 0xf3, 0x4b, 0x1f, 0x36, 0xe8, 0x9b, 0xe2, 0x08, 0x1f, 0x34, 0xb1, 0xa6, 0x79, 0xf3, 0x69,
+  0x98, 0x40, 0xf9, 0xa5, 0x8d, 0xe3, 0xbd, 0xf9, 0xa5, 0x90, 0x20, 0x7c, 0xd2, 0xc7, 0xa4, 0xb7,
+  0xcc, 0xb2, 0xa1, 0x03, 0xe6, 0x96, 0x33, 0x3c, 0x7c, 0xc3, 0x8c, 0x10, 0x3e, 0x69, 0x63, 0xf1,
+  0x69, 0xfa, 0xfb, 0xe8, 0x20, 0x7c, 0xd2, 0xc6, 0xb4, 0xf3, 0xf2, 0x28, 0xb8, 0x40, 0xf9, 0xa5,
+  0x8d, 0xd7, 0x53, 0x74, 0x2a, 0x04, 0x0f, 0x9a, 0x58, 0xf7, 0xdb, 0xb8, 0x8a, 0xd8, 0x40, 0xf9,
+  0xa5, 0x8e, 0xef, 0x01, 0xeb, 0x5d, 0x02, 0x07, 0xcd, 0x2c, 0x6d, 0x9e, 0x3d, 0x45, 0x15, 0x08,
+  0x1f, 0x34, 0xb1, 0xe7, 0x0c, 0xbe, 0x5e, 0x04, 0x0f, 0x9a, 0x58, 0xec, 0x96, 0x7a, 0xb7, 0x30,
+  0x10, 0x3e, 0x69, 0x63, 0xe9, 0xbb, 0x6b, 0xf0, 0x82, 0x07, 0xcd, 0x2c, 0x78, 0x27, 0xf2, 0x1b,
+  0xf7, 0x40, 0xfc, 0x60, 0x26, 0x96, 0x3a, 0xd3, 0xa9, 0xc6, 0x50, 0x81, 0xf3, 0x4b, 0x1e, 0x9a,
+  0x9e, 0x3c, 0xd8, 0x20, 0x7c, 0xd2, 0xc6, 0x7d, 0x37, 0x8b, 0x1f, 0xc1, 0x03, 0xe6, 0x96, 0x3f,
+  0x6f, 0x1d, 0x78, 0xc3, 0x02, 0x07, 0xcd, 0x2c, 0x6b, 0x9d, 0x9e, 0xd0, 0xc2, 0x07, 0xcd, 0x2c,
+  0x65, 0x8f, 0x70, 0x99, 0x82, 0x07, 0xcd, 0x2c, 0x7c, 0x42, 0xb6, 0xb3, 0xb0, 0x81, 0xf3, 0x4b,
+  0x1a, 0x1b, 0xcd, 0xaf, 0x64, 0x08, 0x1f, 0x34, 0xb1, 0xd0, 0xb2, 0x59, 0xed, 0x42, 0x07, 0xcd,
+  0x2c, 0x7a, 0xa7, 0x35, 0x54, 0xe0, 0x40, 0xf9, 0xa5, 0x8e, 0xcd, 0x4a, 0xe5, 0xeb, 0x1f, 0x18,
+  0x08, 0x11, 0x3d, 0xeb, 0xf1, 0x61, 0xd1, 0x04, 0x0f, 0x9a, 0x58, 0xf1, 0xbc, 0x3d, 0x2a, 0xdd,
+  0x08, 0x1f, 0x34, 0xb1, 0xd7, 0x3a, 0xc3, 0x75, 0x42, 0x07, 0xcd, 0x2c, 0x6e, 0x32, 0x5b, 0x18,
+  0xb0, 0x40, 0xf9, 0xa5, 0x8e, 0xe8, 0xea, 0x24, 0xf2, 0x28, 0x8c, 0x04, 0xd7, 0xda, 0x67, 0xe4,
+  0xd6, 0x42, 0x07, 0xcd, 0x2c, 0x79, 0x27, 0x9e, 0x74, 0xcc, 0x20, 0x7c, 0xd2, 0xc7, 0x6a, 0x3b,
+  0x2d, 0x75, 0x82, 0x07, 0xcd, 0x2c, 0x7c, 0xf3, 0xf7, 0xff, 0xc6, 0x82, 0x07, 0xcd, 0x2c, 0x69,
+  0xd7, 0xe8, 0x60, 0xf7, 0xdf, 0x8c, 0x04, 0xd7, 0xdb, 0xb4, 0xb7, 0x37, 0x40, 0x81, 0xf3, 0x4b,
+  0x1e, 0xb2, 0xe9, 0x24, 0xf3, 0x0d, 0x0c, 0x04, 0xd7, 0xdb, 0x8e, 0x96, 0xde, 0xd3, 0x51, 0x80,
+  0x9a, 0xfb, 0x51, 0xf9, 0xf5, 0xa9, 0x04, 0x0f, 0x9a, 0x58, 0xd4, 0xce, 0xbb, 0xaf, 0x42, 0x07,
+  0xcd, 0x2c, 0x64, 0x58, 0xcb, 0xf3, 0x6f, 0x08, 0x1f, 0x34, 0xb1, 0xf2, 0x9b, 0xa6, 0xaf, 0x60,
+  0x81, 0xf3, 0x4b, 0x1d, 0xfc, 0xfd, 0xbf, 0x3d, 0xe0, 0x81, 0xf3, 0x4b, 0x1b, 0x76, 0xad, 0x95,
+  0xcf, 0xe1, 0x03, 0xca, 0x69, 0x63, 0xce, 0xef, 0x87, 0x8e, 0x01, 0x46, 0x02, 0x6b, 0xed, 0xcb,
+  0xf0, 0xe1, 0xdb, 0x64, 0x60, 0x26, 0xbe, 0xdc, 0x71, 0x1f, 0x9b, 0x76, 0x86, 0x02, 0x6b, 0xed,
+  0xbb, 0x77, 0x0d, 0x7d, 0x8c, 0x04, 0xd7, 0xda, 0xf3, 0x29, 0xb6, 0x69, 0xc1, 0x80, 0x9a, 0xfb,
+  0x49, 0x39, 0x82, 0xdf, 0x46, 0x02, 0x6b, 0xed, 0x72, 0x15, 0xee, 0x27, 0x86, 0x02, 0x04, 0x4f,
+  0xbc, 0xfd, 0x9d, 0x52, 0xac, 0x30, 0x10, 0x22, 0x55, 0xde, 0x67, 0xad, 0xda, 0x0c, 0x04, 0xd7,
+  0xdb, 0xb3, 0xd5, 0xf2, 0xbf, 0x84, 0x0f, 0x29, 0xa5, 0x8f, 0x8f, 0xfb, 0x9d, 0xb5, 0x88, 0x60,
+  0x26, 0xbe, 0xdc, 0x6f, 0x27, 0xcf, 0x58, 0x60, 0x26, 0xbe, 0xdb, 0xb5, 0x38, 0x99, 0x31, 0x80,
+  0x9a, 0xfb, 0x4c, 0x94, 0xe8, 0x77, 0x18, 0x09, 0xaf, 0xb4, 0xae, 0xf1, 0xc5, 0x32, 0x0c, 0x04,
+  0xd7, 0xda, 0xf7, 0x13, 0xda, 0xda, 0x08, 0x1f, 0x34, 0xb1, 0xbf, 0x26, 0x7f, 0x6b, 0xb7, 0x08,
+  0x1f, 0x34, 0xb1, 0xd7, 0xbf, 0x3d, 0x2c, 0x28, 0x10, 0x3e, 0x69, 0x63, 0x7e, 0xbe, 0x3d, 0xd5,
+  0x36, 0x10, 0x3e, 0x69, 0x63, 0xbe, 0x71, 0x7a, 0xe9, 0x02, 0x07, 0xcd, 0x2c, 0x6d, 0x87, 0x83,
+  0xfc, 0xea, 0x10, 0x3e, 0x69, 0x63, 0xcb, 0xf0, 0x9f, 0x7a, 0xfb, 0xc2, 0x07, 0xcd, 0x2c, 0x76,
+  0x76, 0xd9, 0x5c, 0x60, 0x20, 0x7c, 0xd2, 0xc7, 0xd2, 0xbd, 0x9e, 0x81, 0x30, 0x81, 0xf3, 0x4b,
+  0x1b, 0xf2, 0xa7, 0xd6, 0x1e, 0x38, 0xe1, 0x80, 0x81, 0x13, 0x4f, 0x72, 0xac, 0x79, 0x08, 0x1f,
+  0x34, 0xb1, 0xe9, 0xe5, 0x10, 0x4f, 0x18, 0x40, 0xf9, 0xa5, 0x8c, 0xf7, 0x6a, 0x7b, 0x0c, 0x10,
+  0x3e, 0x69, 0x63, 0xf6, 0x51, 0x52, 0xba, 0x08, 0x1f, 0x34, 0xb1, 0xae, 0x32, 0xdd, 0xdd, 0xc2,
+  0x07, 0xcd, 0x2c, 0x65, 0x7e, 0xe2, 0xf7, 0xa0, 0x40, 0xf9, 0xa5, 0x8f, 0x86, 0xfe, 0x87, 0x7e,
+  0xd7, 0xc3, 0x01, 0x35, 0xf6, 0x91, 0xa1, 0xaa, 0x04, 0x0f, 0x9a, 0x58, 0xe9, 0x4f, 0x98, 0x1f,
+  0xea, 0x10, 0x3e, 0x69, 0x63, 0xcf, 0xb7, 0x7b, 0x6f, 0x81, 0x03, 0xe6, 0x96, 0x3b, 0x73, 0xdc,
+  0x7e, 0x1c, 0xa1, 0x03, 0xe6, 0x96, 0x3e, 0xec, 0x8c, 0x98, 0x82, 0x07, 0xcd, 0x2c, 0x78, 0xcd,
+  0xf7, 0xa5, 0xe8, 0x40, 0xf9, 0xa5, 0x8d, 0xfb, 0x95, 0xd9, 0xc5, 0xf0, 0x40, 0xf9, 0xa5, 0x8f,
+  0x77, 0xe6, 0xb3, 0xcb, 0x04, 0x0f, 0x9a, 0x58, 0xee, 0x7f, 0x2d, 0x18, 0xc1, 0x03, 0xe6, 0x96,
+  0x36, 0x7f, 0xec, 0xd5, 0xb4, 0x10, 0x3e, 0x69, 0x63, 0x7e, 0xf7, 0x2f, 0x5b, 0x6d, 0xc2, 0x07,
+  0xcd, 0x2c, 0x65, 0xed, 0x2a, 0xda, 0x81, 0x03, 0xe6, 0x96, 0x3e, 0x73, 0xac, 0xdc, 0xd8, 0x40,
+  0xf9, 0xa5, 0x8d, 0x36, 0xf0, 0xbb, 0x22, 0x04, 0x0f, 0x9a, 0x58, 0xe9, 0xf3, 0x30, 0x9b, 0xc7,
+  0x86, 0x30, 0x13, 0x5f, 0x6e, 0x15, 0x1e, 0x71, 0xe0, 0x81, 0xf3, 0x4b, 0x1b, 0xc4, 0x0b, 0xdf,
+  0x5b, 0x01, 0x03, 0xe6, 0x96, 0x3f, 0x5b, 0xe6, 0x44, 0xe2, 0x08, 0x1f, 0x34, 0xb1, 0xbf, 0x63,
+  0x2e, 0x75, 0x3a, 0x10, 0x3e, 0x69, 0x63, 0x7e, 0x73, 0xa7, 0x7a, 0x2f, 0xdd, 0x03, 0xc0, 0x00
+};
+
+#define COMPRESSED_TEXT_SIZE   SIZE_16KB
+#define COMPRESSED_TEXT_CRC32  0x87533FB4
+
+typedef struct {
+  VOID      *Destination;
+  VOID      *Scratch;
+  UINT32    DestinationSize;
+} DECOMPRESS_CONTEXT;
+
+STATIC UINT8  mSource[BENCHMARK_BUFFER_SIZE];
+STATIC UINT8  mDestination[BENCHMARK_BUFFER_SIZE];
+
+STATIC CHAR8   mAsciiString[BENCHMARK_STRING_SIZE];
+STATIC CHAR8   mAsciiStringCopy[BENCHMARK_STRING_SIZE];
+STATIC CHAR16  mUnicodeString[BENCHMARK_STRING_SIZE];
+STATIC CHAR16  mUnicodeStringCopy[BENCHMARK_STRING_SIZE];
+
+STATIC DECOMPRESS_CONTEXT  mDecompressContext;
+
+/**
+  Fill the source buffers and strings of the benchmarks.
+**/
+VOID
+EFIAPI
+BenchmarkSuiteSetup (
+  VOID
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < BENCHMARK_BUFFER_SIZE; Index++) {
+    mSource[Index] = (UINT8)(Index * 7);
+  }
+
+  for (Index = 0; Index < BENCHMARK_STRING_SIZE - 1; Index++) {
+    mAsciiString[Index]   = (CHAR8)('a' + Index % 26);
+    mUnicodeString[Index] = (CHAR16)('a' + Index % 26);
+  }
+
+  mAsciiString[Index]   = '\0';
+  mUnicodeString[Index] = L'\0';
+  StrCpyS (mUnicodeStringCopy, BENCHMARK_STRING_SIZE, mUnicodeString);
+}
+
+/**
+  Copy a 4KB buffer with CopyMem().
+
+  @param[in]  Context     Not used.
+  @param[in]  Iterations  The number of copies.
+**/
+VOID
+EFIAPI
+CopyMem4KB (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < Iterations; Index++) {
+    CopyMem (mDestination, mSource, BENCHMARK_BUFFER_SIZE);
+  }
+}
+
+/**
+  Copy 64 bytes at unaligned addresses with CopyMem().
+
+  @param[in]  Context     Not used.
+  @param[in]  Iterations  The number of copies.
+**/
+VOID
+EFIAPI
+CopyMem64Unaligned (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < Iterations; Index++) {
+    CopyMem (mDestination + 3, mSource + 1, 64);
+  }
+}
+
+/**
+  Fill a 4KB buffer with SetMem().
+
+  @param[in]  Context     Not used.
+  @param[in]  Iterations  The number of fills.
+**/
+VOID
+EFIAPI
+SetMem4KB (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < Iterations; Index++) {
+    SetMem (mDestination, BENCHMARK_BUFFER_SIZE, (UINT8)Index);
+  }
+}
+
+/**
+  Clear a 4KB buffer with ZeroMem().
+
+  @param[in]  Context     Not used.
+  @param[in]  Iterations  The number of clears.
+**/
+VOID
+EFIAPI
+ZeroMem4KB (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < Iterations; Index++) {
+    ZeroMem (mDestination, BENCHMARK_BUFFER_SIZE);
+  }
+}
+
+/**
+  Compare two equal 4KB buffers with CompareMem().
+
+  @param[in]  Context     Not used.
+  @param[in]  Iterations  The number of comparisons.
+**/
+VOID
+EFIAPI
+CompareMem4KB (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  UINTN  Index;
+  INTN   Sum;
+
+  CopyMem (mDestination, mSource, BENCHMARK_BUFFER_SIZE);
+  Sum = 0;
+  for (Index = 0; Index < Iterations; Index++) {
+    Sum += CompareMem (mDestination, mSource, BENCHMARK_BUFFER_SIZE);
+  }
+
+  UT_BENCHMARK_KEEP (Sum);
+}
+
+/**
+  Compute the CRC32 of a 4KB buffer with CalculateCrc32().
+
+  @param[in]  Context     Not used.
+  @param[in]  Iterations  The number of CRCs.
+**/
+VOID
+EFIAPI
+CalculateCrc32Of4KB (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  UINTN   Index;
+  UINT32  Crc;
+
+  Crc = 0;
+  for (Index = 0; Index < Iterations; Index++) {
+    Crc ^= CalculateCrc32 (mSource, BENCHMARK_BUFFER_SIZE);
+  }
+
+  UT_BENCHMARK_KEEP (Crc);
+}
+
+/**
+  Measure a 255 character string with AsciiStrLen().
+
+  @param[in]  Context     Not used.
+  @param[in]  Iterations  The number of measures.
+**/
+VOID
+EFIAPI
+AsciiStrLen255 (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  UINTN  Index;
+  UINTN  Length;
+
+  Length = 0;
+  for (Index = 0; Index < Iterations; Index++) {
+    Length += AsciiStrLen (mAsciiString);
+  }
+
+  UT_BENCHMARK_KEEP (Length);
+}
+
+/**
+  Measure a 255 character string with StrLen().
+
+  @param[in]  Context     Not used.
+  @param[in]  Iterations  The number of measures.
+**/
+VOID
+EFIAPI
+StrLen255 (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  UINTN  Index;
+  UINTN  Length;
+
+  Length = 0;
+  for (Index = 0; Index < Iterations; Index++) {
+    Length += StrLen (mUnicodeString);
+  }
+
+  UT_BENCHMARK_KEEP (Length);
+}
+
+/**
+  Copy a 255 character string with AsciiStrCpyS().
+
+  @param[in]  Context     Not used.
+  @param[in]  Iterations  The number of copies.
+**/
+VOID
+EFIAPI
+AsciiStrCpyS255 (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < Iterations; Index++) {
+    AsciiStrCpyS (mAsciiStringCopy, BENCHMARK_STRING_SIZE, mAsciiString);
+  }
+}
+
+/**
+  Compare two equal 255 character strings with StrCmp().
+
+  @param[in]  Context     Not used.
+  @param[in]  Iterations  The number of comparisons.
+**/
+VOID
+EFIAPI
+StrCmp255 (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  UINTN  Index;
+  INTN   Sum;
+
+  Sum = 0;
+  for (Index = 0; Index < Iterations; Index++) {
+    Sum += StrCmp (mUnicodeString, mUnicodeStringCopy);
+  }
+
+  UT_BENCHMARK_KEEP (Sum);
+}
+
+/**
+  Convert a 20 digit decimal string with AsciiStrDecimalToUint64().
+
+  @param[in]  Context     Not used.
+  @param[in]  Iterations  The number of conversions.
+**/
+VOID
+EFIAPI
+AsciiStrDecimalToUint64Max (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  UINTN   Index;
+  UINT64  Sum;
+
+  Sum = 0;
+  for (Index = 0; Index < Iterations; Index++) {
+    Sum += AsciiStrDecimalToUint64 ("18446744073709551615");
+  }
+
+  UT_BENCHMARK_KEEP (Sum);
+}
+
+/**
+  Multiply with SafeUint64Mult().
+
+  @param[in]  Context     Not used.
+  @param[in]  Iterations  The number of multiplications.
+**/
+VOID
+EFIAPI
+SafeUint64MultLoop (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  UINTN   Index;
+  UINT64  Result;
+  UINT64  Sum;
+
+  Sum = 0;
+  for (Index = 0; Index < Iterations; Index++) {
+    SafeUint64Mult (Index, 0x100000001ULL, &Result);
+    Sum += Result;
+  }
+
+  UT_BENCHMARK_KEEP (Sum);
+}
+
+/**
+  Add with SafeUintnAdd().
+
+  @param[in]  Context     Not used.
+  @param[in]  Iterations  The number of additions.
+**/
+VOID
+EFIAPI
+SafeUintnAddLoop (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  UINTN  Index;
+  UINTN  Result;
+  UINTN  Sum;
+
+  Sum = 0;
+  for (Index = 0; Index < Iterations; Index++) {
+    SafeUintnAdd (Index, MAX_UINTN / 2, &Result);
+    Sum += Result;
+  }
+
+  UT_BENCHMARK_KEEP (Sum);
+}
+
+/**
+  Convert with SafeInt64ToUint32().
+
+  @param[in]  Context     Not used.
+  @param[in]  Iterations  The number of conversions.
+**/
+VOID
+EFIAPI
+SafeInt64ToUint32Loop (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  UINTN   Index;
+  UINT32  Result;
+  UINT32  Sum;
+
+  Sum = 0;
+  for (Index = 0; Index < Iterations; Index++) {
+    SafeInt64ToUint32 ((INT64)Index, &Result);
+    Sum += Result;
+  }
+
+  UT_BENCHMARK_KEEP (Sum);
+}
+
+/**
+  Allocate the buffers of the decompression benchmark and check that the
+  compressed text decompresses correctly.
+
+  @param[in]  Context  The DECOMPRESS_CONTEXT of the benchmark.
+
+  @retval  UNIT_TEST_PASSED                      The buffers are ready.
+  @retval  UNIT_TEST_ERROR_PREREQUISITE_NOT_MET  The text does not decompress.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+DecompressPrerequisite (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  DECOMPRESS_CONTEXT  *Decompress;
+  UINT32              ScratchSize;
+
+  Decompress = (DECOMPRESS_CONTEXT *)Context;
+  if (RETURN_ERROR (UefiDecompressGetInfo (mCompressedText, sizeof (mCompressedText), &Decompress->DestinationSize, &ScratchSize))) {
+    return UNIT_TEST_ERROR_PREREQUISITE_NOT_MET;
+  }
+
+  if (Decompress->DestinationSize != COMPRESSED_TEXT_SIZE) {
+    return UNIT_TEST_ERROR_PREREQUISITE_NOT_MET;
+  }
+
+  Decompress->Destination = AllocatePool (Decompress->DestinationSize);
+  Decompress->Scratch     = AllocatePool (ScratchSize);
+  if ((Decompress->Destination == NULL) || (Decompress->Scratch == NULL)) {
+    return UNIT_TEST_ERROR_PREREQUISITE_NOT_MET;
+  }
+
+  if (RETURN_ERROR (UefiDecompress (mCompressedText, Decompress->Destination, Decompress->Scratch))) {
+    return UNIT_TEST_ERROR_PREREQUISITE_NOT_MET;
+  }
+
+  if (CalculateCrc32 (Decompress->Destination, Decompress->DestinationSize) != COMPRESSED_TEXT_CRC32) {
+    return UNIT_TEST_ERROR_PREREQUISITE_NOT_MET;
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Free the buffers of the decompression benchmark.
+
+  @param[in]  Context  The DECOMPRESS_CONTEXT of the benchmark.
+**/
+VOID
+EFIAPI
+DecompressCleanUp (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  DECOMPRESS_CONTEXT  *Decompress;
+
+  Decompress = (DECOMPRESS_CONTEXT *)Context;
+  if (Decompress->Destination != NULL) {
+    FreePool (Decompress->Destination);
+    Decompress->Destination = NULL;
+  }
+
+  if (Decompress->Scratch != NULL) {
+    FreePool (Decompress->Scratch);
+    Decompress->Scratch = NULL;
+  }
+}
+
+/**
+  Decompress 16KB of text with UefiDecompress().
+
+  @param[in]  Context     The DECOMPRESS_CONTEXT of the benchmark.
+  @param[in]  Iterations  The number of decompressions.
+**/
+VOID
+EFIAPI
+UefiDecompress16KB (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  DECOMPRESS_CONTEXT  *Decompress;
+  UINTN               Index;
+
+  Decompress = (DECOMPRESS_CONTEXT *)Context;
+  for (Index = 0; Index < Iterations; Index++) {
+    UefiDecompress (mCompressedText, Decompress->Destination, Decompress->Scratch);
+  }
+}
+
+/**
+  Initialize the unit test framework, suite, and benchmarks for the MdePkg
+  libraries and run the benchmarks.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Fw;
+  UNIT_TEST_SUITE_HANDLE      MemoryBenchmarks;
+  UNIT_TEST_SUITE_HANDLE      StringBenchmarks;
+  UNIT_TEST_SUITE_HANDLE      SafeIntBenchmarks;
+  UNIT_TEST_SUITE_HANDLE      DecompressBenchmarks;
+
+  Fw = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  //
+  // Start setting up the test framework for running the tests.
+  //
+  Status = InitUnitTestFramework (&Fw, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  //
+  // Populate the BaseMemoryLib Benchmark Suite.
+  //
+  Status = CreateUnitTestSuite (&MemoryBenchmarks, Fw, "BaseMemoryLib benchmarks", "BaseMemoryLib.Benchmark", BenchmarkSuiteSetup, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for MemoryBenchmarks\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  UT_ADD_BENCHMARK (MemoryBenchmarks, CopyMem4KB, NULL);
+  UT_ADD_BENCHMARK (MemoryBenchmarks, CopyMem64Unaligned, NULL);
+  UT_ADD_BENCHMARK (MemoryBenchmarks, SetMem4KB, NULL);
+  UT_ADD_BENCHMARK (MemoryBenchmarks, ZeroMem4KB, NULL);
+  UT_ADD_BENCHMARK (MemoryBenchmarks, CompareMem4KB, NULL);
+
+  //
+  // Populate the BaseLib String Benchmark Suite.
+  //
+  Status = CreateUnitTestSuite (&StringBenchmarks, Fw, "BaseLib string benchmarks", "BaseLib.String.Benchmark", BenchmarkSuiteSetup, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for StringBenchmarks\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  UT_ADD_BENCHMARK (StringBenchmarks, AsciiStrLen255, NULL);
+  UT_ADD_BENCHMARK (StringBenchmarks, StrLen255, NULL);
+  UT_ADD_BENCHMARK (StringBenchmarks, AsciiStrCpyS255, NULL);
+  UT_ADD_BENCHMARK (StringBenchmarks, StrCmp255, NULL);
+  UT_ADD_BENCHMARK (StringBenchmarks, AsciiStrDecimalToUint64Max, NULL);
+  UT_ADD_BENCHMARK (StringBenchmarks, CalculateCrc32Of4KB, NULL);
+
+  //
+  // Populate the SafeIntLib Benchmark Suite.
+  //
+  Status = CreateUnitTestSuite (&SafeIntBenchmarks, Fw, "SafeIntLib benchmarks", "SafeIntLib.Benchmark", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for SafeIntBenchmarks\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  UT_ADD_BENCHMARK (SafeIntBenchmarks, SafeUint64MultLoop, NULL);
+  UT_ADD_BENCHMARK (SafeIntBenchmarks, SafeUintnAddLoop, NULL);
+  UT_ADD_BENCHMARK (SafeIntBenchmarks, SafeInt64ToUint32Loop, NULL);
+
+  //
+  // Populate the UefiDecompressLib Benchmark Suite.
+  //
+  Status = CreateUnitTestSuite (&DecompressBenchmarks, Fw, "UefiDecompressLib benchmarks", "UefiDecompressLib.Benchmark", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for DecompressBenchmarks\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  // -------------------Suite-----------------Description-------------------------Class Name-----------Function------------Pre---------------------Post---------------Context-----------
+  AddBenchmarkCase (DecompressBenchmarks, "UefiDecompress() of 16KB of text", "UefiDecompress16KB", UefiDecompress16KB, DecompressPrerequisite, DecompressCleanUp, &mDecompressContext);
+
+  //
+  // Execute the tests.
+  //
+  Status = RunAllTestSuites (Fw);
+
+EXIT:
+  if (Fw) {
+    FreeUnitTestFramework (Fw);
+  }
+
+  return Status;
+}
+
+/**
+  Standard UEFI entry point for target based benchmark execution from UEFI Shell.
+**/
+EFI_STATUS
+EFIAPI
+BenchmarkAppEntry (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  return UnitTestingEntry ();
+}
+
+/**
+  Standard POSIX C entry point for host based benchmark execution.
+**/
+int
+main (
+  int   argc,
+  char  *argv[]
+  )
+{
+  return UnitTestingEntry ();
+}
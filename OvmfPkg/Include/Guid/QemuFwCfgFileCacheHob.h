@@ -0,0 +1,18 @@
+/** @file
+  GUID of the HOB that carries the fw_cfg file directory, indexed by file name,
+  from PEI to DXE.
+
+  Copyright (C) 2021, Red Hat, Inc.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#ifndef QEMU_FW_CFG_FILE_CACHE_HOB_H_
+#define QEMU_FW_CFG_FILE_CACHE_HOB_H_
+
+#define QEMU_FW_CFG_FILE_CACHE_HOB_GUID \
+  { 0xf4668a6c, 0xf1d5, 0x4ab3, { 0x97, 0xf9, 0x77, 0x61, 0x31, 0x17, 0x0a, 0x3e } }
+
+extern EFI_GUID  gQemuFwCfgFileCacheHobGuid;
+
+#endif
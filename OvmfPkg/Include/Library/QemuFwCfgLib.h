@@ -13,6 +13,16 @@
 
 #include <IndustryStandard/QemuFwCfg.h>
 
+///
+/// Describes one firmware configuration item to read with
+/// QemuFwCfgReadItems ().
+///
+typedef struct {
+  FIRMWARE_CONFIG_ITEM    Item;    ///< The item to select.
+  UINTN                   Size;    ///< Bytes to read from the start of Item.
+  VOID                    *Buffer; ///< Receives the data read.
+} QEMU_FW_CFG_READ_ITEM;
+
 /**
   Returns a boolean indicating if the firmware configuration interface
   is available or not.
@@ -164,4 +174,25 @@ QemuFwCfgFindFile (
   OUT  UINTN                 *Size
   );
 
+/**
+  Reads the leading bytes of several firmware configuration items.
+
+  When the DMA access method is available, each item is selected and read by a
+  single DMA request, instead of a selector write followed by a transfer. The
+  last item in Items remains selected on return.
+
+  If the firmware configuration interface is unavailable, the buffers are
+  zeroed.
+
+  @param[in]      Count  Number of elements in Items.
+  @param[in, out] Items  The items to read, and the buffers to read them into.
+
+**/
+VOID
+EFIAPI
+QemuFwCfgReadItems (
+  IN     UINTN                  Count,
+  IN OUT QEMU_FW_CFG_READ_ITEM  *Items
+  );
+
 #endif
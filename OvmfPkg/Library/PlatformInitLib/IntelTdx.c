@@ -20,14 +20,96 @@
 #include <Library/PeiServicesLib.h>
 #include <Library/TdxLib.h>
 #include <Library/SynchronizationLib.h>
+#include <Library/TdxMailboxLib.h>
 #include <WorkArea.h>
 #include <ConfidentialComputingGuestAttr.h>
 
+#include "PlatformInitLibInternal.h"
+
 #define ALIGNED_2MB_MASK                0x1fffff
 #define EFI_RESOURCE_MEMORY_UNACCEPTED  7
 
+//
+// Granularity in which the APs share the acceptance of a memory range. It is
+// a multiple of every accept page size.
+//
+#define TDX_ACCEPT_CHUNK_SIZE  SIZE_32MB
+
+/**
+  Accept a memory range with all the vCPUs.
+
+  The APs are spinning in the mailbox loop of SecEntry.nasm. They are sent
+  the AcceptPages command and accept their chunks of the range while the BSP
+  accepts its own, see AcceptMemoryChunks().
+
+  @param[in] PhysicalAddress   Start physical address, aligned to PageSize.
+  @param[in] PhysicalEnd       End physical address, aligned to PageSize.
+  @param[in] PageSize          Accept page size.
+
+  @retval    EFI_SUCCESS       Accept memory successfully
+  @retval    Others            Other errors as indicated
+**/
+EFI_STATUS
+EFIAPI
+MpAcceptMemoryResourceRange (
+  IN EFI_PHYSICAL_ADDRESS  PhysicalAddress,
+  IN EFI_PHYSICAL_ADDRESS  PhysicalEnd,
+  IN UINT32                PageSize
+  )
+{
+  EFI_STATUS                  Status;
+  UINT32                      CpusNum;
+  UINT32                      Index;
+  volatile MP_WAKEUP_MAILBOX  *MailBox;
+
+  CpusNum = GetCpusNum ();
+  if ((CpusNum == 1) || (PhysicalEnd - PhysicalAddress <= TDX_ACCEPT_CHUNK_SIZE)) {
+    return TdAcceptPages (PhysicalAddress, (PhysicalEnd - PhysicalAddress) / PageSize, PageSize);
+  }
+
+  DEBUG ((DEBUG_INFO, "   CPUs : %d\n", CpusNum));
+
+  MailBox = (volatile MP_WAKEUP_MAILBOX *)GetTdxMailBox ();
+  ZeroMem ((VOID *)MailBox->Errors, sizeof (MailBox->Errors));
+
+  MpSerializeStart ();
+  MpSendWakeupCommand (
+    MpProtectedModeWakeupCommandAcceptPages,
+    0,
+    PhysicalAddress,
+    PhysicalEnd,
+    TDX_ACCEPT_CHUNK_SIZE,
+    PageSize
+    );
+
+  Status = AcceptMemoryChunks (
+             0,
+             CpusNum,
+             PhysicalAddress,
+             PhysicalEnd,
+             TDX_ACCEPT_CHUNK_SIZE,
+             PageSize,
+             TdAcceptPages
+             );
+
+  MpSerializeEnd ();
+
+  //
+  // vCPUs past the end of Errors report in its last entry
+  //
+  for (Index = 0; Index < MIN (CpusNum, ARRAY_SIZE (MailBox->Errors)); Index++) {
+    if (MailBox->Errors[Index] != 0) {
+      DEBUG ((DEBUG_ERROR, "TdAccept: vCPU %d failed with error %d\n", Index, MailBox->Errors[Index]));
+      Status = EFI_DEVICE_ERROR;
+    }
+  }
+
+  return Status;
+}
+
 /**
-  This function will be called to accept pages. Only BSP accepts pages.
+  This function will be called to accept pages. The 2M aligned part of the
+  range is shared with the APs.
 
   TDCALL(ACCEPT_PAGE) supports the accept page size of 4k and 2M. To
   simplify the implementation, the Memory to be accpeted is splitted
@@ -50,7 +132,7 @@
 **/
 EFI_STATUS
 EFIAPI
-BspAcceptMemoryResourceRange (
+AcceptMemoryResourceRange (
   IN EFI_PHYSICAL_ADDRESS  PhysicalAddress,
   IN EFI_PHYSICAL_ADDRESS  PhysicalEnd
   )
@@ -119,8 +201,7 @@ BspAcceptMemoryResourceRange (
   }
 
   if (Length2 > 0) {
-    Pages  = Length2 / AcceptPageSize;
-    Status = TdAcceptPages (StartAddress2, Pages, AcceptPageSize);
+    Status = MpAcceptMemoryResourceRange (StartAddress2, StartAddress2 + Length2, AcceptPageSize);
     if (EFI_ERROR (Status)) {
       return Status;
     }
@@ -395,7 +476,7 @@ ProcessHobList (
 
         PhysicalEnd = Hob.ResourceDescriptor->PhysicalStart + Hob.ResourceDescriptor->ResourceLength;
 
-        Status = BspAcceptMemoryResourceRange (
+        Status = AcceptMemoryResourceRange (
                    Hob.ResourceDescriptor->PhysicalStart,
                    PhysicalEnd
                    );
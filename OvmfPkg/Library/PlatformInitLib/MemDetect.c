@@ -759,10 +759,13 @@ PlatformQemuInitializeRam (
   IN EFI_HOB_PLATFORM_INFO  *PlatformInfoHob
   )
 {
-  UINT64         LowerMemorySize;
-  UINT64         UpperMemorySize;
-  MTRR_SETTINGS  MtrrSettings;
-  EFI_STATUS     Status;
+  UINT64             LowerMemorySize;
+  UINT64             UpperMemorySize;
+  MTRR_SETTINGS      MtrrSettings;
+  MTRR_MEMORY_RANGE  UcRanges[2];
+  UINT8              MtrrScratch[SIZE_16KB];
+  UINTN              MtrrScratchSize;
+  EFI_STATUS         Status;
 
   DEBUG ((DEBUG_INFO, "%a called\n", __FUNCTION__));
 
@@ -854,28 +857,37 @@ PlatformQemuInitializeRam (
     SetMem (&MtrrSettings.Fixed, sizeof MtrrSettings.Fixed, 0x06);
     ZeroMem (&MtrrSettings.Variables, sizeof MtrrSettings.Variables);
     MtrrSettings.MtrrDefType |= BIT11 | BIT10 | 6;
-    MtrrSetAllMtrrs (&MtrrSettings);
 
     //
     // Set memory range from 640KB to 1MB to uncacheable
     //
-    Status = MtrrSetMemoryAttribute (
-               BASE_512KB + BASE_128KB,
-               BASE_1MB - (BASE_512KB + BASE_128KB),
-               CacheUncacheable
-               );
-    ASSERT_EFI_ERROR (Status);
+    UcRanges[0].BaseAddress = BASE_512KB + BASE_128KB;
+    UcRanges[0].Length      = BASE_1MB - (BASE_512KB + BASE_128KB);
+    UcRanges[0].Type        = CacheUncacheable;
 
     //
     // Set the memory range from the start of the 32-bit MMIO area (32-bit PCI
     // MMIO aperture on i440fx, PCIEXBAR on q35) to 4GB as uncacheable.
     //
-    Status = MtrrSetMemoryAttribute (
-               PlatformInfoHob->Uc32Base,
-               SIZE_4GB - PlatformInfoHob->Uc32Base,
-               CacheUncacheable
-               );
-    ASSERT_EFI_ERROR (Status);
+    UcRanges[1].BaseAddress = PlatformInfoHob->Uc32Base;
+    UcRanges[1].Length      = SIZE_4GB - PlatformInfoHob->Uc32Base;
+    UcRanges[1].Type        = CacheUncacheable;
+
+    //
+    // Calculate both ranges into the settings buffer in one pass, then program
+    // the MTRRs once, rather than disabling and flushing the cache for every
+    // range.
+    //
+    MtrrScratchSize = sizeof (MtrrScratch);
+    Status          = MtrrSetMemoryAttributesInMtrrSettings (
+                        &MtrrSettings,
+                        MtrrScratch,
+                        &MtrrScratchSize,
+                        UcRanges,
+                        ARRAY_SIZE (UcRanges)
+                        );
+    ASSERT_RETURN_ERROR (Status);
+    MtrrSetAllMtrrs (&MtrrSettings);
   }
 }
 
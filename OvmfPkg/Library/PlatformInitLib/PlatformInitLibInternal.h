@@ -0,0 +1,63 @@
+/** @file
+  Internal definitions shared by the source files of PlatformInitLib and its
+  host based unit tests.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef PLATFORM_INIT_LIB_INTERNAL_H_
+#define PLATFORM_INIT_LIB_INTERNAL_H_
+
+#include <Uefi/UefiBaseType.h>
+
+/**
+  Accept pages of memory. This is the prototype of TdAcceptPages().
+
+  @param[in]  StartAddress      Guest physical address of the first page.
+  @param[in]  NumberOfPages     Number of the pages to be accepted.
+  @param[in]  PageSize          GPA page size.
+
+  @return EFI_SUCCESS           Accept successfully
+  @return others                Indicate other errors
+**/
+typedef
+EFI_STATUS
+(EFIAPI *TDX_ACCEPT_PAGES)(
+  IN UINT64  StartAddress,
+  IN UINT64  NumberOfPages,
+  IN UINT32  PageSize
+  );
+
+/**
+  Accept the chunks of a memory range that belong to one vCPU.
+
+  The range is split into chunks of ChunkSize bytes, and chunk N is accepted
+  by the vCPU whose index is N % CpusNum. The APs follow the same schedule in
+  the mailbox loop of SecEntry.nasm, the BSP calls this function for the
+  chunks of vCPU 0.
+
+  @param[in] CpuIndex          Index of the vCPU.
+  @param[in] CpusNum           Number of vCPUs sharing the range.
+  @param[in] PhysicalAddress   Start physical address, aligned to PageSize.
+  @param[in] PhysicalEnd       End physical address, aligned to PageSize.
+  @param[in] ChunkSize         Size of a chunk, a multiple of PageSize.
+  @param[in] PageSize          Accept page size.
+  @param[in] AcceptPages       Function accepting pages.
+
+  @retval    EFI_SUCCESS       Accept memory successfully
+  @retval    Others            Error returned by AcceptPages
+**/
+EFI_STATUS
+EFIAPI
+AcceptMemoryChunks (
+  IN UINT32                CpuIndex,
+  IN UINT32                CpusNum,
+  IN EFI_PHYSICAL_ADDRESS  PhysicalAddress,
+  IN EFI_PHYSICAL_ADDRESS  PhysicalEnd,
+  IN UINT64                ChunkSize,
+  IN UINT32                PageSize,
+  IN TDX_ACCEPT_PAGES      AcceptPages
+  );
+
+#endif
@@ -0,0 +1,60 @@
+/** @file
+  Split the acceptance of a TDX memory range between the vCPUs.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi/UefiBaseType.h>
+#include <Library/BaseLib.h>
+
+#include "PlatformInitLibInternal.h"
+
+/**
+  Accept the chunks of a memory range that belong to one vCPU.
+
+  The range is split into chunks of ChunkSize bytes, and chunk N is accepted
+  by the vCPU whose index is N % CpusNum. The APs follow the same schedule in
+  the mailbox loop of SecEntry.nasm, the BSP calls this function for the
+  chunks of vCPU 0.
+
+  @param[in] CpuIndex          Index of the vCPU.
+  @param[in] CpusNum           Number of vCPUs sharing the range.
+  @param[in] PhysicalAddress   Start physical address, aligned to PageSize.
+  @param[in] PhysicalEnd       End physical address, aligned to PageSize.
+  @param[in] ChunkSize         Size of a chunk, a multiple of PageSize.
+  @param[in] PageSize          Accept page size.
+  @param[in] AcceptPages       Function accepting pages.
+
+  @retval    EFI_SUCCESS       Accept memory successfully
+  @retval    Others            Error returned by AcceptPages
+**/
+EFI_STATUS
+EFIAPI
+AcceptMemoryChunks (
+  IN UINT32                CpuIndex,
+  IN UINT32                CpusNum,
+  IN EFI_PHYSICAL_ADDRESS  PhysicalAddress,
+  IN EFI_PHYSICAL_ADDRESS  PhysicalEnd,
+  IN UINT64                ChunkSize,
+  IN UINT32                PageSize,
+  IN TDX_ACCEPT_PAGES      AcceptPages
+  )
+{
+  EFI_STATUS            Status;
+  EFI_PHYSICAL_ADDRESS  ChunkStart;
+  EFI_PHYSICAL_ADDRESS  ChunkEnd;
+
+  for (ChunkStart = PhysicalAddress + MultU64x32 (ChunkSize, CpuIndex);
+       ChunkStart < PhysicalEnd;
+       ChunkStart += MultU64x32 (ChunkSize, CpusNum))
+  {
+    ChunkEnd = MIN (ChunkStart + ChunkSize, PhysicalEnd);
+    Status   = AcceptPages (ChunkStart, DivU64x32 (ChunkEnd - ChunkStart, PageSize), PageSize);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
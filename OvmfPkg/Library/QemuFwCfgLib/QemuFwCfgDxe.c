@@ -9,14 +9,17 @@
   SPDX-License-Identifier: BSD-2-Clause-Patent
 **/
 
-#include <Uefi.h>
+#include <PiDxe.h>
 
+#include <Guid/QemuFwCfgFileCacheHob.h>
 #include <Protocol/IoMmu.h>
 
 #include <Library/BaseLib.h>
 #include <Library/BaseMemoryLib.h>
+#include <Library/HobLib.h>
 #include <Library/IoLib.h>
 #include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
 #include <Library/QemuFwCfgLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/MemEncryptTdxLib.h>
@@ -29,6 +32,8 @@ STATIC BOOLEAN  mQemuFwCfgDmaSupported;
 
 STATIC EDKII_IOMMU_PROTOCOL  *mIoMmuProtocol;
 
+STATIC QEMU_FW_CFG_FILE_CACHE  *mFileCache;
+
 /**
   Returns a boolean indicating if the firmware configuration interface
   is available or not.
@@ -145,6 +150,55 @@ InternalQemuFwCfgDmaIsAvailable (
   return mQemuFwCfgDmaSupported;
 }
 
+/**
+  Returns the fw_cfg file directory cache of the current phase, building it on
+  first use if the phase supports that.
+
+  The cache is taken over from the HOB that PEI left behind, if any, or read
+  from fw_cfg otherwise. Either way, the module keeps a private copy, so that
+  SMM drivers do not depend on memory outside of SMRAM.
+
+  @return  The file directory cache, or NULL if there is none; the caller then
+           has to scan the file directory itself.
+**/
+QEMU_FW_CFG_FILE_CACHE *
+InternalQemuFwCfgGetFileCache (
+  VOID
+  )
+{
+  EFI_HOB_GUID_TYPE       *GuidHob;
+  UINT32                  FileCount;
+  UINTN                   CacheSize;
+  QEMU_FW_CFG_FILE_CACHE  *Cache;
+
+  if (mFileCache != NULL) {
+    return mFileCache;
+  }
+
+  GuidHob = GetFirstGuidHob (&gQemuFwCfgFileCacheHobGuid);
+  if (GuidHob != NULL) {
+    mFileCache = AllocateCopyPool (
+                   GET_GUID_HOB_DATA_SIZE (GuidHob),
+                   GET_GUID_HOB_DATA (GuidHob)
+                   );
+    return mFileCache;
+  }
+
+  FileCount = InternalQemuFwCfgReadFileCount (&CacheSize);
+  if (FileCount > QEMU_FW_CFG_FILE_CACHE_MAX_FILES) {
+    return NULL;
+  }
+
+  Cache = AllocatePool (CacheSize);
+  if (Cache == NULL) {
+    return NULL;
+  }
+
+  InternalQemuFwCfgReadFileCache (FileCount, Cache);
+  mFileCache = Cache;
+  return mFileCache;
+}
+
 /**
   Function is used for allocating a bi-directional FW_CFG_DMA_ACCESS used
   between Host and device to exchange the information. The buffer must be free'd
@@ -382,6 +436,9 @@ UnmapFwCfgDmaDataBuffer (
                           FW_CFG_DMA_CTL_WRITE - write to fw_cfg from Buffer.
                           FW_CFG_DMA_CTL_READ  - read from fw_cfg into Buffer.
                           FW_CFG_DMA_CTL_SKIP  - skip bytes in fw_cfg.
+                          The operation may be wrapped with
+                          FW_CFG_DMA_CTL_SELECT_ITEM () to select an item
+                          first.
 **/
 VOID
 InternalQemuFwCfgDmaBytes (
@@ -398,8 +455,9 @@ InternalQemuFwCfgDmaBytes (
   VOID                        *DataBuffer;
 
   ASSERT (
-    Control == FW_CFG_DMA_CTL_WRITE || Control == FW_CFG_DMA_CTL_READ ||
-    Control == FW_CFG_DMA_CTL_SKIP
+    FW_CFG_DMA_CTL_OPERATION (Control) == FW_CFG_DMA_CTL_WRITE ||
+    FW_CFG_DMA_CTL_OPERATION (Control) == FW_CFG_DMA_CTL_READ ||
+    FW_CFG_DMA_CTL_OPERATION (Control) == FW_CFG_DMA_CTL_SKIP
     );
 
   if (Size == 0) {
@@ -429,9 +487,9 @@ InternalQemuFwCfgDmaBytes (
     //
     // Map actual data buffer
     //
-    if (Control != FW_CFG_DMA_CTL_SKIP) {
+    if (FW_CFG_DMA_CTL_OPERATION (Control) != FW_CFG_DMA_CTL_SKIP) {
       MapFwCfgDmaDataBuffer (
-        Control == FW_CFG_DMA_CTL_WRITE,
+        FW_CFG_DMA_CTL_OPERATION (Control) == FW_CFG_DMA_CTL_WRITE,
         Buffer,
         Size,
         &DataBufferAddress,
@@ -232,6 +232,104 @@ QemuFwCfgRead64 (
   return Result;
 }
 
+/**
+  Hashes an fw_cfg file name into a bucket of the file directory cache.
+
+  @param[in] Name  NUL-terminated file name.
+
+  @return  The bucket index.
+**/
+STATIC
+UINTN
+QemuFwCfgHashFileName (
+  IN CONST CHAR8  *Name
+  )
+{
+  UINT32  Hash;
+
+  Hash = 0;
+  while (*Name != '\0') {
+    Hash = Hash * 31 + (UINT8)*Name;
+    Name++;
+  }
+
+  return Hash & (QEMU_FW_CFG_FILE_CACHE_BUCKETS - 1);
+}
+
+/**
+  Selects the fw_cfg file directory and reads the number of files in it.
+
+  This is the first step of building a file directory cache. It has to be
+  followed by InternalQemuFwCfgReadFileCache (), with no fw_cfg access in
+  between.
+
+  @param[out] CacheSize  Size in bytes of the cache needed for the directory.
+
+  @return  The number of files in the directory.
+**/
+UINT32
+InternalQemuFwCfgReadFileCount (
+  OUT UINTN  *CacheSize
+  )
+{
+  UINT32  Count;
+
+  QemuFwCfgSelectItem (QemuFwCfgItemFileDir);
+  Count = SwapBytes32 (QemuFwCfgRead32 ());
+
+  *CacheSize = sizeof (QEMU_FW_CFG_FILE_CACHE) +
+               (UINTN)Count * sizeof (QEMU_FW_CFG_CACHED_FILE);
+  return Count;
+}
+
+/**
+  Reads the rest of the fw_cfg file directory into Cache, and indexes it by
+  file name.
+
+  @param[in]  FileCount  The value returned by InternalQemuFwCfgReadFileCount ().
+  @param[out] Cache      Buffer of the size returned by
+                         InternalQemuFwCfgReadFileCount ().
+**/
+VOID
+InternalQemuFwCfgReadFileCache (
+  IN  UINT32                  FileCount,
+  OUT QEMU_FW_CFG_FILE_CACHE  *Cache
+  )
+{
+  UINT32                   Idx;
+  QEMU_FW_CFG_CACHED_FILE  *File;
+  UINTN                    Bucket;
+
+  ASSERT (FileCount <= QEMU_FW_CFG_FILE_CACHE_MAX_FILES);
+
+  ZeroMem (Cache->Bucket, sizeof Cache->Bucket);
+  Cache->FileCount = FileCount;
+
+  //
+  // The cached entries have the same layout as the directory entries, so
+  // fetch the whole directory with one transfer.
+  //
+  InternalQemuFwCfgReadBytes (
+    (UINTN)FileCount * sizeof (QEMU_FW_CFG_CACHED_FILE),
+    Cache->File
+    );
+
+  //
+  // Insert the entries in reverse order, so that each chain lists the files
+  // in directory order, and a lookup returns the same file as a linear scan.
+  //
+  for (Idx = FileCount; Idx > 0; --Idx) {
+    File         = &Cache->File[Idx - 1];
+    File->Size   = SwapBytes32 (File->Size);
+    File->Select = SwapBytes16 (File->Select);
+    File->Name[QEMU_FW_CFG_FNAME_SIZE - 1] = '\0';
+
+    Bucket                = QemuFwCfgHashFileName (File->Name);
+    File->Next            = Cache->Bucket[Bucket];
+    Cache->Bucket[Bucket] = (UINT16)Idx;
+  }
+}
+
 /**
   Find the configuration item corresponding to the firmware configuration file.
 
@@ -253,13 +351,32 @@ QemuFwCfgFindFile (
   OUT  UINTN                 *Size
   )
 {
-  UINT32  Count;
-  UINT32  Idx;
+  UINT32                   Count;
+  UINT32                   Idx;
+  QEMU_FW_CFG_FILE_CACHE   *Cache;
+  QEMU_FW_CFG_CACHED_FILE  *File;
 
   if (!InternalQemuFwCfgIsAvailable ()) {
     return RETURN_UNSUPPORTED;
   }
 
+  Cache = InternalQemuFwCfgGetFileCache ();
+  if (Cache != NULL) {
+    Idx = Cache->Bucket[QemuFwCfgHashFileName (Name)];
+    while (Idx != 0) {
+      File = &Cache->File[Idx - 1];
+      if (AsciiStrCmp (Name, File->Name) == 0) {
+        *Item = File->Select;
+        *Size = File->Size;
+        return RETURN_SUCCESS;
+      }
+
+      Idx = File->Next;
+    }
+
+    return RETURN_NOT_FOUND;
+  }
+
   QemuFwCfgSelectItem (QemuFwCfgItemFileDir);
   Count = SwapBytes32 (QemuFwCfgRead32 ());
 
@@ -284,3 +401,43 @@ QemuFwCfgFindFile (
 
   return RETURN_NOT_FOUND;
 }
+
+/**
+  Read several firmware configuration items, each from its beginning.
+
+  When the DMA access method is available, each item is selected and read
+  with a single DMA request, rather than through the selector port and a
+  separate transfer.
+
+  @param[in]     Count  Number of elements in Items.
+  @param[in,out] Items  The items to read. Buffer of each element is filled
+                        with Size bytes from the start of Item.
+**/
+VOID
+EFIAPI
+QemuFwCfgReadItems (
+  IN     UINTN                  Count,
+  IN OUT QEMU_FW_CFG_READ_ITEM  *Items
+  )
+{
+  UINTN  Idx;
+
+  for (Idx = 0; Idx < Count; ++Idx) {
+    if (!InternalQemuFwCfgIsAvailable ()) {
+      ZeroMem (Items[Idx].Buffer, Items[Idx].Size);
+      continue;
+    }
+
+    if (InternalQemuFwCfgDmaIsAvailable () && (Items[Idx].Size <= MAX_UINT32)) {
+      InternalQemuFwCfgDmaBytes (
+        (UINT32)Items[Idx].Size,
+        Items[Idx].Buffer,
+        FW_CFG_DMA_CTL_SELECT_ITEM (Items[Idx].Item, FW_CFG_DMA_CTL_READ)
+        );
+      continue;
+    }
+
+    QemuFwCfgSelectItem (Items[Idx].Item);
+    InternalQemuFwCfgReadBytes (Items[Idx].Size, Items[Idx].Buffer);
+  }
+}
@@ -11,6 +11,53 @@
 #ifndef __QEMU_FW_CFG_LIB_INTERNAL_H__
 #define __QEMU_FW_CFG_LIB_INTERNAL_H__
 
+//
+// Control word for InternalQemuFwCfgDmaBytes () that selects Item before
+// transferring the data, saving the separate selector port access.
+//
+#define FW_CFG_DMA_CTL_SELECT_ITEM(Item, Operation) \
+  ((UINT32)(Operation) | FW_CFG_DMA_CTL_SELECT | ((UINT32)(UINT16)(Item) << 16))
+
+//
+// The transfer operation encoded in a DMA control word, without the select
+// bit and the item.
+//
+#define FW_CFG_DMA_CTL_OPERATION(Control) \
+  ((UINT32)(Control) & (FW_CFG_DMA_CTL_READ | FW_CFG_DMA_CTL_SKIP | FW_CFG_DMA_CTL_WRITE))
+
+//
+// Number of hash buckets in the file directory cache. Must be a power of two.
+//
+#define QEMU_FW_CFG_FILE_CACHE_BUCKETS  64
+
+//
+// One cached fw_cfg file directory entry. The layout matches the entries of
+// QemuFwCfgItemFileDir, so the directory can be read into the cache in a
+// single transfer; the fields are converted to host byte order afterwards,
+// and the reserved field is reused to chain entries in the same bucket.
+//
+typedef struct {
+  UINT32    Size;
+  UINT16    Select;
+  UINT16    Next;                           // 1-based index, 0 ends the chain
+  CHAR8     Name[QEMU_FW_CFG_FNAME_SIZE];
+} QEMU_FW_CFG_CACHED_FILE;
+
+//
+// The fw_cfg file directory, indexed by file name. The structure contains no
+// pointers, so that it can be carried from PEI to DXE in a GUID HOB.
+//
+typedef struct {
+  UINT32                     FileCount;
+  UINT16                     Bucket[QEMU_FW_CFG_FILE_CACHE_BUCKETS]; // 1-based index, 0 if empty
+  QEMU_FW_CFG_CACHED_FILE    File[];
+} QEMU_FW_CFG_FILE_CACHE;
+
+//
+// Upper bound on the cached directory, chosen so that the cache fits in a HOB.
+//
+#define QEMU_FW_CFG_FILE_CACHE_MAX_FILES  512
+
 /**
   Returns a boolean indicating if the firmware configuration interface is
   available for library-internal purposes.
@@ -51,6 +98,9 @@ InternalQemuFwCfgDmaIsAvailable (
                           FW_CFG_DMA_CTL_WRITE - write to fw_cfg from Buffer.
                           FW_CFG_DMA_CTL_READ  - read from fw_cfg into Buffer.
                           FW_CFG_DMA_CTL_SKIP  - skip bytes in fw_cfg.
+                          The operation may be wrapped with
+                          FW_CFG_DMA_CTL_SELECT_ITEM () to select an item
+                          first.
 **/
 VOID
 InternalQemuFwCfgDmaBytes (
@@ -59,6 +109,48 @@ InternalQemuFwCfgDmaBytes (
   IN     UINT32  Control
   );
 
+/**
+  Returns the fw_cfg file directory cache of the current phase, building it on
+  first use if the phase supports that.
+
+  @return  The file directory cache, or NULL if there is none; the caller then
+           has to scan the file directory itself.
+**/
+QEMU_FW_CFG_FILE_CACHE *
+InternalQemuFwCfgGetFileCache (
+  VOID
+  );
+
+/**
+  Selects the fw_cfg file directory and reads the number of files in it.
+
+  This is the first step of building a file directory cache. It has to be
+  followed by InternalQemuFwCfgReadFileCache (), with no fw_cfg access in
+  between.
+
+  @param[out] CacheSize  Size in bytes of the cache needed for the directory.
+
+  @return  The number of files in the directory.
+**/
+UINT32
+InternalQemuFwCfgReadFileCount (
+  OUT UINTN  *CacheSize
+  );
+
+/**
+  Reads the rest of the fw_cfg file directory into Cache, and indexes it by
+  file name.
+
+  @param[in]  FileCount  The value returned by InternalQemuFwCfgReadFileCount ().
+  @param[out] Cache      Buffer of the size returned by
+                         InternalQemuFwCfgReadFileCount ().
+**/
+VOID
+InternalQemuFwCfgReadFileCache (
+  IN  UINT32                  FileCount,
+  OUT QEMU_FW_CFG_FILE_CACHE  *Cache
+  );
+
 /**
   Check if it is Tdx guest
 
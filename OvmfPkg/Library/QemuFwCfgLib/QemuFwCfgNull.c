@@ -197,3 +197,20 @@ QemuFwCfgFindFile (
 {
   return RETURN_UNSUPPORTED;
 }
+
+/**
+  Read several firmware configuration items, each from its beginning.
+
+  @param[in]     Count  Number of elements in Items.
+  @param[in,out] Items  The items to read. Buffer of each element is filled
+                        with Size bytes from the start of Item.
+**/
+VOID
+EFIAPI
+QemuFwCfgReadItems (
+  IN     UINTN                  Count,
+  IN OUT QEMU_FW_CFG_READ_ITEM  *Items
+  )
+{
+  ASSERT (FALSE);
+}
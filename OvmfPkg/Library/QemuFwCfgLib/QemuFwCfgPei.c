@@ -9,11 +9,17 @@
   SPDX-License-Identifier: BSD-2-Clause-Patent
 **/
 
+#include <PiPei.h>
+
+#include <Guid/QemuFwCfgFileCacheHob.h>
 #include <Library/BaseLib.h>
+#include <Library/HobLib.h>
 #include <Library/IoLib.h>
 #include <Library/DebugLib.h>
+#include <Library/PeiServicesLib.h>
 #include <Library/QemuFwCfgLib.h>
 #include <Library/MemEncryptSevLib.h>
+#include <Ppi/MemoryDiscovered.h>
 #include <WorkArea.h>
 
 #include "QemuFwCfgLibInternal.h"
@@ -148,6 +154,60 @@ InternalQemuFwCfgDmaIsAvailable (
   return mQemuFwCfgDmaSupported;
 }
 
+/**
+  Returns the fw_cfg file directory cache of the current phase, building it on
+  first use if the phase supports that.
+
+  The cache is kept in a GUID HOB, so that later PEIMs, and the DXE instance of
+  this library, can use it without reading the directory again. The HOB is
+  only built after permanent memory has been installed, as temporary RAM is
+  too small to hold it.
+
+  @return  The file directory cache, or NULL if there is none; the caller then
+           has to scan the file directory itself.
+**/
+QEMU_FW_CFG_FILE_CACHE *
+InternalQemuFwCfgGetFileCache (
+  VOID
+  )
+{
+  EFI_HOB_GUID_TYPE       *GuidHob;
+  EFI_STATUS              Status;
+  VOID                    *MemoryDiscovered;
+  UINT32                  FileCount;
+  UINTN                   CacheSize;
+  QEMU_FW_CFG_FILE_CACHE  *Cache;
+
+  GuidHob = GetFirstGuidHob (&gQemuFwCfgFileCacheHobGuid);
+  if (GuidHob != NULL) {
+    return GET_GUID_HOB_DATA (GuidHob);
+  }
+
+  Status = PeiServicesLocatePpi (
+             &gEfiPeiMemoryDiscoveredPpiGuid,
+             0,
+             NULL,
+             &MemoryDiscovered
+             );
+  if (EFI_ERROR (Status)) {
+    return NULL;
+  }
+
+  FileCount = InternalQemuFwCfgReadFileCount (&CacheSize);
+  if (FileCount > QEMU_FW_CFG_FILE_CACHE_MAX_FILES) {
+    return NULL;
+  }
+
+  Cache = BuildGuidHob (&gQemuFwCfgFileCacheHobGuid, CacheSize);
+  if (Cache == NULL) {
+    return NULL;
+  }
+
+  InternalQemuFwCfgReadFileCache (FileCount, Cache);
+  DEBUG ((DEBUG_VERBOSE, "%a: cached %u fw_cfg files\n", __FUNCTION__, FileCount));
+  return Cache;
+}
+
 /**
   Transfer an array of bytes, or skip a number of bytes, using the DMA
   interface.
@@ -162,6 +222,9 @@ InternalQemuFwCfgDmaIsAvailable (
                           FW_CFG_DMA_CTL_WRITE - write to fw_cfg from Buffer.
                           FW_CFG_DMA_CTL_READ  - read from fw_cfg into Buffer.
                           FW_CFG_DMA_CTL_SKIP  - skip bytes in fw_cfg.
+                          The operation may be wrapped with
+                          FW_CFG_DMA_CTL_SELECT_ITEM () to select an item
+                          first.
 **/
 VOID
 InternalQemuFwCfgDmaBytes (
@@ -175,8 +238,9 @@ InternalQemuFwCfgDmaBytes (
   UINT32                      Status;
 
   ASSERT (
-    Control == FW_CFG_DMA_CTL_WRITE || Control == FW_CFG_DMA_CTL_READ ||
-    Control == FW_CFG_DMA_CTL_SKIP
+    FW_CFG_DMA_CTL_OPERATION (Control) == FW_CFG_DMA_CTL_WRITE ||
+    FW_CFG_DMA_CTL_OPERATION (Control) == FW_CFG_DMA_CTL_READ ||
+    FW_CFG_DMA_CTL_OPERATION (Control) == FW_CFG_DMA_CTL_SKIP
     );
 
   if (Size == 0) {
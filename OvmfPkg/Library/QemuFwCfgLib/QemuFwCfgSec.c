@@ -91,6 +91,22 @@ InternalQemuFwCfgDmaIsAvailable (
   return FALSE;
 }
 
+/**
+  Returns the fw_cfg file directory cache of the current phase, building it on
+  first use if the phase supports that.
+
+  SEC has no memory to keep a cache in.
+
+  @return  NULL; the caller has to scan the file directory itself.
+**/
+QEMU_FW_CFG_FILE_CACHE *
+InternalQemuFwCfgGetFileCache (
+  VOID
+  )
+{
+  return NULL;
+}
+
 /**
   Transfer an array of bytes, or skip a number of bytes, using the DMA
   interface.
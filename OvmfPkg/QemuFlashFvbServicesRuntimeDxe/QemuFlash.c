@@ -10,6 +10,7 @@
 #include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 #include <Library/MemEncryptSevLib.h>
+#include <Library/MemoryAllocationLib.h>
 #include <Library/PcdLib.h>
 
 #include "QemuFlash.h"
@@ -19,15 +20,39 @@
 #define CLEAR_STATUS_CMD         0x50
 #define READ_STATUS_CMD          0x70
 #define READ_DEVID_CMD           0x90
+#define CFI_QUERY_CMD            0x98
 #define BLOCK_ERASE_CONFIRM_CMD  0xd0
+#define WRITE_TO_BUFFER_CMD      0xe8
 #define READ_ARRAY_CMD           0xff
 
 #define CLEARED_ARRAY_STATUS  0x00
 
+//
+// Offsets of the CFI query data, for an 8-bit wide device.
+//
+#define CFI_QUERY_SIGNATURE_OFFSET     0x10
+#define CFI_QUERY_WRITE_BUFFER_OFFSET  0x2a
+#define CFI_QUERY_MAX_WRITE_BUFFER     16
+
+//
+// WRITE_TO_BUFFER_CMD takes the byte count minus one as a single byte, so one
+// buffered write covers at most 2^8 bytes on an 8-bit wide device.
+//
+#define WRITE_TO_BUFFER_MAX_LOG2_SIZE  8
+
 UINT8  *mFlashBase;
 
-STATIC UINTN  mFdBlockSize  = 0;
-STATIC UINTN  mFdBlockCount = 0;
+//
+// Copy of the variable store region of the flash, which QemuFlashRead()
+// serves reads from. NULL if it could not be allocated.
+//
+UINT8  *mFlashMirror;
+
+STATIC UINTN  mFdBlockSize     = 0;
+STATIC UINTN  mFdBlockCount    = 0;
+STATIC UINTN  mMirrorStart     = 0;
+STATIC UINTN  mMirrorSize      = 0;
+STATIC UINTN  mWriteBufferSize = 0;
 
 STATIC
 volatile UINT8 *
@@ -39,6 +64,80 @@ QemuFlashPtr (
   return mFlashBase + ((UINTN)Lba * mFdBlockSize) + Offset;
 }
 
+/**
+  Returns the copy of a flash range in the mirror.
+
+  @param[in] Lba      The logical block index.
+  @param[in] Offset   Offset into the block.
+  @param[in] Length   Size of the range.
+
+  @return Pointer into mFlashMirror, or NULL if the range is not mirrored.
+
+**/
+STATIC
+UINT8 *
+QemuFlashMirrorPtr (
+  IN        EFI_LBA  Lba,
+  IN        UINTN    Offset,
+  IN        UINTN    Length
+  )
+{
+  UINTN  FlashOffset;
+
+  if (mFlashMirror == NULL) {
+    return NULL;
+  }
+
+  FlashOffset = ((UINTN)Lba * mFdBlockSize) + Offset;
+  if ((FlashOffset < mMirrorStart) ||
+      (Length > mMirrorSize) ||
+      (FlashOffset - mMirrorStart > mMirrorSize - Length))
+  {
+    return NULL;
+  }
+
+  return mFlashMirror + (FlashOffset - mMirrorStart);
+}
+
+/**
+  Reads the size of the write buffer from the CFI query data of the flash.
+
+  @return The size of the write buffer in bytes, or 0 if the flash does not
+          have a usable one.
+
+**/
+STATIC
+UINTN
+QemuFlashGetWriteBufferSize (
+  VOID
+  )
+{
+  volatile UINT8  *Ptr;
+  UINT8           Log2Size;
+
+  Ptr = QemuFlashPtr (0, 0);
+  QemuFlashPtrWrite (Ptr, CFI_QUERY_CMD);
+  if ((Ptr[CFI_QUERY_SIGNATURE_OFFSET] == 'Q') &&
+      (Ptr[CFI_QUERY_SIGNATURE_OFFSET + 1] == 'R') &&
+      (Ptr[CFI_QUERY_SIGNATURE_OFFSET + 2] == 'Y'))
+  {
+    Log2Size = Ptr[CFI_QUERY_WRITE_BUFFER_OFFSET];
+  } else {
+    Log2Size = 0;
+  }
+
+  QemuFlashPtrWrite (Ptr, READ_ARRAY_CMD);
+
+  if ((Log2Size == 0) || (Log2Size > CFI_QUERY_MAX_WRITE_BUFFER)) {
+    return 0;
+  }
+
+  //
+  // Using less than the whole write buffer of the device is always allowed.
+  //
+  return (UINTN)1 << MIN (Log2Size, WRITE_TO_BUFFER_MAX_LOG2_SIZE);
+}
+
 /**
   Determines if the QEMU flash memory device is present.
 
@@ -157,9 +256,12 @@ QemuFlashRead (
   }
 
   //
-  // Get flash address
+  // Get flash address, preferring the mirror
   //
-  Ptr = (UINT8 *)QemuFlashPtr (Lba, Offset);
+  Ptr = QemuFlashMirrorPtr (Lba, Offset, *NumBytes);
+  if (Ptr == NULL) {
+    Ptr = (UINT8 *)QemuFlashPtr (Lba, Offset);
+  }
 
   CopyMem (Buffer, Ptr, *NumBytes);
 
@@ -185,7 +287,10 @@ QemuFlashWrite (
   )
 {
   volatile UINT8  *Ptr;
+  UINT8           *Mirror;
   UINTN           Loop;
+  UINTN           Count;
+  UINTN           Index;
 
   //
   // Only write to the first 64k. We don't bother saving the FTW Spare
@@ -196,14 +301,28 @@ QemuFlashWrite (
   }
 
   //
-  // Program flash
+  // Program flash. With a write buffer, each command programs the bytes up
+  // to the next buffer boundary; otherwise program one byte per command.
   //
   Ptr = QemuFlashPtr (Lba, Offset);
-  for (Loop = 0; Loop < *NumBytes; Loop++) {
-    QemuFlashPtrWrite (Ptr, WRITE_BYTE_CMD);
-    QemuFlashPtrWrite (Ptr, Buffer[Loop]);
+  for (Loop = 0; Loop < *NumBytes; Loop += Count) {
+    if (mWriteBufferSize == 0) {
+      Count = 1;
+      QemuFlashPtrWrite (Ptr, WRITE_BYTE_CMD);
+      QemuFlashPtrWrite (Ptr, Buffer[Loop]);
+    } else {
+      Count = mWriteBufferSize - ((UINTN)(Ptr - mFlashBase) & (mWriteBufferSize - 1));
+      Count = MIN (Count, *NumBytes - Loop);
+      QemuFlashPtrWrite (Ptr, WRITE_TO_BUFFER_CMD);
+      QemuFlashPtrWrite (Ptr, (UINT8)(Count - 1));
+      for (Index = 0; Index < Count; Index++) {
+        QemuFlashPtrWrite (Ptr + Index, Buffer[Loop + Index]);
+      }
+
+      QemuFlashPtrWrite (Ptr, BLOCK_ERASE_CONFIRM_CMD);
+    }
 
-    Ptr++;
+    Ptr += Count;
   }
 
   //
@@ -213,6 +332,14 @@ QemuFlashWrite (
     QemuFlashPtrWrite (Ptr - 1, READ_ARRAY_CMD);
   }
 
+  //
+  // Keep the mirror in sync
+  //
+  Mirror = QemuFlashMirrorPtr (Lba, Offset, *NumBytes);
+  if (Mirror != NULL) {
+    CopyMem (Mirror, Buffer, *NumBytes);
+  }
+
   return EFI_SUCCESS;
 }
 
@@ -228,6 +355,7 @@ QemuFlashEraseBlock (
   )
 {
   volatile UINT8  *Ptr;
+  UINT8           *Mirror;
 
   if (Lba >= mFdBlockCount) {
     return EFI_INVALID_PARAMETER;
@@ -236,6 +364,12 @@ QemuFlashEraseBlock (
   Ptr = QemuFlashPtr (Lba, 0);
   QemuFlashPtrWrite (Ptr, BLOCK_ERASE_CMD);
   QemuFlashPtrWrite (Ptr, BLOCK_ERASE_CONFIRM_CMD);
+
+  Mirror = QemuFlashMirrorPtr (Lba, 0, mFdBlockSize);
+  if (Mirror != NULL) {
+    SetMem (Mirror, mFdBlockSize, 0xff);
+  }
+
   return EFI_SUCCESS;
 }
 
@@ -270,5 +404,23 @@ QemuFlashInitialize (
     return EFI_WRITE_PROTECTED;
   }
 
+  mWriteBufferSize = QemuFlashGetWriteBufferSize ();
+  DEBUG ((DEBUG_INFO, "QEMU Flash: write buffer size %Lu\n", (UINT64)mWriteBufferSize));
+
+  //
+  // Mirror the variable store, the FTW working and spare blocks and the
+  // event log, so that reading them does not go through the flash device.
+  //
+  mMirrorStart = PcdGet32 (PcdOvmfFlashNvStorageVariableBase) -
+                 PcdGet32 (PcdOvmfFdBaseAddress);
+  mMirrorSize = PcdGet32 (PcdFlashNvStorageVariableSize) +
+                PcdGet32 (PcdFlashNvStorageFtwWorkingSize) +
+                PcdGet32 (PcdFlashNvStorageFtwSpareSize) +
+                PcdGet32 (PcdOvmfFlashNvStorageEventLogSize);
+  mFlashMirror = AllocateRuntimeCopyPool (mMirrorSize, mFlashBase + mMirrorStart);
+  if (mFlashMirror == NULL) {
+    DEBUG ((DEBUG_WARN, "QEMU Flash: failed to allocate the mirror\n"));
+  }
+
   return EFI_SUCCESS;
 }
@@ -13,6 +13,7 @@
 #include <Protocol/FirmwareVolumeBlock.h>
 
 extern UINT8  *mFlashBase;
+extern UINT8  *mFlashMirror;
 
 /**
   Read from QEMU Flash
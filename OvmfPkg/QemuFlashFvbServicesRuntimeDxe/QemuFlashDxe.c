@@ -28,6 +28,9 @@ QemuFlashConvertPointers (
   }
 
   EfiConvertPointer (0x0, (VOID **)&mFlashBase);
+  if (mFlashMirror != NULL) {
+    EfiConvertPointer (0x0, (VOID **)&mFlashMirror);
+  }
 }
 
 VOID
@@ -46,7 +46,7 @@ typedef struct {
     UINT32                        Size;
   }                             FwCfgItem[2];
   UINT32          Size;
-  UINT8           *Data;
+  UINT8           *Data; // Fetched on demand, see FetchBlob ().
 } KERNEL_BLOB;
 
 STATIC KERNEL_BLOB  mKernelBlob[KernelBlobTypeMax] = {
@@ -130,6 +130,54 @@ typedef struct {
 #define STUB_FILE_FROM_FILE(FilePointer) \
         CR (FilePointer, STUB_FILE, File, STUB_FILE_SIG)
 
+//
+// Utility functions for fetching the blobs, used by the protocol member
+// functions below.
+//
+
+/**
+  Read a blob from fw_cfg into a caller-provided buffer, and verify it.
+
+  (Forward declaration.)
+
+  @param[in]  Blob    The blob to read; Blob->Size must be nonzero.
+
+  @param[out] Buffer  The buffer to read the blob into. It must be at least
+                      Blob->Size bytes in size.
+
+  @retval EFI_SUCCESS  Blob has been read into Buffer and verified.
+
+  @return              Error codes from VerifyBlob (). Buffer has been zeroed.
+**/
+STATIC
+EFI_STATUS
+ReadBlob (
+  IN  CONST KERNEL_BLOB  *Blob,
+  OUT VOID               *Buffer
+  );
+
+/**
+  Populate Blob->Data, for requests that cannot be served by reading the blob
+  straight into the caller's buffer.
+
+  (Forward declaration.)
+
+  @param[in,out] Blob  Pointer to the KERNEL_BLOB element in mKernelBlob whose
+                       data is to be fetched from fw_cfg. Blob->Size must be
+                       nonzero, and Blob->Data must be NULL.
+
+  @retval EFI_SUCCESS           Blob->Data has been allocated and populated.
+
+  @retval EFI_OUT_OF_RESOURCES  Failed to allocate memory for Blob->Data.
+
+  @return                       Error codes from ReadBlob ().
+**/
+STATIC
+EFI_STATUS
+FetchBlob (
+  IN OUT KERNEL_BLOB  *Blob
+  );
+
 //
 // Protocol member functions for File.
 //
@@ -355,9 +403,10 @@ StubFileRead (
   OUT VOID              *Buffer
   )
 {
-  STUB_FILE          *StubFile;
-  CONST KERNEL_BLOB  *Blob;
-  UINT64             Left;
+  STUB_FILE    *StubFile;
+  KERNEL_BLOB  *Blob;
+  UINT64       Left;
+  EFI_STATUS   Status;
 
   StubFile = STUB_FILE_FROM_FILE (This);
 
@@ -365,8 +414,6 @@ StubFileRead (
   // Scanning the root directory?
   //
   if (StubFile->BlobType == KernelBlobTypeMax) {
-    EFI_STATUS  Status;
-
     if (StubFile->Position == KernelBlobTypeMax) {
       //
       // Scanning complete.
@@ -401,7 +448,28 @@ StubFileRead (
     *BufferSize = (UINTN)Left;
   }
 
-  if (Blob->Data != NULL) {
+  if ((Blob->Data == NULL) && (*BufferSize > 0)) {
+    if ((StubFile->Position == 0) && (*BufferSize == Blob->Size)) {
+      //
+      // The whole file is being read; transfer it from fw_cfg straight into
+      // the caller's buffer.
+      //
+      Status = ReadBlob (Blob, Buffer);
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
+
+      StubFile->Position = Blob->Size;
+      return EFI_SUCCESS;
+    }
+
+    Status = FetchBlob (Blob);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+
+  if (*BufferSize > 0) {
     CopyMem (Buffer, Blob->Data + StubFile->Position, *BufferSize);
   }
 
@@ -884,6 +952,7 @@ InitrdLoadFile2 (
   )
 {
   CONST KERNEL_BLOB  *InitrdBlob = &mKernelBlob[KernelBlobTypeInitrd];
+  EFI_STATUS         Status;
 
   ASSERT (InitrdBlob->Size > 0);
 
@@ -906,7 +975,14 @@ InitrdLoadFile2 (
     return EFI_BUFFER_TOO_SMALL;
   }
 
-  CopyMem (Buffer, InitrdBlob->Data, InitrdBlob->Size);
+  if (InitrdBlob->Data != NULL) {
+    CopyMem (Buffer, InitrdBlob->Data, InitrdBlob->Size);
+  } else {
+    Status = ReadBlob (InitrdBlob, Buffer);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
 
   *BufferSize = InitrdBlob->Size;
   return EFI_SUCCESS;
@@ -921,59 +997,52 @@ STATIC CONST EFI_LOAD_FILE2_PROTOCOL  mInitrdLoadFile2 = {
 //
 
 /**
-  Populate a blob in mKernelBlob.
-
-  param[in,out] Blob  Pointer to the KERNEL_BLOB element in mKernelBlob that is
-                      to be filled from fw_cfg.
-
-  @retval EFI_SUCCESS           Blob has been populated. If fw_cfg reported a
-                                size of zero for the blob, then Blob->Data has
-                                been left unchanged.
+  Read the size of a blob in mKernelBlob from fw_cfg.
 
-  @retval EFI_OUT_OF_RESOURCES  Failed to allocate memory for Blob->Data.
+  @param[in,out] Blob  Pointer to the KERNEL_BLOB element in mKernelBlob whose
+                       size is to be read from fw_cfg.
 **/
 STATIC
-EFI_STATUS
-FetchBlob (
+VOID
+FetchBlobSize (
   IN OUT KERNEL_BLOB  *Blob
   )
 {
-  UINT32  Left;
-  UINTN   Idx;
-  UINT8   *ChunkData;
+  QEMU_FW_CFG_READ_ITEM  SizeItem[ARRAY_SIZE (Blob->FwCfgItem)];
+  UINTN                  Count;
+  UINTN                  Idx;
 
-  //
-  // Read blob size.
-  //
-  Blob->Size = 0;
-  for (Idx = 0; Idx < ARRAY_SIZE (Blob->FwCfgItem); Idx++) {
-    if (Blob->FwCfgItem[Idx].SizeKey == 0) {
+  for (Count = 0; Count < ARRAY_SIZE (Blob->FwCfgItem); Count++) {
+    if (Blob->FwCfgItem[Count].SizeKey == 0) {
       break;
     }
 
-    QemuFwCfgSelectItem (Blob->FwCfgItem[Idx].SizeKey);
-    Blob->FwCfgItem[Idx].Size = QemuFwCfgRead32 ();
-    Blob->Size               += Blob->FwCfgItem[Idx].Size;
+    SizeItem[Count].Item   = Blob->FwCfgItem[Count].SizeKey;
+    SizeItem[Count].Size   = sizeof Blob->FwCfgItem[Count].Size;
+    SizeItem[Count].Buffer = &Blob->FwCfgItem[Count].Size;
   }
 
-  if (Blob->Size == 0) {
-    return EFI_SUCCESS;
-  }
+  QemuFwCfgReadItems (Count, SizeItem);
 
-  //
-  // Read blob.
-  //
-  Blob->Data = AllocatePool (Blob->Size);
-  if (Blob->Data == NULL) {
-    DEBUG ((
-      DEBUG_ERROR,
-      "%a: failed to allocate %Ld bytes for \"%s\"\n",
-      __FUNCTION__,
-      (INT64)Blob->Size,
-      Blob->Name
-      ));
-    return EFI_OUT_OF_RESOURCES;
+  Blob->Size = 0;
+  for (Idx = 0; Idx < Count; Idx++) {
+    Blob->Size += Blob->FwCfgItem[Idx].Size;
   }
+}
+
+STATIC
+EFI_STATUS
+ReadBlob (
+  IN  CONST KERNEL_BLOB  *Blob,
+  OUT VOID               *Buffer
+  )
+{
+  UINT32      Left;
+  UINTN       Idx;
+  UINT8       *ChunkData;
+  EFI_STATUS  Status;
+
+  ASSERT (Blob->Size > 0);
 
   DEBUG ((
     DEBUG_INFO,
@@ -983,7 +1052,11 @@ FetchBlob (
     Blob->Name
     ));
 
-  ChunkData = Blob->Data;
+  //
+  // Transfer in chunks, so that the bounce buffers that DMA needs under
+  // memory encryption stay small.
+  //
+  ChunkData = Buffer;
   for (Idx = 0; Idx < ARRAY_SIZE (Blob->FwCfgItem); Idx++) {
     if (Blob->FwCfgItem[Idx].DataKey == 0) {
       break;
@@ -1011,7 +1084,47 @@ FetchBlob (
     ChunkData += Blob->FwCfgItem[Idx].Size;
   }
 
-  return EFI_SUCCESS;
+  //
+  // The blob may only be consumed once it has passed verification.
+  //
+  Status = VerifyBlob (Blob->Name, Buffer, Blob->Size);
+  if (EFI_ERROR (Status)) {
+    ZeroMem (Buffer, Blob->Size);
+  }
+
+  return Status;
+}
+
+STATIC
+EFI_STATUS
+FetchBlob (
+  IN OUT KERNEL_BLOB  *Blob
+  )
+{
+  EFI_STATUS  Status;
+
+  ASSERT (Blob->Size > 0);
+  ASSERT (Blob->Data == NULL);
+
+  Blob->Data = AllocatePool (Blob->Size);
+  if (Blob->Data == NULL) {
+    DEBUG ((
+      DEBUG_ERROR,
+      "%a: failed to allocate %Ld bytes for \"%s\"\n",
+      __FUNCTION__,
+      (INT64)Blob->Size,
+      Blob->Name
+      ));
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = ReadBlob (Blob, Blob->Data);
+  if (EFI_ERROR (Status)) {
+    FreePool (Blob->Data);
+    Blob->Data = NULL;
+  }
+
+  return Status;
 }
 
 //
@@ -1019,10 +1132,13 @@ FetchBlob (
 //
 
 /**
-  Download the kernel, the initial ramdisk, and the kernel command line from
+  Look up the kernel, the initial ramdisk, and the kernel command line in
   QEMU's fw_cfg. Construct a minimal SimpleFileSystem that contains the two
   image files.
 
+  The blobs themselves are only downloaded when they are read, preferably
+  straight into the consumer's buffer.
+
   @retval EFI_NOT_FOUND         Kernel image was not found.
   @retval EFI_OUT_OF_RESOURCES  Memory allocation failed.
   @retval EFI_PROTOCOL_ERROR    Unterminated kernel command line.
@@ -1056,22 +1172,18 @@ QemuKernelLoaderFsDxeEntrypoint (
   }
 
   //
-  // Fetch all blobs.
+  // Look up the sizes of all blobs. Blobs that are present are verified when
+  // they are read; absent blobs are verified here, as nothing will read them.
   //
   for (BlobType = 0; BlobType < KernelBlobTypeMax; ++BlobType) {
     CurrentBlob = &mKernelBlob[BlobType];
-    Status      = FetchBlob (CurrentBlob);
-    if (EFI_ERROR (Status)) {
-      goto FreeBlobs;
-    }
+    FetchBlobSize (CurrentBlob);
 
-    Status = VerifyBlob (
-               CurrentBlob->Name,
-               CurrentBlob->Data,
-               CurrentBlob->Size
-               );
-    if (EFI_ERROR (Status)) {
-      goto FreeBlobs;
+    if (CurrentBlob->Size == 0) {
+      Status = VerifyBlob (CurrentBlob->Name, NULL, 0);
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
     }
 
     mTotalBlobBytes += CurrentBlob->Size;
@@ -1079,9 +1191,8 @@ QemuKernelLoaderFsDxeEntrypoint (
 
   KernelBlob = &mKernelBlob[KernelBlobTypeKernel];
 
-  if (KernelBlob->Data == NULL) {
-    Status = EFI_NOT_FOUND;
-    goto FreeBlobs;
+  if (KernelBlob->Size == 0) {
+    return EFI_NOT_FOUND;
   }
 
   //
@@ -1104,7 +1215,7 @@ QemuKernelLoaderFsDxeEntrypoint (
       __FUNCTION__,
       Status
       ));
-    goto FreeBlobs;
+    return Status;
   }
 
   if (KernelBlob[KernelBlobTypeInitrd].Size > 0) {
@@ -1141,15 +1252,5 @@ UninstallFileSystemHandle:
                   );
   ASSERT_EFI_ERROR (Status);
 
-FreeBlobs:
-  while (BlobType > 0) {
-    CurrentBlob = &mKernelBlob[--BlobType];
-    if (CurrentBlob->Data != NULL) {
-      FreePool (CurrentBlob->Data);
-      CurrentBlob->Size = 0;
-      CurrentBlob->Data = NULL;
-    }
-  }
-
   return Status;
 }
@@ -355,6 +355,8 @@ DecompressMemFvs (
   EFI_FIRMWARE_VOLUME_HEADER  *DxeMemFv;
   UINT32                      FvHeaderSize;
   UINT32                      FvSectionSize;
+  UINT64                      StartTicks;
+  UINT64                      DecodeTicks;
 
   FvSection = (EFI_COMMON_SECTION_HEADER *)NULL;
 
@@ -399,17 +401,31 @@ DecompressMemFvs (
     PcdGet32 (PcdOvmfDecompressionScratchEnd)
     );
 
-  Status = ExtractGuidedSectionDecode (
-             Section,
-             &OutputBuffer,
-             ScratchBuffer,
-             &AuthenticationStatus
-             );
+  //
+  // Time the decode with the TSC; there is no timer library this early, but
+  // the tick count is enough to compare the cost across builds and configs.
+  //
+  StartTicks = AsmReadTsc ();
+  Status     = ExtractGuidedSectionDecode (
+                 Section,
+                 &OutputBuffer,
+                 ScratchBuffer,
+                 &AuthenticationStatus
+                 );
+  DecodeTicks = AsmReadTsc () - StartTicks;
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "Error during GUID section decode\n"));
     return Status;
   }
 
+  DEBUG ((
+    DEBUG_INFO,
+    "%a: decompressed 0x%x bytes in %Lu TSC ticks\n",
+    __FUNCTION__,
+    OutputBufferSize,
+    DecodeTicks
+    ));
+
   Status = FindFfsSectionInstance (
              OutputBuffer,
              OutputBufferSize,
@@ -0,0 +1,399 @@
+/** @file
+  Unit tests of AcceptMemoryChunks() in PlatformInitLib.
+
+  The vCPUs share the acceptance of a TDX memory range by calling
+  AcceptMemoryChunks() with their own index. The tests run it for every
+  vCPU with a mock accept function, and check that each page of the range
+  is accepted exactly once, in whole chunks that belong to the vCPU.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/UnitTestLib.h>
+
+#include "../../../../Library/PlatformInitLib/PlatformInitLibInternal.h"
+
+#define UNIT_TEST_APP_NAME     "PlatformInitLib AcceptMemoryChunks Unit Test Application"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+//
+// Largest number of pages in the ranges of the test contexts
+//
+#define TEST_MAX_PAGES  512
+
+typedef struct {
+  EFI_PHYSICAL_ADDRESS    PhysicalAddress;
+  EFI_PHYSICAL_ADDRESS    PhysicalEnd;
+  UINT64                  ChunkSize;
+  UINT32                  PageSize;
+  UINT32                  CpusNum;
+} ACCEPT_CHUNKS_TEST_CONTEXT;
+
+//
+// 2M pages in 32M chunks, the last chunk is partial
+//
+ACCEPT_CHUNKS_TEST_CONTEXT  mAccept2MPages = {
+  BASE_4GB,
+  BASE_4GB + 115 * SIZE_2MB,
+  SIZE_32MB,
+  SIZE_2MB,
+  4
+};
+
+//
+// 4K pages in 64K chunks, with a start that is not chunk aligned
+//
+ACCEPT_CHUNKS_TEST_CONTEXT  mAccept4KPages = {
+  BASE_2GB + 3 * SIZE_4KB,
+  BASE_2GB + 3 * SIZE_4KB + 259 * SIZE_4KB,
+  SIZE_64KB,
+  SIZE_4KB,
+  3
+};
+
+//
+// more vCPUs than chunks, so some vCPUs have nothing to accept
+//
+ACCEPT_CHUNKS_TEST_CONTEXT  mAcceptFewChunks = {
+  BASE_4GB,
+  BASE_4GB + SIZE_64MB + SIZE_4MB,
+  SIZE_32MB,
+  SIZE_2MB,
+  16
+};
+
+//
+// a single vCPU accepts every chunk
+//
+ACCEPT_CHUNKS_TEST_CONTEXT  mAcceptOneCpu = {
+  BASE_1MB,
+  BASE_1MB + 100 * SIZE_4KB,
+  SIZE_16KB,
+  SIZE_4KB,
+  1
+};
+
+//
+// State of the mock accept function
+//
+STATIC ACCEPT_CHUNKS_TEST_CONTEXT  *mContext;
+STATIC UINT32                      mCpuIndex;
+STATIC UINTN                       mCalls;
+STATIC UINTN                       mFailCall;
+STATIC BOOLEAN                     mBadCall;
+STATIC UINT8                       mAcceptCount[TEST_MAX_PAGES];
+
+/**
+  Reset the state of the mock accept function.
+
+  @param[in] Context   The range the vCPUs will accept.
+**/
+STATIC
+VOID
+ResetMockAcceptPages (
+  IN ACCEPT_CHUNKS_TEST_CONTEXT  *Context
+  )
+{
+  mContext  = Context;
+  mCpuIndex = 0;
+  mCalls    = 0;
+  mFailCall = 0;
+  mBadCall  = FALSE;
+  ZeroMem (mAcceptCount, sizeof (mAcceptCount));
+}
+
+/**
+  Mock of TdAcceptPages().
+
+  Counts how often each page of the range is accepted, and sets mBadCall if
+  the pages do not form a chunk, or part of the last chunk, that belongs to
+  mCpuIndex. Call number mFailCall fails with EFI_DEVICE_ERROR.
+
+  @param[in]  StartAddress      Guest physical address of the first page.
+  @param[in]  NumberOfPages     Number of the pages to be accepted.
+  @param[in]  PageSize          GPA page size.
+
+  @retval EFI_SUCCESS           The pages were counted.
+  @retval EFI_DEVICE_ERROR      This is call number mFailCall.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockAcceptPages (
+  IN UINT64  StartAddress,
+  IN UINT64  NumberOfPages,
+  IN UINT32  PageSize
+  )
+{
+  UINT64  Offset;
+  UINT64  Chunk;
+  UINT64  Page;
+  UINT64  Index;
+
+  mCalls++;
+  if ((mFailCall != 0) && (mCalls == mFailCall)) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  if ((PageSize != mContext->PageSize) ||
+      (NumberOfPages == 0) ||
+      (StartAddress < mContext->PhysicalAddress) ||
+      (StartAddress + NumberOfPages * PageSize > mContext->PhysicalEnd) ||
+      (NumberOfPages * PageSize > mContext->ChunkSize))
+  {
+    mBadCall = TRUE;
+    return EFI_SUCCESS;
+  }
+
+  Offset = StartAddress - mContext->PhysicalAddress;
+  Chunk  = DivU64x64Remainder (Offset, mContext->ChunkSize, &Index);
+  if ((Index != 0) || (ModU64x32 (Chunk, mContext->CpusNum) != mCpuIndex)) {
+    mBadCall = TRUE;
+    return EFI_SUCCESS;
+  }
+
+  //
+  // a partial chunk is only allowed at the end of the range
+  //
+  if ((NumberOfPages * PageSize < mContext->ChunkSize) &&
+      (StartAddress + NumberOfPages * PageSize != mContext->PhysicalEnd))
+  {
+    mBadCall = TRUE;
+    return EFI_SUCCESS;
+  }
+
+  Page = DivU64x32 (Offset, PageSize);
+  for (Index = 0; Index < NumberOfPages; Index++) {
+    if (Page + Index >= TEST_MAX_PAGES) {
+      mBadCall = TRUE;
+      return EFI_SUCCESS;
+    }
+
+    mAcceptCount[Page + Index]++;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Accept a range with every vCPU, and check that each page is accepted
+  exactly once, in chunks that belong to the vCPU accepting them.
+
+  @param[in]  Context    [Optional] An optional parameter that enables:
+                         1) test-case reuse with varied parameters and
+                         2) test-case re-entry for Target tests that need a
+                         reboot.  This parameter is a VOID* and it is the
+                         responsibility of the test author to ensure that the
+                         contents are well understood by all test cases that may
+                         consume it.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+AcceptEveryPageOnceTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  ACCEPT_CHUNKS_TEST_CONTEXT  *TestContext;
+  EFI_STATUS                  Status;
+  UINT64                      Pages;
+  UINT64                      Index;
+
+  TestContext = (ACCEPT_CHUNKS_TEST_CONTEXT *)Context;
+  Pages       = DivU64x32 (TestContext->PhysicalEnd - TestContext->PhysicalAddress, TestContext->PageSize);
+  UT_ASSERT_TRUE (Pages <= TEST_MAX_PAGES);
+
+  ResetMockAcceptPages (TestContext);
+
+  for (mCpuIndex = 0; mCpuIndex < TestContext->CpusNum; mCpuIndex++) {
+    Status = AcceptMemoryChunks (
+               mCpuIndex,
+               TestContext->CpusNum,
+               TestContext->PhysicalAddress,
+               TestContext->PhysicalEnd,
+               TestContext->ChunkSize,
+               TestContext->PageSize,
+               MockAcceptPages
+               );
+    UT_ASSERT_NOT_EFI_ERROR (Status);
+  }
+
+  UT_ASSERT_FALSE (mBadCall);
+
+  for (Index = 0; Index < Pages; Index++) {
+    UT_ASSERT_EQUAL (mAcceptCount[Index], 1);
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  A vCPU whose first chunk starts past the end of the range accepts nothing.
+
+  @param[in]  Context    [Optional] An optional parameter that enables:
+                         1) test-case reuse with varied parameters and
+                         2) test-case re-entry for Target tests that need a
+                         reboot.  This parameter is a VOID* and it is the
+                         responsibility of the test author to ensure that the
+                         contents are well understood by all test cases that may
+                         consume it.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+NoChunkForCpuTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EFI_STATUS  Status;
+
+  ResetMockAcceptPages (&mAcceptFewChunks);
+
+  mCpuIndex = 3;
+  Status    = AcceptMemoryChunks (
+                mCpuIndex,
+                mAcceptFewChunks.CpusNum,
+                mAcceptFewChunks.PhysicalAddress,
+                mAcceptFewChunks.PhysicalEnd,
+                mAcceptFewChunks.ChunkSize,
+                mAcceptFewChunks.PageSize,
+                MockAcceptPages
+                );
+  UT_ASSERT_NOT_EFI_ERROR (Status);
+  UT_ASSERT_EQUAL (mCalls, 0);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  An error from the accept function is returned, and no further chunks are
+  accepted after it.
+
+  @param[in]  Context    [Optional] An optional parameter that enables:
+                         1) test-case reuse with varied parameters and
+                         2) test-case re-entry for Target tests that need a
+                         reboot.  This parameter is a VOID* and it is the
+                         responsibility of the test author to ensure that the
+                         contents are well understood by all test cases that may
+                         consume it.
+
+  @retval  UNIT_TEST_PASSED             The Unit test has completed and the test
+                                        case was successful.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+AcceptErrorTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EFI_STATUS  Status;
+
+  ResetMockAcceptPages (&mAccept4KPages);
+
+  mCpuIndex = 1;
+  mFailCall = 2;
+  Status    = AcceptMemoryChunks (
+                mCpuIndex,
+                mAccept4KPages.CpusNum,
+                mAccept4KPages.PhysicalAddress,
+                mAccept4KPages.PhysicalEnd,
+                mAccept4KPages.ChunkSize,
+                mAccept4KPages.PageSize,
+                MockAcceptPages
+                );
+  UT_ASSERT_STATUS_EQUAL (Status, EFI_DEVICE_ERROR);
+  UT_ASSERT_EQUAL (mCalls, 2);
+  UT_ASSERT_FALSE (mBadCall);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for
+  AcceptMemoryChunks() and run the unit tests.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      AcceptTests;
+
+  Framework = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  //
+  // Start setting up the test framework for running the tests.
+  //
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  //
+  // Populate the AcceptMemoryChunks Unit Test Suite.
+  //
+  Status = CreateUnitTestSuite (&AcceptTests, Framework, "AcceptMemoryChunks", "PlatformInitLib.AcceptMemoryChunks", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for AcceptMemoryChunks\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  // --------------Suite--------Description------------------------------------Class Name-------------Function------------------Pre---Post--Context-------------
+  AddTestCase (AcceptTests, "2M pages are accepted once by the owning vCPU", "Accept2MPages", AcceptEveryPageOnceTest, NULL, NULL, &mAccept2MPages);
+  AddTestCase (AcceptTests, "4K pages are accepted once by the owning vCPU", "Accept4KPages", AcceptEveryPageOnceTest, NULL, NULL, &mAccept4KPages);
+  AddTestCase (AcceptTests, "More vCPUs than chunks", "AcceptFewChunks", AcceptEveryPageOnceTest, NULL, NULL, &mAcceptFewChunks);
+  AddTestCase (AcceptTests, "A single vCPU accepts every chunk", "AcceptOneCpu", AcceptEveryPageOnceTest, NULL, NULL, &mAcceptOneCpu);
+  AddTestCase (AcceptTests, "A vCPU without a chunk accepts nothing", "NoChunkForCpu", NoChunkForCpuTest, NULL, NULL, NULL);
+  AddTestCase (AcceptTests, "An accept error stops the vCPU", "AcceptError", AcceptErrorTest, NULL, NULL, NULL);
+
+  //
+  // Execute the tests.
+  //
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  return Status;
+}
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+**/
+int
+main (
+  int   argc,
+  char  *argv[]
+  )
+{
+  return UnitTestingEntry ();
+}
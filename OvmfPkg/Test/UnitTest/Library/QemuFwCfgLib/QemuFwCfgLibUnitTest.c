@@ -0,0 +1,857 @@
+/** @file
+  Unit tests of the file directory cache and of QemuFwCfgReadItems() in the
+  PEI instance of QemuFwCfgLib.
+
+  The library is linked against a mock fw_cfg device, which implements the
+  selector and data IO ports and the DMA interface on top of a generated file
+  directory, and counts every access. The HOB and PPI services the library
+  uses are mocked as well.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <PiPei.h>
+
+#include <Guid/QemuFwCfgFileCacheHob.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/HobLib.h>
+#include <Library/IoLib.h>
+#include <Library/MemEncryptSevLib.h>
+#include <Library/PeiServicesLib.h>
+#include <Library/QemuFwCfgLib.h>
+#include <Library/UnitTestLib.h>
+#include <Ppi/MemoryDiscovered.h>
+
+#include "../../../../Library/QemuFwCfgLib/QemuFwCfgLibInternal.h"
+
+#define UNIT_TEST_APP_NAME     "QemuFwCfgLib Unit Test Application"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+//
+// Number of files in the mock file directory. Larger than the number of hash
+// buckets, so that some buckets hold more than one file.
+//
+#define MOCK_FILE_COUNT  100
+
+//
+// Selector of the first file of the mock file directory
+//
+#define MOCK_FILE_SELECT_BASE  0x0020
+
+//
+// The last file of the directory repeats the name of this one, with a
+// different selector. Lookups must find this one, as a linear scan would.
+//
+#define MOCK_DUPLICATE_FILE  7
+
+//
+// Largest size in bytes of the HOBs the mock HOB list can hold
+//
+#define MOCK_HOB_MAX_SIZE  SIZE_64KB
+
+typedef struct {
+  BOOLEAN    DmaSupported;
+  BOOLEAN    MemoryDiscovered;
+} FW_CFG_TEST_CONTEXT;
+
+//
+// IO port access, file directory cached in a HOB
+//
+FW_CFG_TEST_CONTEXT  mFwCfgIoPort = {
+  FALSE,
+  TRUE
+};
+
+//
+// DMA access, file directory cached in a HOB
+//
+FW_CFG_TEST_CONTEXT  mFwCfgDma = {
+  TRUE,
+  TRUE
+};
+
+//
+// DMA access before permanent memory, no file directory cache
+//
+FW_CFG_TEST_CONTEXT  mFwCfgTemporaryRam = {
+  TRUE,
+  FALSE
+};
+
+//
+// The mock fw_cfg device
+//
+STATIC BOOLEAN  mDeviceDmaSupported;
+STATIC UINT16   mDeviceSelect;
+STATIC UINTN    mDeviceOffset;
+STATIC UINT32   mDeviceDmaAddressHigh;
+STATIC UINT8    mDeviceFileDir[sizeof (UINT32) + MOCK_FILE_COUNT * sizeof (QEMU_FW_CFG_CACHED_FILE)];
+
+//
+// Accesses to the mock fw_cfg device
+//
+STATIC UINTN  mSelectorWrites;
+STATIC UINTN  mDataReads;
+STATIC UINTN  mDmaRequests;
+STATIC UINTN  mFileDirSelects;
+
+//
+// The mock HOB list, which holds at most one GUID HOB
+//
+STATIC BOOLEAN            mMemoryDiscovered;
+STATIC EFI_HOB_GUID_TYPE  *mGuidHob;
+STATIC UINT64             mHobStore[MOCK_HOB_MAX_SIZE / sizeof (UINT64)];
+STATIC UINT64             mHobCopy[MOCK_HOB_MAX_SIZE / sizeof (UINT64)];
+
+/**
+  Writes the name of a file of the mock file directory.
+
+  @param[in]  Index  Index of the file in the directory.
+  @param[out] Name   Receives the NUL-terminated name.
+**/
+STATIC
+VOID
+MockFileName (
+  IN  UINTN  Index,
+  OUT CHAR8  Name[QEMU_FW_CFG_FNAME_SIZE]
+  )
+{
+  if (Index == MOCK_FILE_COUNT - 1) {
+    Index = MOCK_DUPLICATE_FILE;
+  }
+
+  ZeroMem (Name, QEMU_FW_CFG_FNAME_SIZE);
+  AsciiStrCpyS (Name, QEMU_FW_CFG_FNAME_SIZE, "opt/test/file-000");
+  Name[14] = (CHAR8)('0' + Index / 100);
+  Name[15] = (CHAR8)('0' + Index / 10 % 10);
+  Name[16] = (CHAR8)('0' + Index % 10);
+}
+
+/**
+  Returns the size of a file of the mock file directory.
+
+  @param[in] Index  Index of the file in the directory.
+
+  @return  The size of the file in bytes.
+**/
+STATIC
+UINT32
+MockFileSize (
+  IN UINTN  Index
+  )
+{
+  return (UINT32)(Index * 3 + 1);
+}
+
+/**
+  Returns a byte of a mock fw_cfg item.
+
+  @param[in] Select  The item.
+  @param[in] Offset  Offset of the byte in the item.
+
+  @return  The byte, or zero past the end of the item, as QEMU returns.
+**/
+STATIC
+UINT8
+MockItemByte (
+  IN UINT16  Select,
+  IN UINTN   Offset
+  )
+{
+  STATIC CONST CHAR8  Signature[] = "QEMU";
+  UINT32              Revision;
+
+  switch (Select) {
+    case QemuFwCfgItemSignature:
+      return (Offset < 4) ? (UINT8)Signature[Offset] : 0;
+
+    case QemuFwCfgItemInterfaceVersion:
+      Revision = mDeviceDmaSupported ? (1 | FW_CFG_F_DMA) : 1;
+      return (Offset < sizeof (Revision)) ? ((UINT8 *)&Revision)[Offset] : 0;
+
+    case QemuFwCfgItemFileDir:
+      return (Offset < sizeof (mDeviceFileDir)) ? mDeviceFileDir[Offset] : 0;
+
+    default:
+      if ((Select >= MOCK_FILE_SELECT_BASE) &&
+          (Select < MOCK_FILE_SELECT_BASE + MOCK_FILE_COUNT) &&
+          (Offset < MockFileSize (Select - MOCK_FILE_SELECT_BASE)))
+      {
+        return (UINT8)(Select ^ Offset ^ 0x5A);
+      }
+
+      return 0;
+  }
+}
+
+/**
+  Selects an item of the mock fw_cfg device.
+
+  @param[in] Select  The item.
+**/
+STATIC
+VOID
+MockSelectItem (
+  IN UINT16  Select
+  )
+{
+  mDeviceSelect = Select;
+  mDeviceOffset = 0;
+  if (Select == QemuFwCfgItemFileDir) {
+    mFileDirSelects++;
+  }
+}
+
+/**
+  Reads bytes of the selected item of the mock fw_cfg device.
+
+  @param[in]  Size    Number of bytes to read.
+  @param[out] Buffer  Receives the bytes, may be NULL to skip them.
+**/
+STATIC
+VOID
+MockReadItem (
+  IN  UINTN  Size,
+  OUT UINT8  *Buffer OPTIONAL
+  )
+{
+  UINTN  Idx;
+
+  for (Idx = 0; Idx < Size; Idx++) {
+    if (Buffer != NULL) {
+      Buffer[Idx] = MockItemByte (mDeviceSelect, mDeviceOffset);
+    }
+
+    mDeviceOffset++;
+  }
+}
+
+/**
+  Builds the mock fw_cfg device.
+
+  @param[in] DmaSupported  Whether the device provides the DMA interface.
+**/
+STATIC
+VOID
+MockDeviceInit (
+  IN BOOLEAN  DmaSupported
+  )
+{
+  QEMU_FW_CFG_CACHED_FILE  *File;
+  UINTN                    Idx;
+
+  mDeviceDmaSupported   = DmaSupported;
+  mDeviceSelect         = QemuFwCfgItemSignature;
+  mDeviceOffset         = 0;
+  mDeviceDmaAddressHigh = 0;
+
+  //
+  // The file directory is encoded in big endian.
+  //
+  *(UINT32 *)mDeviceFileDir = SwapBytes32 (MOCK_FILE_COUNT);
+  File                      = (QEMU_FW_CFG_CACHED_FILE *)(mDeviceFileDir + sizeof (UINT32));
+  for (Idx = 0; Idx < MOCK_FILE_COUNT; Idx++) {
+    File[Idx].Size   = SwapBytes32 (MockFileSize (Idx));
+    File[Idx].Select = SwapBytes16 ((UINT16)(MOCK_FILE_SELECT_BASE + Idx));
+    File[Idx].Next   = 0;
+    MockFileName (Idx, File[Idx].Name);
+  }
+}
+
+/**
+  Clears the counters of the accesses to the mock fw_cfg device.
+**/
+STATIC
+VOID
+MockResetCounters (
+  VOID
+  )
+{
+  mSelectorWrites = 0;
+  mDataReads      = 0;
+  mDmaRequests    = 0;
+  mFileDirSelects = 0;
+}
+
+/**
+  Mock of the selector port write of the fw_cfg device.
+
+  @param[in] Port   The port.
+  @param[in] Value  The item to select.
+
+  @return  Value.
+**/
+UINT16
+EFIAPI
+IoWrite16 (
+  IN      UINTN   Port,
+  IN      UINT16  Value
+  )
+{
+  ASSERT (Port == FW_CFG_IO_SELECTOR);
+  mSelectorWrites++;
+  MockSelectItem (Value);
+  return Value;
+}
+
+/**
+  Mock of the DMA address port writes of the fw_cfg device. Writing the low
+  half of the address processes the request synchronously.
+
+  @param[in] Port   The port.
+  @param[in] Value  Half of the big endian address of the FW_CFG_DMA_ACCESS.
+
+  @return  Value.
+**/
+UINT32
+EFIAPI
+IoWrite32 (
+  IN      UINTN   Port,
+  IN      UINT32  Value
+  )
+{
+  volatile FW_CFG_DMA_ACCESS  *Access;
+  UINT32                      Control;
+  UINT32                      Length;
+
+  if (Port == FW_CFG_IO_DMA_ADDRESS) {
+    mDeviceDmaAddressHigh = SwapBytes32 (Value);
+    return Value;
+  }
+
+  ASSERT (Port == FW_CFG_IO_DMA_ADDRESS + 4);
+  ASSERT (mDeviceDmaSupported);
+  mDmaRequests++;
+
+  Access = (volatile FW_CFG_DMA_ACCESS *)(UINTN)(LShiftU64 (mDeviceDmaAddressHigh, 32) |
+                                                 SwapBytes32 (Value));
+  Control = SwapBytes32 (Access->Control);
+  Length  = SwapBytes32 (Access->Length);
+
+  if ((Control & FW_CFG_DMA_CTL_SELECT) != 0) {
+    MockSelectItem ((UINT16)(Control >> 16));
+  }
+
+  switch (FW_CFG_DMA_CTL_OPERATION (Control)) {
+    case FW_CFG_DMA_CTL_READ:
+      MockReadItem (Length, (UINT8 *)(UINTN)SwapBytes64 (Access->Address));
+      break;
+
+    case FW_CFG_DMA_CTL_SKIP:
+    case FW_CFG_DMA_CTL_WRITE:
+      MockReadItem (Length, NULL);
+      break;
+
+    default:
+      Access->Control = SwapBytes32 (FW_CFG_DMA_CTL_ERROR);
+      return Value;
+  }
+
+  Access->Control = 0;
+  return Value;
+}
+
+/**
+  Mock of the data port reads of the fw_cfg device.
+
+  @param[in]  Port    The port.
+  @param[in]  Count   Number of bytes to read.
+  @param[out] Buffer  Receives the bytes.
+**/
+VOID
+EFIAPI
+IoReadFifo8 (
+  IN      UINTN  Port,
+  IN      UINTN  Count,
+  OUT     VOID   *Buffer
+  )
+{
+  ASSERT (Port == FW_CFG_IO_DATA);
+  mDataReads++;
+  MockReadItem (Count, Buffer);
+}
+
+/**
+  Mock of the data port writes of the fw_cfg device, which ignores the data.
+
+  @param[in] Port    The port.
+  @param[in] Count   Number of bytes to write.
+  @param[in] Buffer  The bytes.
+**/
+VOID
+EFIAPI
+IoWriteFifo8 (
+  IN      UINTN  Port,
+  IN      UINTN  Count,
+  IN      VOID   *Buffer
+  )
+{
+  ASSERT (Port == FW_CFG_IO_DATA);
+  MockReadItem (Count, NULL);
+}
+
+/**
+  Mock that reports a guest without SEV.
+
+  @retval FALSE  SEV is not enabled.
+**/
+BOOLEAN
+EFIAPI
+MemEncryptSevIsEnabled (
+  VOID
+  )
+{
+  return FALSE;
+}
+
+/**
+  Mock that only knows the memory discovered PPI, which is installed if the
+  test context says so.
+
+  @param[in]     Guid           The PPI to locate.
+  @param[in]     Instance       The instance of the PPI.
+  @param[in,out] PpiDescriptor  Receives the PPI descriptor, ignored.
+  @param[in,out] Ppi            Receives the PPI.
+
+  @retval EFI_SUCCESS    The PPI is installed.
+  @retval EFI_NOT_FOUND  The PPI is not installed.
+**/
+EFI_STATUS
+EFIAPI
+PeiServicesLocatePpi (
+  IN CONST EFI_GUID              *Guid,
+  IN UINTN                       Instance,
+  IN OUT EFI_PEI_PPI_DESCRIPTOR  **PpiDescriptor  OPTIONAL,
+  IN OUT VOID                    **Ppi
+  )
+{
+  if (!mMemoryDiscovered || (Instance != 0) ||
+      !CompareGuid (Guid, &gEfiPeiMemoryDiscoveredPpiGuid))
+  {
+    return EFI_NOT_FOUND;
+  }
+
+  *Ppi = &mMemoryDiscovered;
+  return EFI_SUCCESS;
+}
+
+/**
+  Mock that returns the GUID HOB of the mock HOB list.
+
+  @param[in] Guid  The GUID of the HOB.
+
+  @return  The HOB, or NULL if the mock HOB list holds no HOB with Guid.
+**/
+VOID *
+EFIAPI
+GetFirstGuidHob (
+  IN CONST EFI_GUID  *Guid
+  )
+{
+  if ((mGuidHob == NULL) || !CompareGuid (Guid, &mGuidHob->Name)) {
+    return NULL;
+  }
+
+  return mGuidHob;
+}
+
+/**
+  Mock that builds the GUID HOB of the mock HOB list.
+
+  @param[in] Guid        The GUID of the HOB.
+  @param[in] DataLength  Size of the data of the HOB.
+
+  @return  The data of the HOB, or NULL if the mock HOB list is full.
+**/
+VOID *
+EFIAPI
+BuildGuidHob (
+  IN CONST EFI_GUID  *Guid,
+  IN UINTN           DataLength
+  )
+{
+  UINTN  HobLength;
+
+  HobLength = sizeof (EFI_HOB_GUID_TYPE) + ALIGN_VALUE (DataLength, 8);
+  if ((mGuidHob != NULL) || (HobLength > sizeof (mHobStore))) {
+    return NULL;
+  }
+
+  mGuidHob                   = (EFI_HOB_GUID_TYPE *)mHobStore;
+  mGuidHob->Header.HobType   = EFI_HOB_TYPE_GUID_EXTENSION;
+  mGuidHob->Header.HobLength = (UINT16)HobLength;
+  mGuidHob->Header.Reserved  = 0;
+  CopyGuid (&mGuidHob->Name, Guid);
+  return mGuidHob + 1;
+}
+
+/**
+  Sets up the mock fw_cfg device and HOB list, and initializes the library.
+
+  @param[in] Context  The FW_CFG_TEST_CONTEXT of the test.
+
+  @retval UNIT_TEST_PASSED                      The library is ready.
+  @retval UNIT_TEST_ERROR_PREREQUISITE_NOT_MET  The library found no fw_cfg.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+FwCfgTestSetup (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  FW_CFG_TEST_CONTEXT  *TestContext;
+
+  TestContext = (FW_CFG_TEST_CONTEXT *)Context;
+
+  MockDeviceInit (TestContext->DmaSupported);
+  mMemoryDiscovered = TestContext->MemoryDiscovered;
+  mGuidHob          = NULL;
+
+  QemuFwCfgInitialize ();
+  if (!QemuFwCfgIsAvailable ()) {
+    return UNIT_TEST_ERROR_PREREQUISITE_NOT_MET;
+  }
+
+  MockResetCounters ();
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Looks up every file of the mock file directory, and a few absent names.
+
+  @retval UNIT_TEST_PASSED             Every lookup returned the expected file.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  A lookup failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+LookUpEveryFile (
+  VOID
+  )
+{
+  RETURN_STATUS         Status;
+  UINTN                 Idx;
+  UINTN                 Expected;
+  CHAR8                 Name[QEMU_FW_CFG_FNAME_SIZE];
+  FIRMWARE_CONFIG_ITEM  Item;
+  UINTN                 Size;
+
+  for (Idx = 0; Idx < MOCK_FILE_COUNT; Idx++) {
+    MockFileName (Idx, Name);
+    Status = QemuFwCfgFindFile (Name, &Item, &Size);
+    UT_ASSERT_NOT_EFI_ERROR (Status);
+
+    //
+    // A duplicated name resolves to its first entry.
+    //
+    Expected = (Idx == MOCK_FILE_COUNT - 1) ? MOCK_DUPLICATE_FILE : Idx;
+    UT_ASSERT_EQUAL (Item, MOCK_FILE_SELECT_BASE + Expected);
+    UT_ASSERT_EQUAL (Size, MockFileSize (Expected));
+  }
+
+  UT_ASSERT_STATUS_EQUAL (QemuFwCfgFindFile ("opt/test/file-999", &Item, &Size), RETURN_NOT_FOUND);
+  UT_ASSERT_STATUS_EQUAL (QemuFwCfgFindFile ("opt/test/file-00", &Item, &Size), RETURN_NOT_FOUND);
+  UT_ASSERT_STATUS_EQUAL (QemuFwCfgFindFile ("opt/test/file-0000", &Item, &Size), RETURN_NOT_FOUND);
+  UT_ASSERT_STATUS_EQUAL (QemuFwCfgFindFile ("", &Item, &Size), RETURN_NOT_FOUND);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Present files are found, and absent ones are not, whether or not the file
+  directory is cached.
+
+  @param[in] Context  The FW_CFG_TEST_CONTEXT of the test.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+FindFileTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  FW_CFG_TEST_CONTEXT  *TestContext;
+  UNIT_TEST_STATUS     TestStatus;
+
+  TestContext = (FW_CFG_TEST_CONTEXT *)Context;
+
+  TestStatus = LookUpEveryFile ();
+  if (TestStatus != UNIT_TEST_PASSED) {
+    return TestStatus;
+  }
+
+  if (TestContext->MemoryDiscovered) {
+    UT_ASSERT_EQUAL (mFileDirSelects, 1);
+    UT_ASSERT_NOT_NULL (mGuidHob);
+  } else {
+    //
+    // Without permanent memory, each lookup scans the file directory.
+    //
+    UT_ASSERT_EQUAL (mFileDirSelects, MOCK_FILE_COUNT + 4);
+    UT_ASSERT_TRUE (mGuidHob == NULL);
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Once the file directory is cached, lookups do not access fw_cfg at all.
+
+  @param[in] Context  The FW_CFG_TEST_CONTEXT of the test.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+FindFileCacheHitTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  FIRMWARE_CONFIG_ITEM  Item;
+  UINTN                 Size;
+  UNIT_TEST_STATUS      TestStatus;
+
+  UT_ASSERT_NOT_EFI_ERROR (QemuFwCfgFindFile ("opt/test/file-042", &Item, &Size));
+  UT_ASSERT_EQUAL (mFileDirSelects, 1);
+
+  MockResetCounters ();
+  TestStatus = LookUpEveryFile ();
+  if (TestStatus != UNIT_TEST_PASSED) {
+    return TestStatus;
+  }
+
+  UT_ASSERT_EQUAL (mFileDirSelects, 0);
+  UT_ASSERT_EQUAL (mSelectorWrites, 0);
+  UT_ASSERT_EQUAL (mDataReads, 0);
+  UT_ASSERT_EQUAL (mDmaRequests, 0);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  The file directory cache works from a copy of its HOB, as the DXE instance
+  of the library uses it.
+
+  @param[in] Context  The FW_CFG_TEST_CONTEXT of the test.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+FileCacheHobRoundTripTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  FIRMWARE_CONFIG_ITEM  Item;
+  UINTN                 Size;
+  UNIT_TEST_STATUS      TestStatus;
+
+  UT_ASSERT_NOT_EFI_ERROR (QemuFwCfgFindFile ("opt/test/file-000", &Item, &Size));
+  UT_ASSERT_NOT_NULL (GetFirstGuidHob (&gQemuFwCfgFileCacheHobGuid));
+  UT_ASSERT_TRUE (
+    GET_GUID_HOB_DATA_SIZE (mGuidHob) >=
+    sizeof (QEMU_FW_CFG_FILE_CACHE) + MOCK_FILE_COUNT * sizeof (QEMU_FW_CFG_CACHED_FILE)
+    );
+  UT_ASSERT_EQUAL (((QEMU_FW_CFG_FILE_CACHE *)GET_GUID_HOB_DATA (mGuidHob))->FileCount, MOCK_FILE_COUNT);
+
+  //
+  // Move the HOB, and scribble over its old location. The cache holds no
+  // pointers, so lookups through the copy still succeed.
+  //
+  CopyMem (mHobCopy, mGuidHob, mGuidHob->Header.HobLength);
+  SetMem (mHobStore, sizeof (mHobStore), 0xAF);
+  mGuidHob = (EFI_HOB_GUID_TYPE *)mHobCopy;
+
+  MockResetCounters ();
+  TestStatus = LookUpEveryFile ();
+  if (TestStatus != UNIT_TEST_PASSED) {
+    return TestStatus;
+  }
+
+  UT_ASSERT_EQUAL (mFileDirSelects, 0);
+  UT_ASSERT_EQUAL (mSelectorWrites, 0);
+  UT_ASSERT_EQUAL (mDataReads, 0);
+  UT_ASSERT_EQUAL (mDmaRequests, 0);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  QemuFwCfgReadItems() reads each item from its start, with one DMA request
+  per item when DMA is available.
+
+  @param[in] Context  The FW_CFG_TEST_CONTEXT of the test.
+
+  @retval UNIT_TEST_PASSED             The test passed.
+  @retval UNIT_TEST_ERROR_TEST_FAILED  The test failed.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+ReadItemsTest (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  FW_CFG_TEST_CONTEXT    *TestContext;
+  UINT8                  Buffer0[MOCK_FILE_COUNT * 3];
+  UINT8                  Buffer1[16];
+  UINT8                  Buffer2[4];
+  QEMU_FW_CFG_READ_ITEM  Items[3];
+  UINTN                  Idx;
+  UINTN                  Offset;
+
+  TestContext = (FW_CFG_TEST_CONTEXT *)Context;
+
+  //
+  // Leave the first item selected and partially read.
+  //
+  QemuFwCfgSelectItem (MOCK_FILE_SELECT_BASE + 50);
+  QemuFwCfgSkipBytes (7);
+  MockResetCounters ();
+
+  SetMem (Buffer0, sizeof (Buffer0), 0xCC);
+  SetMem (Buffer1, sizeof (Buffer1), 0xCC);
+  SetMem (Buffer2, sizeof (Buffer2), 0xCC);
+
+  Items[0].Item   = MOCK_FILE_SELECT_BASE + 50;
+  Items[0].Size   = MockFileSize (50);
+  Items[0].Buffer = Buffer0;
+
+  //
+  // Reading past the end of an item yields zeroes.
+  //
+  Items[1].Item   = MOCK_FILE_SELECT_BASE + 2;
+  Items[1].Size   = sizeof (Buffer1);
+  Items[1].Buffer = Buffer1;
+
+  Items[2].Item   = QemuFwCfgItemSignature;
+  Items[2].Size   = sizeof (Buffer2);
+  Items[2].Buffer = Buffer2;
+
+  QemuFwCfgReadItems (ARRAY_SIZE (Items), Items);
+
+  for (Idx = 0; Idx < ARRAY_SIZE (Items); Idx++) {
+    for (Offset = 0; Offset < Items[Idx].Size; Offset++) {
+      UT_ASSERT_EQUAL (
+        ((UINT8 *)Items[Idx].Buffer)[Offset],
+        MockItemByte ((UINT16)Items[Idx].Item, Offset)
+        );
+    }
+  }
+
+  UT_ASSERT_EQUAL (Buffer0[Items[0].Size], 0xCC);
+  UT_ASSERT_MEM_EQUAL (Buffer2, "QEMU", 4);
+
+  if (TestContext->DmaSupported) {
+    //
+    // Each item is selected and read with a single DMA request.
+    //
+    UT_ASSERT_EQUAL (mDmaRequests, ARRAY_SIZE (Items));
+    UT_ASSERT_EQUAL (mSelectorWrites, 0);
+    UT_ASSERT_EQUAL (mDataReads, 0);
+  } else {
+    UT_ASSERT_EQUAL (mDmaRequests, 0);
+    UT_ASSERT_EQUAL (mSelectorWrites, ARRAY_SIZE (Items));
+    UT_ASSERT_EQUAL (mDataReads, ARRAY_SIZE (Items));
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for QemuFwCfgLib
+  and run the unit tests.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      FindFileTests;
+  UNIT_TEST_SUITE_HANDLE      ReadItemsTests;
+
+  Framework = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  //
+  // Start setting up the test framework for running the tests.
+  //
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  //
+  // Populate the QemuFwCfgFindFile Unit Test Suite.
+  //
+  Status = CreateUnitTestSuite (&FindFileTests, Framework, "QemuFwCfgFindFile", "QemuFwCfgLib.FindFile", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for QemuFwCfgFindFile\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  // --------------Suite----------Description------------------------------------------Class Name-------------Function-------------------Pre-------------Post--Context-----------------
+  AddTestCase (FindFileTests, "Hashed lookup of present and absent files", "FindFileCached", FindFileTest, FwCfgTestSetup, NULL, &mFwCfgDma);
+  AddTestCase (FindFileTests, "Hashed lookup through the IO port", "FindFileIoPort", FindFileTest, FwCfgTestSetup, NULL, &mFwCfgIoPort);
+  AddTestCase (FindFileTests, "Scanning lookup before permanent memory", "FindFileScan", FindFileTest, FwCfgTestSetup, NULL, &mFwCfgTemporaryRam);
+  AddTestCase (FindFileTests, "A cache hit does not access fw_cfg", "FindFileCacheHit", FindFileCacheHitTest, FwCfgTestSetup, NULL, &mFwCfgDma);
+  AddTestCase (FindFileTests, "The cache works from a copy of its HOB", "FileCacheHobRoundTrip", FileCacheHobRoundTripTest, FwCfgTestSetup, NULL, &mFwCfgDma);
+
+  //
+  // Populate the QemuFwCfgReadItems Unit Test Suite.
+  //
+  Status = CreateUnitTestSuite (&ReadItemsTests, Framework, "QemuFwCfgReadItems", "QemuFwCfgLib.ReadItems", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for QemuFwCfgReadItems\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  AddTestCase (ReadItemsTests, "Read several items with one DMA request each", "ReadItemsDma", ReadItemsTest, FwCfgTestSetup, NULL, &mFwCfgDma);
+  AddTestCase (ReadItemsTests, "Read several items through the IO port", "ReadItemsIoPort", ReadItemsTest, FwCfgTestSetup, NULL, &mFwCfgIoPort);
+
+  //
+  // Execute the tests.
+  //
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  return Status;
+}
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+**/
+int
+main (
+  int   argc,
+  char  *argv[]
+  )
+{
+  return UnitTestingEntry ();
+}
@@ -15,6 +15,14 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/HashLib.h>
 #include <Protocol/Tcg2Protocol.h>
 
+#include "HashLibBaseCryptoRouterCommon.h"
+
+//
+// Size of the data chunks fed to every hash engine in turn. It is a multiple
+// of all the hash block sizes and small enough to stay in the L1/L2 cache.
+//
+#define HASH_UPDATE_CHUNK_SIZE  SIZE_16KB
+
 typedef struct {
   EFI_GUID    Guid;
   UINT32      Mask;
@@ -72,3 +80,51 @@ Tpm2SetHashToDigestList (
     );
   DigestList->count++;
 }
+
+/**
+  Update the active hash engines with the same data.
+
+  The data is fed to the engines in chunks that fit in the CPU cache, each
+  chunk going through all active engines before the next one is read, so the
+  data is streamed from memory once for all engines instead of once per
+  engine.
+
+  @param HashInterface      Hash interfaces.
+  @param HashInterfaceCount Count of hash interfaces.
+  @param HashCtx            Hash contexts, one per hash interface.
+  @param HashMask           Mask of the active hash algorithms.
+  @param DataToHash         Data to be hashed.
+  @param DataToHashLen      Data size.
+**/
+VOID
+HashUpdateAllEngines (
+  IN HASH_INTERFACE  *HashInterface,
+  IN UINTN           HashInterfaceCount,
+  IN HASH_HANDLE     *HashCtx,
+  IN UINT32          HashMask,
+  IN UINT8           *DataToHash,
+  IN UINTN           DataToHashLen
+  )
+{
+  BOOLEAN  Active[HASH_COUNT];
+  UINTN    Index;
+  UINTN    ChunkSize;
+
+  ASSERT (HashInterfaceCount <= HASH_COUNT);
+
+  for (Index = 0; Index < HashInterfaceCount; Index++) {
+    Active[Index] = (BOOLEAN)((Tpm2GetHashMaskFromAlgo (&HashInterface[Index].HashGuid) & HashMask) != 0);
+  }
+
+  do {
+    ChunkSize = MIN (DataToHashLen, HASH_UPDATE_CHUNK_SIZE);
+    for (Index = 0; Index < HashInterfaceCount; Index++) {
+      if (Active[Index]) {
+        HashInterface[Index].HashUpdate (HashCtx[Index], DataToHash, ChunkSize);
+      }
+    }
+
+    DataToHash    += ChunkSize;
+    DataToHashLen -= ChunkSize;
+  } while (DataToHashLen != 0);
+}
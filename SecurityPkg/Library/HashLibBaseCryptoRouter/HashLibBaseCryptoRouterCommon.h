@@ -35,4 +35,29 @@ Tpm2SetHashToDigestList (
   IN TPML_DIGEST_VALUES      *Digest
   );
 
+/**
+  Update the active hash engines with the same data.
+
+  The data is fed to the engines in chunks that fit in the CPU cache, each
+  chunk going through all active engines before the next one is read, so the
+  data is streamed from memory once for all engines instead of once per
+  engine.
+
+  @param HashInterface      Hash interfaces.
+  @param HashInterfaceCount Count of hash interfaces.
+  @param HashCtx            Hash contexts, one per hash interface.
+  @param HashMask           Mask of the active hash algorithms.
+  @param DataToHash         Data to be hashed.
+  @param DataToHashLen      Data size.
+**/
+VOID
+HashUpdateAllEngines (
+  IN HASH_INTERFACE  *HashInterface,
+  IN UINTN           HashInterfaceCount,
+  IN HASH_HANDLE     *HashCtx,
+  IN UINT32          HashMask,
+  IN UINT8           *DataToHash,
+  IN UINTN           DataToHashLen
+  );
+
 #endif
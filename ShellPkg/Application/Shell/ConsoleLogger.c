@@ -42,6 +42,7 @@ ConsoleLoggerInstall (
   (*ConsoleInfo)->OldConHandle                = gST->ConsoleOutHandle;
   (*ConsoleInfo)->Buffer                      = NULL;
   (*ConsoleInfo)->BufferSize                  = 0;
+  (*ConsoleInfo)->HistoryTop                  = 0;
   (*ConsoleInfo)->OriginalStartRow            = 0;
   (*ConsoleInfo)->CurrentStartRow             = 0;
   (*ConsoleInfo)->RowsPerScreen               = 0;
@@ -66,6 +67,8 @@ ConsoleLoggerInstall (
   (*ConsoleInfo)->OurConOut.EnableCursor      = ConsoleLoggerEnableCursor;
   (*ConsoleInfo)->OurConOut.Mode              = gST->ConOut->Mode;
   (*ConsoleInfo)->Enabled                     = TRUE;
+  (*ConsoleInfo)->OutputBuffer                = NULL;
+  (*ConsoleInfo)->OutputBufferSize            = 0;
 
   Status = ConsoleLoggerResetBuffers (*ConsoleInfo);
   if (EFI_ERROR (Status)) {
@@ -135,6 +138,9 @@ ConsoleLoggerUninstall (
       );
   }
 
+  SHELL_FREE_NON_NULL (ConsoleInfo->OutputBuffer);
+  ConsoleInfo->OutputBufferSize = 0;
+
   gST->ConsoleOutHandle = ConsoleInfo->OldConHandle;
   gST->ConOut           = ConsoleInfo->OldConOut;
 
@@ -151,6 +157,74 @@ ConsoleLoggerUninstall (
   return (gBS->UninstallProtocolInterface (gImageHandle, &gEfiSimpleTextOutProtocolGuid, (VOID *)&ConsoleInfo->OurConOut));
 }
 
+/**
+  Convert a row number of the console history into the index of the row in
+  the history buffers.
+
+  The history buffers are used as a ring so that dropping the oldest row when
+  the history is full does not require moving the remaining rows.
+
+  @param[in] ConsoleInfo  The pointer to the instance of the console logger information.
+  @param[in] Row          The history row, where 0 is the oldest row saved.
+
+  @return The index of the row in the Buffer and Attributes arrays.
+**/
+UINTN
+ConsoleLoggerHistoryIndex (
+  IN CONSOLE_LOGGER_PRIVATE_DATA  *ConsoleInfo,
+  IN UINTN                        Row
+  )
+{
+  UINTN  TotalRows;
+  UINTN  Index;
+
+  TotalRows = ConsoleInfo->RowsPerScreen * ConsoleInfo->ScreenCount;
+  ASSERT (Row < TotalRows);
+
+  Index = ConsoleInfo->HistoryTop + Row;
+  if (Index >= TotalRows) {
+    Index -= TotalRows;
+  }
+
+  return (Index);
+}
+
+/**
+  Get the saved characters of a row of the console history.
+
+  Each row holds ColsPerScreen characters followed by 2 CHAR_NULL characters.
+
+  @param[in] ConsoleInfo  The pointer to the instance of the console logger information.
+  @param[in] Row          The history row, where 0 is the oldest row saved.
+
+  @return The first character of the row in the history buffer.
+**/
+CHAR16 *
+ConsoleLoggerHistoryText (
+  IN CONSOLE_LOGGER_PRIVATE_DATA  *ConsoleInfo,
+  IN UINTN                        Row
+  )
+{
+  return (&ConsoleInfo->Buffer[(ConsoleInfo->ColsPerScreen + 2) * ConsoleLoggerHistoryIndex (ConsoleInfo, Row)]);
+}
+
+/**
+  Get the saved attributes of a row of the console history.
+
+  @param[in] ConsoleInfo  The pointer to the instance of the console logger information.
+  @param[in] Row          The history row, where 0 is the oldest row saved.
+
+  @return The attribute of the first character of the row.
+**/
+INT32 *
+ConsoleLoggerHistoryAttributes (
+  IN CONSOLE_LOGGER_PRIVATE_DATA  *ConsoleInfo,
+  IN UINTN                        Row
+  )
+{
+  return (&ConsoleInfo->Attributes[ConsoleInfo->ColsPerScreen * ConsoleLoggerHistoryIndex (ConsoleInfo, Row)]);
+}
+
 /**
   Displays previously logged output back to the screen.
 
@@ -294,15 +368,14 @@ UpdateDisplayFromHistory (
   ConsoleInfo->OldConOut->EnableCursor (ConsoleInfo->OldConOut, FALSE);
   ConsoleInfo->OldConOut->SetCursorPosition (ConsoleInfo->OldConOut, 0, 0);
 
-  Screen     = &ConsoleInfo->Buffer[(ConsoleInfo->ColsPerScreen + 2) * ConsoleInfo->CurrentStartRow];
-  Attributes = &ConsoleInfo->Attributes[ConsoleInfo->ColsPerScreen * ConsoleInfo->CurrentStartRow];
   for ( CurrentRow = 0
         ; CurrentRow < ConsoleInfo->RowsPerScreen
-        ; CurrentRow++,
-        Screen += (ConsoleInfo->ColsPerScreen + 2),
-        Attributes += ConsoleInfo->ColsPerScreen
+        ; CurrentRow++
         )
   {
+    Screen     = ConsoleLoggerHistoryText (ConsoleInfo, ConsoleInfo->CurrentStartRow + CurrentRow);
+    Attributes = ConsoleLoggerHistoryAttributes (ConsoleInfo, ConsoleInfo->CurrentStartRow + CurrentRow);
+
     //
     // dont use the last char - prevents screen scroll
     //
@@ -463,8 +536,8 @@ AppendStringToHistory (
   )
 {
   CONST CHAR16  *Walker;
-  UINTN         CopySize;
-  UINTN         PrintIndex;
+  CHAR16        *Text;
+  INT32         *Attributes;
   UINTN         Index;
 
   ASSERT (ConsoleInfo != NULL);
@@ -489,43 +562,24 @@ AppendStringToHistory (
           ASSERT (ConsoleInfo->HistoryMode.CursorRow == (INT32)((ConsoleInfo->RowsPerScreen * ConsoleInfo->ScreenCount)-1));
 
           //
-          // scroll history attributes 'up' 1 row and set the last row to default attribute
+          // scroll history 'up' 1 row by dropping the oldest row from the ring.
+          // The dropped row becomes the last row.
           //
-          CopySize = ConsoleInfo->ColsPerScreen
-                     * ((ConsoleInfo->RowsPerScreen * ConsoleInfo->ScreenCount) - 1)
-                     * sizeof (ConsoleInfo->Attributes[0]);
-          ASSERT (CopySize < ConsoleInfo->AttribSize);
-          CopyMem (
-            ConsoleInfo->Attributes,
-            ConsoleInfo->Attributes + ConsoleInfo->ColsPerScreen,
-            CopySize
-            );
+          ConsoleInfo->HistoryTop = ConsoleLoggerHistoryIndex (ConsoleInfo, 1);
 
+          //
+          // Set that last row of chars to spaces (L' ') and default attribute
+          //
+          Text       = ConsoleLoggerHistoryText (ConsoleInfo, ConsoleInfo->HistoryMode.CursorRow);
+          Attributes = ConsoleLoggerHistoryAttributes (ConsoleInfo, ConsoleInfo->HistoryMode.CursorRow);
+          SetMem16 (Text, ConsoleInfo->ColsPerScreen * sizeof (CHAR16), L' ');
           for ( Index = 0
                 ; Index < ConsoleInfo->ColsPerScreen
                 ; Index++
                 )
           {
-            *(ConsoleInfo->Attributes + (CopySize/sizeof (ConsoleInfo->Attributes[0])) + Index) = ConsoleInfo->HistoryMode.Attribute;
+            Attributes[Index] = ConsoleInfo->HistoryMode.Attribute;
           }
-
-          //
-          // scroll history buffer 'up' 1 row and set the last row to spaces (L' ')
-          //
-          CopySize = (ConsoleInfo->ColsPerScreen + 2)
-                     * ((ConsoleInfo->RowsPerScreen * ConsoleInfo->ScreenCount) - 1)
-                     * sizeof (ConsoleInfo->Buffer[0]);
-          ASSERT (CopySize < ConsoleInfo->BufferSize);
-          CopyMem (
-            ConsoleInfo->Buffer,
-            ConsoleInfo->Buffer + (ConsoleInfo->ColsPerScreen + 2),
-            CopySize
-            );
-
-          //
-          // Set that last row of chars to spaces
-          //
-          SetMem16 (((UINT8 *)ConsoleInfo->Buffer)+CopySize, ConsoleInfo->ColsPerScreen*sizeof (CHAR16), L' ');
         } else {
           //
           // we are not on the last row
@@ -558,12 +612,12 @@ AppendStringToHistory (
         // Acrtually print characters into the history buffer
         //
 
-        PrintIndex = ConsoleInfo->HistoryMode.CursorRow * ConsoleInfo->ColsPerScreen + ConsoleInfo->HistoryMode.CursorColumn;
+        Text       = ConsoleLoggerHistoryText (ConsoleInfo, ConsoleInfo->HistoryMode.CursorRow);
+        Attributes = ConsoleLoggerHistoryAttributes (ConsoleInfo, ConsoleInfo->HistoryMode.CursorRow);
 
         for ( // no initializer needed
               ; ConsoleInfo->HistoryMode.CursorColumn < (INT32)ConsoleInfo->ColsPerScreen
               ; ConsoleInfo->HistoryMode.CursorColumn++,
-              PrintIndex++,
               Walker++
               )
         {
@@ -577,14 +631,8 @@ AppendStringToHistory (
             break;
           }
 
-          //
-          // The buffer is 2*CursorRow more since it has that many \r\n characters at the end of each row.
-          //
-
-          ASSERT (PrintIndex + ConsoleInfo->HistoryMode.CursorRow < ConsoleInfo->BufferSize);
-          ConsoleInfo->Buffer[PrintIndex + (2*ConsoleInfo->HistoryMode.CursorRow)] = *Walker;
-          ASSERT (PrintIndex < ConsoleInfo->AttribSize);
-          ConsoleInfo->Attributes[PrintIndex] = ConsoleInfo->HistoryMode.Attribute;
+          Text[ConsoleInfo->HistoryMode.CursorColumn]       = *Walker;
+          Attributes[ConsoleInfo->HistoryMode.CursorColumn] = ConsoleInfo->HistoryMode.Attribute;
         } // for loop
 
         //
@@ -697,6 +745,9 @@ ConsoleLoggerDoPageBreak (
 /**
   Worker function to handle printing the output with page breaks.
 
+  The string is forwarded to the original ConOut in as few calls as possible,
+  it is only split where the user has to be prompted for a page break.
+
   @param[in] String               The string to output
   @param[in] ConsoleInfo          The pointer to the instance of the console logger information.
 
@@ -715,20 +766,32 @@ ConsoleLoggerPrintWithPageBreak (
   IN CONSOLE_LOGGER_PRIVATE_DATA  *ConsoleInfo
   )
 {
-  CONST CHAR16  *Walker;
-  CONST CHAR16  *LineStart;
-  CHAR16        *StringCopy;
-  CHAR16        TempChar;
+  CHAR16  *Walker;
+  CHAR16  *LineStart;
+  CHAR16  TempChar;
+  UINTN   Size;
 
-  StringCopy = NULL;
-  StringCopy = StrnCatGrow (&StringCopy, NULL, String, 0);
-  if (StringCopy == NULL) {
-    return (EFI_OUT_OF_RESOURCES);
+  //
+  // Work on a copy so that page break points can be temporarily NULL
+  // terminated.  The copy buffer is kept between calls.
+  //
+  Size = StrSize (String);
+  if (Size > ConsoleInfo->OutputBufferSize) {
+    SHELL_FREE_NON_NULL (ConsoleInfo->OutputBuffer);
+    ConsoleInfo->OutputBufferSize = 0;
+    ConsoleInfo->OutputBuffer     = AllocatePool (Size);
+    if (ConsoleInfo->OutputBuffer == NULL) {
+      return (EFI_OUT_OF_RESOURCES);
+    }
+
+    ConsoleInfo->OutputBufferSize = Size;
   }
 
-  for ( Walker = StringCopy,
-        LineStart = StringCopy
-        ; Walker != NULL && *Walker != CHAR_NULL
+  CopyMem (ConsoleInfo->OutputBuffer, String, Size);
+
+  for ( Walker = ConsoleInfo->OutputBuffer,
+        LineStart = ConsoleInfo->OutputBuffer
+        ; *Walker != CHAR_NULL
         ; Walker++
         )
   {
@@ -740,27 +803,6 @@ ConsoleLoggerPrintWithPageBreak (
 
         break;
       case (CHAR_LINEFEED):
-        //
-        // add a temp NULL terminator
-        //
-        TempChar                = *(Walker + 1);
-        *((CHAR16 *)(Walker+1)) = CHAR_NULL;
-
-        //
-        // output the string
-        //
-        ConsoleLoggerOutputStringSplit (LineStart, ConsoleInfo);
-
-        //
-        // restore the temp NULL terminator to its original character
-        //
-        *((CHAR16 *)(Walker+1)) = TempChar;
-
-        //
-        // Update LineStart Variable
-        //
-        LineStart = Walker + 1;
-
         //
         // increment row count
         //
@@ -783,31 +825,6 @@ ConsoleLoggerPrintWithPageBreak (
         // check if that is the last column
         //
         if ((INTN)ConsoleInfo->ColsPerScreen == ConsoleInfo->OurConOut.Mode->CursorColumn + 1) {
-          //
-          // output a line similar to the linefeed character.
-          //
-
-          //
-          // add a temp NULL terminator
-          //
-          TempChar                = *(Walker + 1);
-          *((CHAR16 *)(Walker+1)) = CHAR_NULL;
-
-          //
-          // output the string
-          //
-          ConsoleLoggerOutputStringSplit (LineStart, ConsoleInfo);
-
-          //
-          // restore the temp NULL terminator to its original character
-          //
-          *((CHAR16 *)(Walker+1)) = TempChar;
-
-          //
-          // Update LineStart Variable
-          //
-          LineStart = Walker + 1;
-
           //
           // increment row count and zero the column
           //
@@ -823,21 +840,28 @@ ConsoleLoggerPrintWithPageBreak (
     // check if that was the last printable row.  If yes handle PageBreak mode
     //
     if ((ConsoleInfo->RowsPerScreen) -1 == ShellInfoObject.ConsoleInfo->RowCounter) {
+      //
+      // output everything up to here before prompting, using a temp NULL terminator
+      //
+      TempChar      = *(Walker + 1);
+      *(Walker + 1) = CHAR_NULL;
+      ConsoleLoggerOutputStringSplit (LineStart, ConsoleInfo);
+      *(Walker + 1) = TempChar;
+      LineStart     = Walker + 1;
+
       if (EFI_ERROR (ConsoleLoggerDoPageBreak ())) {
         //
         // We got an error which means 'break' and halt the printing
         //
-        SHELL_FREE_NON_NULL (StringCopy);
         return (EFI_DEVICE_ERROR);
       }
     }
   } // for loop
 
-  if ((LineStart != NULL) && (*LineStart != CHAR_NULL)) {
+  if (*LineStart != CHAR_NULL) {
     ConsoleLoggerOutputStringSplit (LineStart, ConsoleInfo);
   }
 
-  SHELL_FREE_NON_NULL (StringCopy);
   return (EFI_SUCCESS);
 }
 
@@ -1104,28 +1128,21 @@ ConsoleLoggerClearScreen (
   // Record console output history
   //
   if (!EFI_ERROR (Status)) {
-    Screen     = &ConsoleInfo->Buffer[(ConsoleInfo->ColsPerScreen + 2) * ConsoleInfo->CurrentStartRow];
-    Attributes = &ConsoleInfo->Attributes[ConsoleInfo->ColsPerScreen * ConsoleInfo->CurrentStartRow];
     for ( Row = ConsoleInfo->OriginalStartRow
           ; Row < (ConsoleInfo->RowsPerScreen * ConsoleInfo->ScreenCount)
           ; Row++
           )
     {
+      Screen     = ConsoleLoggerHistoryText (ConsoleInfo, Row);
+      Attributes = ConsoleLoggerHistoryAttributes (ConsoleInfo, Row);
       for ( Column = 0
             ; Column < ConsoleInfo->ColsPerScreen
-            ; Column++,
-            Screen++,
-            Attributes++
+            ; Column++
             )
       {
-        *Screen     = L' ';
-        *Attributes = ConsoleInfo->OldConOut->Mode->Attribute;
+        Screen[Column]     = L' ';
+        Attributes[Column] = ConsoleInfo->OldConOut->Mode->Attribute;
       }
-
-      //
-      // Skip the NULL on each column end in text buffer only
-      //
-      Screen += 2;
     }
 
     ConsoleInfo->HistoryMode.CursorColumn = 0;
@@ -1256,6 +1273,7 @@ ConsoleLoggerResetBuffers (
     return (Status);
   }
 
+  ConsoleInfo->HistoryTop = 0;
   ConsoleInfo->BufferSize = (ConsoleInfo->ColsPerScreen + 2) * ConsoleInfo->RowsPerScreen * ConsoleInfo->ScreenCount * sizeof (ConsoleInfo->Buffer[0]);
   ConsoleInfo->AttribSize = ConsoleInfo->ColsPerScreen * ConsoleInfo->RowsPerScreen * ConsoleInfo->ScreenCount * sizeof (ConsoleInfo->Attributes[0]);
 
@@ -20,6 +20,7 @@ typedef struct _CONSOLE_LOGGER_PRIVATE_DATA {
   UINTN                              ScreenCount;     ///< How many screens worth of data to save
   CHAR16                             *Buffer;         ///< Buffer to save data
   UINTN                              BufferSize;      ///< size of buffer in bytes
+  UINTN                              HistoryTop;      ///< Index in Buffer and Attributes of the oldest saved row
 
   //  start row is the top of the screen
   UINTN                              OriginalStartRow; ///< What the originally visible start row was
@@ -34,6 +35,9 @@ typedef struct _CONSOLE_LOGGER_PRIVATE_DATA {
   EFI_SIMPLE_TEXT_OUTPUT_MODE        HistoryMode;     ///< mode of the history log
   BOOLEAN                            Enabled;         ///< Set to FALSE when a break is requested.
   UINTN                              RowCounter;      ///< Initial row of each print job.
+
+  CHAR16                             *OutputBuffer;     ///< Scratch copy of the string being printed with page breaks
+  UINTN                              OutputBufferSize;  ///< size of OutputBuffer in bytes
 } CONSOLE_LOGGER_PRIVATE_DATA;
 
 #define CONSOLE_LOGGER_PRIVATE_DATA_FROM_THIS(a)  CR (a, CONSOLE_LOGGER_PRIVATE_DATA, OurConOut, CONSOLE_LOGGER_PRIVATE_DATA_SIGNATURE)
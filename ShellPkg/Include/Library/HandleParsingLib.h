@@ -347,6 +347,43 @@ ConvertHandleIndexToHandle (
   IN CONST UINTN  TheIndex
   );
 
+/**
+  Take a snapshot of the handle database for use by the functions of this library.
+
+  The snapshot records every handle, the protocols installed on it and the agents
+  that have those protocols open, indexed by handle, by agent and by controller.
+  Until ParseHandleDatabaseSnapshotFree() is called, ParseHandleDatabaseByRelationship()
+  and the functions built on it, ConvertHandleToHandleIndex(), ConvertHandleIndexToHandle()
+  and GetStringNameFromHandle() answer from the snapshot instead of walking the handle
+  database again on every call.
+
+  Only take a snapshot for operations that do not change the handle database.  Calls
+  may be nested; each successful call must be matched by a call to
+  ParseHandleDatabaseSnapshotFree().
+
+  @retval EFI_SUCCESS           The snapshot is in use.
+  @retval EFI_OUT_OF_RESOURCES  A memory allocation failed.  The functions keep
+                                querying the handle database directly.
+  @return other                 The handle database could not be read.
+**/
+EFI_STATUS
+EFIAPI
+ParseHandleDatabaseSnapshotCreate (
+  VOID
+  );
+
+/**
+  Release a snapshot taken with ParseHandleDatabaseSnapshotCreate().
+
+  When the last reference is released the library goes back to querying the
+  handle database directly.
+**/
+VOID
+EFIAPI
+ParseHandleDatabaseSnapshotFree (
+  VOID
+  );
+
 /**
   Function to get all handles that support a given protocol or all handles.
 
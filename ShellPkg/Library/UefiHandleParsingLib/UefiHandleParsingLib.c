@@ -23,6 +23,8 @@ HANDLE_INDEX_LIST  mHandleList             = {
 GUID_INFO_BLOCK    *mGuidList;
 UINTN              mGuidListCount;
 
+HANDLE_DATABASE_SNAPSHOT  *mHandleSnapshot = NULL;
+
 /**
   Function to find the file name associated with a LoadedImageProtocol.
 
@@ -2814,9 +2816,41 @@ GetBestLanguageForDriver (
   return BestLanguage;
 }
 
+/**
+  Find a handle in the handle database snapshot.
+
+  @param[in] TheHandle      The handle to look for.
+
+  @retval HANDLE_SNAPSHOT_NO_INDEX  There is no snapshot or TheHandle is not in it.
+  @return                           The index of TheHandle in the snapshot.
+**/
+UINTN
+InternalHandleSnapshotFind (
+  IN CONST EFI_HANDLE  TheHandle
+  )
+{
+  UINTN  Slot;
+  UINTN  Index;
+
+  if ((mHandleSnapshot == NULL) || (TheHandle == NULL)) {
+    return HANDLE_SNAPSHOT_NO_INDEX;
+  }
+
+  for (Slot = ((UINTN)TheHandle >> 3) & mHandleSnapshot->HashMask; ; Slot = (Slot + 1) & mHandleSnapshot->HashMask) {
+    Index = mHandleSnapshot->HashTable[Slot];
+    if (Index == 0) {
+      return HANDLE_SNAPSHOT_NO_INDEX;
+    }
+
+    if (mHandleSnapshot->Handles[Index - 1] == TheHandle) {
+      return Index - 1;
+    }
+  }
+}
+
 /**
   Function to retrieve the driver name (if possible) from the ComponentName or
-  ComponentName2 protocol
+  ComponentName2 protocol, without using the handle database snapshot.
 
   @param[in] TheHandle      The driver handle to get the name of.
   @param[in] Language       The language to use.
@@ -2825,8 +2859,7 @@ GetBestLanguageForDriver (
   @return                   A pointer to the string name.  Do not de-allocate the memory.
 **/
 CONST CHAR16 *
-EFIAPI
-GetStringNameFromHandle (
+InternalGetStringNameFromHandle (
   IN CONST EFI_HANDLE  TheHandle,
   IN CONST CHAR8       *Language
   )
@@ -2882,6 +2915,65 @@ GetStringNameFromHandle (
   return (NULL);
 }
 
+/**
+  Function to retrieve the driver name (if possible) from the ComponentName or
+  ComponentName2 protocol
+
+  While a handle database snapshot is in use, the name of each handle is only
+  looked up once for the first language asked for.
+
+  @param[in] TheHandle      The driver handle to get the name of.
+  @param[in] Language       The language to use.
+
+  @retval NULL              The name could not be found.
+  @return                   A pointer to the string name.  Do not de-allocate the memory.
+**/
+CONST CHAR16 *
+EFIAPI
+GetStringNameFromHandle (
+  IN CONST EFI_HANDLE  TheHandle,
+  IN CONST CHAR8       *Language
+  )
+{
+  UINTN                  Index;
+  HANDLE_SNAPSHOT_ENTRY  *Entry;
+
+  Index = InternalHandleSnapshotFind (TheHandle);
+  if (Index == HANDLE_SNAPSHOT_NO_INDEX) {
+    return (InternalGetStringNameFromHandle (TheHandle, Language));
+  }
+
+  //
+  // Only cache the names for one language.
+  //
+  if (!mHandleSnapshot->NameLanguageSet) {
+    if (Language != NULL) {
+      mHandleSnapshot->NameLanguage = AllocateCopyPool (AsciiStrSize (Language), Language);
+      if (mHandleSnapshot->NameLanguage == NULL) {
+        return (InternalGetStringNameFromHandle (TheHandle, Language));
+      }
+    }
+
+    mHandleSnapshot->NameLanguageSet = TRUE;
+  }
+
+  if ((Language == NULL) != (mHandleSnapshot->NameLanguage == NULL)) {
+    return (InternalGetStringNameFromHandle (TheHandle, Language));
+  }
+
+  if ((Language != NULL) && (AsciiStrCmp (Language, mHandleSnapshot->NameLanguage) != 0)) {
+    return (InternalGetStringNameFromHandle (TheHandle, Language));
+  }
+
+  Entry = &mHandleSnapshot->Entries[Index];
+  if (!Entry->NameCached) {
+    Entry->Name       = InternalGetStringNameFromHandle (TheHandle, Language);
+    Entry->NameCached = TRUE;
+  }
+
+  return (Entry->Name);
+}
+
 /**
   Function to initialize the file global mHandleList object for use in
   vonverting handles to index and index to handle.
@@ -2929,6 +3021,351 @@ InternalShellInitHandleList (
   return (EFI_SUCCESS);
 }
 
+/**
+  Get the HR_* bits that a protocol on a handle implies.
+
+  @param[in] Protocol     The GUID of the protocol.
+
+  @return The HR_* bits for the protocol, HR_UNKNOWN if there are none.
+**/
+UINTN
+GetHandleTypeFromProtocol (
+  IN CONST EFI_GUID  *Protocol
+  )
+{
+  if (CompareGuid (Protocol, &gEfiLoadedImageProtocolGuid)) {
+    return (UINTN)HR_IMAGE_HANDLE;
+  } else if (CompareGuid (Protocol, &gEfiDriverBindingProtocolGuid)) {
+    return (UINTN)HR_DRIVER_BINDING_HANDLE;
+  } else if (CompareGuid (Protocol, &gEfiDriverConfiguration2ProtocolGuid)) {
+    return (UINTN)HR_DRIVER_CONFIGURATION_HANDLE;
+  } else if (CompareGuid (Protocol, &gEfiDriverConfigurationProtocolGuid)) {
+    return (UINTN)HR_DRIVER_CONFIGURATION_HANDLE;
+  } else if (CompareGuid (Protocol, &gEfiDriverDiagnostics2ProtocolGuid)) {
+    return (UINTN)HR_DRIVER_DIAGNOSTICS_HANDLE;
+  } else if (CompareGuid (Protocol, &gEfiDriverDiagnosticsProtocolGuid)) {
+    return (UINTN)HR_DRIVER_DIAGNOSTICS_HANDLE;
+  } else if (CompareGuid (Protocol, &gEfiComponentName2ProtocolGuid)) {
+    return (UINTN)HR_COMPONENT_NAME_HANDLE;
+  } else if (CompareGuid (Protocol, &gEfiComponentNameProtocolGuid)) {
+    return (UINTN)HR_COMPONENT_NAME_HANDLE;
+  } else if (CompareGuid (Protocol, &gEfiDevicePathProtocolGuid)) {
+    return (UINTN)HR_DEVICE_HANDLE;
+  }
+
+  return (UINTN)HR_UNKNOWN;
+}
+
+/**
+  Free all the memory of a handle database snapshot.
+
+  @param[in] Snapshot     The snapshot to free.
+**/
+VOID
+InternalHandleSnapshotFree (
+  IN HANDLE_DATABASE_SNAPSHOT  *Snapshot
+  )
+{
+  SHELL_FREE_NON_NULL (Snapshot->Entries);
+  SHELL_FREE_NON_NULL (Snapshot->Handles);
+  SHELL_FREE_NON_NULL (Snapshot->HashTable);
+  SHELL_FREE_NON_NULL (Snapshot->OpenInfo);
+  SHELL_FREE_NON_NULL (Snapshot->OpenInfoStart);
+  SHELL_FREE_NON_NULL (Snapshot->ByAgent);
+  SHELL_FREE_NON_NULL (Snapshot->ByAgentStart);
+  SHELL_FREE_NON_NULL (Snapshot->ByController);
+  SHELL_FREE_NON_NULL (Snapshot->ByControllerStart);
+  SHELL_FREE_NON_NULL (Snapshot->ShellIndexMap);
+  SHELL_FREE_NON_NULL (Snapshot->NameLanguage);
+  FreePool (Snapshot);
+}
+
+/**
+  Group the open information entries of a snapshot by one of their handles.
+
+  This is a counting sort: Start receives HandleCount + 2 offsets into Order,
+  and Order receives the indexes of all OpenInfo entries grouped by handle.
+
+  @param[in] Snapshot       The snapshot with all OpenInfo entries collected.
+  @param[in] ByAgent        TRUE to group by agent, FALSE to group by controller.
+  @param[out] Start         On return, the group offsets.
+  @param[out] Order         On return, the grouped OpenInfo indexes.
+
+  @retval EFI_SUCCESS           The entries were grouped.
+  @retval EFI_OUT_OF_RESOURCES  A memory allocation failed.
+**/
+EFI_STATUS
+InternalHandleSnapshotGroup (
+  IN  HANDLE_DATABASE_SNAPSHOT  *Snapshot,
+  IN  BOOLEAN                   ByAgent,
+  OUT UINTN                     **Start,
+  OUT UINTN                     **Order
+  )
+{
+  UINTN  *Next;
+  UINTN  Group;
+  UINTN  Index;
+
+  *Start = AllocateZeroPool ((Snapshot->HandleCount + 2) * sizeof (UINTN));
+  *Order = AllocatePool ((Snapshot->OpenInfoCount + 1) * sizeof (UINTN));
+  Next   = AllocatePool ((Snapshot->HandleCount + 1) * sizeof (UINTN));
+  if ((*Start == NULL) || (*Order == NULL) || (Next == NULL)) {
+    SHELL_FREE_NON_NULL (Next);
+    return (EFI_OUT_OF_RESOURCES);
+  }
+
+  for (Index = 0; Index < Snapshot->OpenInfoCount; Index++) {
+    Group = ByAgent ? Snapshot->OpenInfo[Index].AgentIndex : Snapshot->OpenInfo[Index].ControllerIndex;
+    if (Group == HANDLE_SNAPSHOT_NO_INDEX) {
+      Group = Snapshot->HandleCount;
+    }
+
+    (*Start)[Group + 1]++;
+  }
+
+  for (Group = 0; Group <= Snapshot->HandleCount; Group++) {
+    (*Start)[Group + 1] += (*Start)[Group];
+    Next[Group]          = (*Start)[Group];
+  }
+
+  for (Index = 0; Index < Snapshot->OpenInfoCount; Index++) {
+    Group = ByAgent ? Snapshot->OpenInfo[Index].AgentIndex : Snapshot->OpenInfo[Index].ControllerIndex;
+    if (Group == HANDLE_SNAPSHOT_NO_INDEX) {
+      Group = Snapshot->HandleCount;
+    }
+
+    (*Order)[Next[Group]++] = Index;
+  }
+
+  FreePool (Next);
+  return (EFI_SUCCESS);
+}
+
+/**
+  Take a snapshot of the handle database for use by the functions of this library.
+
+  The snapshot records every handle, the protocols installed on it and the agents
+  that have those protocols open, indexed by handle, by agent and by controller.
+  Until ParseHandleDatabaseSnapshotFree() is called, ParseHandleDatabaseByRelationship()
+  and the functions built on it, ConvertHandleToHandleIndex(), ConvertHandleIndexToHandle()
+  and GetStringNameFromHandle() answer from the snapshot instead of walking the handle
+  database again on every call.
+
+  Only take a snapshot for operations that do not change the handle database.  Calls
+  may be nested; each successful call must be matched by a call to
+  ParseHandleDatabaseSnapshotFree().
+
+  @retval EFI_SUCCESS           The snapshot is in use.
+  @retval EFI_OUT_OF_RESOURCES  A memory allocation failed.  The functions keep
+                                querying the handle database directly.
+  @return other                 The handle database could not be read.
+**/
+EFI_STATUS
+EFIAPI
+ParseHandleDatabaseSnapshotCreate (
+  VOID
+  )
+{
+  EFI_STATUS                           Status;
+  HANDLE_DATABASE_SNAPSHOT             *Snapshot;
+  HANDLE_SNAPSHOT_OPEN_INFO            *NewOpenInfo;
+  UINTN                                OpenInfoMax;
+  UINTN                                HandleIndex;
+  UINTN                                Slot;
+  EFI_GUID                             **ProtocolGuidArray;
+  UINTN                                ArrayCount;
+  UINTN                                ProtocolIndex;
+  EFI_OPEN_PROTOCOL_INFORMATION_ENTRY  *OpenInfo;
+  UINTN                                OpenInfoCount;
+  UINTN                                OpenInfoIndex;
+  HANDLE_LIST                          *ListWalker;
+
+  if (mHandleSnapshot != NULL) {
+    mHandleSnapshot->RefCount++;
+    return (EFI_SUCCESS);
+  }
+
+  InternalShellInitHandleList ();
+
+  Snapshot = AllocateZeroPool (sizeof (HANDLE_DATABASE_SNAPSHOT));
+  if (Snapshot == NULL) {
+    return (EFI_OUT_OF_RESOURCES);
+  }
+
+  Status = gBS->LocateHandleBuffer (
+                  AllHandles,
+                  NULL,
+                  NULL,
+                  &Snapshot->HandleCount,
+                  &Snapshot->Handles
+                  );
+  if (EFI_ERROR (Status)) {
+    FreePool (Snapshot);
+    return (Status);
+  }
+
+  //
+  // The hash table is kept at most half full.
+  //
+  for (Snapshot->HashMask = 1; Snapshot->HashMask < Snapshot->HandleCount * 2; Snapshot->HashMask <<= 1) {
+  }
+
+  Snapshot->Entries       = AllocateZeroPool (Snapshot->HandleCount * sizeof (HANDLE_SNAPSHOT_ENTRY));
+  Snapshot->HashTable     = AllocateZeroPool (Snapshot->HashMask * sizeof (UINTN));
+  Snapshot->OpenInfoStart = AllocateZeroPool ((Snapshot->HandleCount + 1) * sizeof (UINTN));
+  Snapshot->HashMask--;
+  if ((Snapshot->Entries == NULL) || (Snapshot->HashTable == NULL) || (Snapshot->OpenInfoStart == NULL)) {
+    InternalHandleSnapshotFree (Snapshot);
+    return (EFI_OUT_OF_RESOURCES);
+  }
+
+  for (HandleIndex = 0; HandleIndex < Snapshot->HandleCount; HandleIndex++) {
+    Snapshot->Entries[HandleIndex].Handle = Snapshot->Handles[HandleIndex];
+    for (Slot = ((UINTN)Snapshot->Handles[HandleIndex] >> 3) & Snapshot->HashMask
+         ; Snapshot->HashTable[Slot] != 0
+         ; Slot = (Slot + 1) & Snapshot->HashMask
+         )
+    {
+    }
+
+    Snapshot->HashTable[Slot] = HandleIndex + 1;
+  }
+
+  //
+  // Make the lookups below use the new hash table.
+  //
+  mHandleSnapshot = Snapshot;
+
+  //
+  // Collect the protocols on each handle and the agents that opened them.
+  //
+  OpenInfoMax = 0;
+  for (HandleIndex = 0; HandleIndex < Snapshot->HandleCount; HandleIndex++) {
+    Snapshot->OpenInfoStart[HandleIndex] = Snapshot->OpenInfoCount;
+
+    Status = gBS->ProtocolsPerHandle (
+                    Snapshot->Handles[HandleIndex],
+                    &ProtocolGuidArray,
+                    &ArrayCount
+                    );
+    if (EFI_ERROR (Status)) {
+      continue;
+    }
+
+    for (ProtocolIndex = 0; ProtocolIndex < ArrayCount; ProtocolIndex++) {
+      Snapshot->Entries[HandleIndex].Type |= GetHandleTypeFromProtocol (ProtocolGuidArray[ProtocolIndex]);
+
+      Status = gBS->OpenProtocolInformation (
+                      Snapshot->Handles[HandleIndex],
+                      ProtocolGuidArray[ProtocolIndex],
+                      &OpenInfo,
+                      &OpenInfoCount
+                      );
+      if (EFI_ERROR (Status)) {
+        continue;
+      }
+
+      Snapshot->Entries[HandleIndex].HasOpenInfo = TRUE;
+
+      if (Snapshot->OpenInfoCount + OpenInfoCount > OpenInfoMax) {
+        NewOpenInfo = ReallocatePool (
+                        OpenInfoMax * sizeof (HANDLE_SNAPSHOT_OPEN_INFO),
+                        (OpenInfoMax * 2 + OpenInfoCount) * sizeof (HANDLE_SNAPSHOT_OPEN_INFO),
+                        Snapshot->OpenInfo
+                        );
+        if (NewOpenInfo == NULL) {
+          FreePool (OpenInfo);
+          FreePool (ProtocolGuidArray);
+          mHandleSnapshot = NULL;
+          InternalHandleSnapshotFree (Snapshot);
+          return (EFI_OUT_OF_RESOURCES);
+        }
+
+        Snapshot->OpenInfo = NewOpenInfo;
+        OpenInfoMax        = OpenInfoMax * 2 + OpenInfoCount;
+      }
+
+      for (OpenInfoIndex = 0; OpenInfoIndex < OpenInfoCount; OpenInfoIndex++) {
+        NewOpenInfo                   = &Snapshot->OpenInfo[Snapshot->OpenInfoCount++];
+        NewOpenInfo->HandleIndex      = HandleIndex;
+        NewOpenInfo->AgentHandle      = OpenInfo[OpenInfoIndex].AgentHandle;
+        NewOpenInfo->ControllerHandle = OpenInfo[OpenInfoIndex].ControllerHandle;
+        NewOpenInfo->AgentIndex       = InternalHandleSnapshotFind (OpenInfo[OpenInfoIndex].AgentHandle);
+        NewOpenInfo->ControllerIndex  = InternalHandleSnapshotFind (OpenInfo[OpenInfoIndex].ControllerHandle);
+        NewOpenInfo->Attributes       = OpenInfo[OpenInfoIndex].Attributes;
+      }
+
+      FreePool (OpenInfo);
+    }
+
+    FreePool (ProtocolGuidArray);
+  }
+
+  Snapshot->OpenInfoStart[Snapshot->HandleCount] = Snapshot->OpenInfoCount;
+
+  Status = InternalHandleSnapshotGroup (Snapshot, TRUE, &Snapshot->ByAgentStart, &Snapshot->ByAgent);
+  if (!EFI_ERROR (Status)) {
+    Status = InternalHandleSnapshotGroup (Snapshot, FALSE, &Snapshot->ByControllerStart, &Snapshot->ByController);
+  }
+
+  //
+  // Map the shell handle indexes assigned so far to the snapshot.
+  //
+  if (!EFI_ERROR (Status)) {
+    Snapshot->ShellIndexCount = mHandleList.NextIndex;
+    Snapshot->ShellIndexMap   = AllocatePool (Snapshot->ShellIndexCount * sizeof (UINTN));
+    if (Snapshot->ShellIndexMap == NULL) {
+      Status = EFI_OUT_OF_RESOURCES;
+    }
+  }
+
+  if (EFI_ERROR (Status)) {
+    mHandleSnapshot = NULL;
+    InternalHandleSnapshotFree (Snapshot);
+    return (Status);
+  }
+
+  SetMem (Snapshot->ShellIndexMap, Snapshot->ShellIndexCount * sizeof (UINTN), 0xFF);
+  for (ListWalker = (HANDLE_LIST *)GetFirstNode (&mHandleList.List.Link)
+       ; !IsNull (&mHandleList.List.Link, &ListWalker->Link)
+       ; ListWalker = (HANDLE_LIST *)GetNextNode (&mHandleList.List.Link, &ListWalker->Link)
+       )
+  {
+    HandleIndex = InternalHandleSnapshotFind (ListWalker->TheHandle);
+    if ((HandleIndex != HANDLE_SNAPSHOT_NO_INDEX) && (ListWalker->TheIndex < Snapshot->ShellIndexCount)) {
+      Snapshot->ShellIndexMap[ListWalker->TheIndex] = HandleIndex;
+      Snapshot->Entries[HandleIndex].ShellIndex     = ListWalker->TheIndex;
+    }
+  }
+
+  Snapshot->RefCount = 1;
+  return (EFI_SUCCESS);
+}
+
+/**
+  Release a snapshot taken with ParseHandleDatabaseSnapshotCreate().
+
+  When the last reference is released the library goes back to querying the
+  handle database directly.
+**/
+VOID
+EFIAPI
+ParseHandleDatabaseSnapshotFree (
+  VOID
+  )
+{
+  if (mHandleSnapshot == NULL) {
+    return;
+  }
+
+  ASSERT (mHandleSnapshot->RefCount > 0);
+  mHandleSnapshot->RefCount--;
+  if (mHandleSnapshot->RefCount == 0) {
+    InternalHandleSnapshotFree (mHandleSnapshot);
+    mHandleSnapshot = NULL;
+  }
+}
+
 /**
   Function to retrieve the human-friendly index of a given handle.  If the handle
   does not have a index one will be automatically assigned.  The index value is valid
@@ -2950,11 +3387,20 @@ ConvertHandleToHandleIndex (
   EFI_GUID     **ProtocolBuffer;
   UINTN        ProtocolCount;
   HANDLE_LIST  *ListWalker;
+  UINTN        SnapshotIndex;
 
   if (TheHandle == NULL) {
     return 0;
   }
 
+  //
+  // A handle in the snapshot is known to be valid.
+  //
+  SnapshotIndex = InternalHandleSnapshotFind (TheHandle);
+  if ((SnapshotIndex != HANDLE_SNAPSHOT_NO_INDEX) && (mHandleSnapshot->Entries[SnapshotIndex].ShellIndex != 0)) {
+    return (mHandleSnapshot->Entries[SnapshotIndex].ShellIndex);
+  }
+
   InternalShellInitHandleList ();
 
   for (ListWalker = (HANDLE_LIST *)GetFirstNode (&mHandleList.List.Link)
@@ -3001,6 +3447,10 @@ ConvertHandleToHandleIndex (
   ListWalker->TheHandle = TheHandle;
   ListWalker->TheIndex  = mHandleList.NextIndex++;
   InsertTailList (&mHandleList.List.Link, &ListWalker->Link);
+  if (SnapshotIndex != HANDLE_SNAPSHOT_NO_INDEX) {
+    mHandleSnapshot->Entries[SnapshotIndex].ShellIndex = ListWalker->TheIndex;
+  }
+
   return (ListWalker->TheIndex);
 }
 
@@ -3024,6 +3474,17 @@ ConvertHandleIndexToHandle (
   UINTN        ProtocolCount;
   HANDLE_LIST  *ListWalker;
 
+  //
+  // Indexes assigned before the snapshot was taken are resolved by the snapshot.
+  //
+  if ((mHandleSnapshot != NULL) && (TheIndex < mHandleSnapshot->ShellIndexCount)) {
+    if (mHandleSnapshot->ShellIndexMap[TheIndex] == HANDLE_SNAPSHOT_NO_INDEX) {
+      return NULL;
+    }
+
+    return (mHandleSnapshot->Handles[mHandleSnapshot->ShellIndexMap[TheIndex]]);
+  }
+
   InternalShellInitHandleList ();
 
   if (TheIndex >= mHandleList.NextIndex) {
@@ -3056,6 +3517,159 @@ ConvertHandleIndexToHandle (
   return NULL;
 }
 
+/**
+  Mark the parents of a controller handle in a handle type array built from
+  the handle database snapshot.
+
+  A parent is a handle with a protocol that is opened BY_CHILD_CONTROLLER for
+  the controller.
+
+  @param[in] ControllerHandle       The handle of the controller.
+  @param[in] ControllerIndex        The snapshot index of ControllerHandle or
+                                    HANDLE_SNAPSHOT_NO_INDEX.
+  @param[in, out] HandleType        The handle type array to update.
+**/
+VOID
+InternalHandleSnapshotMarkParents (
+  IN     CONST EFI_HANDLE  ControllerHandle,
+  IN     UINTN             ControllerIndex,
+  IN OUT UINTN             *HandleType
+  )
+{
+  HANDLE_SNAPSHOT_OPEN_INFO  *OpenInfo;
+  UINTN                      Group;
+  UINTN                      Index;
+
+  Group = (ControllerIndex == HANDLE_SNAPSHOT_NO_INDEX) ? mHandleSnapshot->HandleCount : ControllerIndex;
+  for (Index = mHandleSnapshot->ByControllerStart[Group]; Index < mHandleSnapshot->ByControllerStart[Group + 1]; Index++) {
+    OpenInfo = &mHandleSnapshot->OpenInfo[mHandleSnapshot->ByController[Index]];
+    if ((OpenInfo->HandleIndex != ControllerIndex) &&
+        (OpenInfo->ControllerHandle == ControllerHandle) &&
+        ((OpenInfo->Attributes & EFI_OPEN_PROTOCOL_BY_CHILD_CONTROLLER) != 0))
+    {
+      HandleType[OpenInfo->HandleIndex] |= (UINTN)(HR_DEVICE_HANDLE | HR_PARENT_HANDLE);
+    }
+  }
+}
+
+/**
+  Worker for ParseHandleDatabaseByRelationshipWithType() that uses the handle
+  database snapshot.
+
+  The handle types are the same as the ones found by walking the handle database,
+  but only the open information entries that involve DriverBindingHandle or
+  ControllerHandle are looked at.
+
+  @param[in] DriverBindingHandle    The handle with Driver Binding protocol on it.
+  @param[in] ControllerHandle       The handle with Device Path protocol on it.
+  @param[in] HandleCount            The pointer to UINTN that receives the number of
+                                    handles in HandleBuffer.
+  @param[out] HandleBuffer          On a successful return, a buffer of all the handles.
+  @param[out] HandleType            An array of type information.
+
+  @retval EFI_SUCCESS               The operation was successful.
+  @retval EFI_OUT_OF_RESOURCES      A memory allocation failed.
+**/
+EFI_STATUS
+InternalHandleSnapshotByRelationshipWithType (
+  IN CONST EFI_HANDLE  DriverBindingHandle OPTIONAL,
+  IN CONST EFI_HANDLE  ControllerHandle OPTIONAL,
+  IN UINTN             *HandleCount,
+  OUT EFI_HANDLE       **HandleBuffer,
+  OUT UINTN            **HandleType
+  )
+{
+  HANDLE_SNAPSHOT_OPEN_INFO  *OpenInfo;
+  UINTN                      DriverBindingIndex;
+  UINTN                      ControllerIndex;
+  UINTN                      HandleIndex;
+  UINTN                      Group;
+  UINTN                      Index;
+
+  *HandleCount  = mHandleSnapshot->HandleCount;
+  *HandleBuffer = AllocateCopyPool (*HandleCount * sizeof (EFI_HANDLE), mHandleSnapshot->Handles);
+  *HandleType   = AllocateZeroPool (*HandleCount * sizeof (UINTN));
+  if ((*HandleBuffer == NULL) || (*HandleType == NULL)) {
+    SHELL_FREE_NON_NULL (*HandleBuffer);
+    SHELL_FREE_NON_NULL (*HandleType);
+    *HandleCount = 0;
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  for (HandleIndex = 0; HandleIndex < *HandleCount; HandleIndex++) {
+    (*HandleType)[HandleIndex] = mHandleSnapshot->Entries[HandleIndex].Type;
+  }
+
+  DriverBindingIndex = InternalHandleSnapshotFind (DriverBindingHandle);
+  ControllerIndex    = InternalHandleSnapshotFind (ControllerHandle);
+
+  if (ControllerHandle == NULL) {
+    //
+    // ControllerHandle == NULL and DriverBindingHandle != NULL.
+    // Return information on all the controller handles that the driver specified by DriverBindingHandle is managing
+    //
+    Group = (DriverBindingIndex == HANDLE_SNAPSHOT_NO_INDEX) ? mHandleSnapshot->HandleCount : DriverBindingIndex;
+    for (Index = mHandleSnapshot->ByAgentStart[Group]; Index < mHandleSnapshot->ByAgentStart[Group + 1]; Index++) {
+      OpenInfo = &mHandleSnapshot->OpenInfo[mHandleSnapshot->ByAgent[Index]];
+      if (OpenInfo->AgentHandle != DriverBindingHandle) {
+        continue;
+      }
+
+      if ((OpenInfo->Attributes & EFI_OPEN_PROTOCOL_BY_DRIVER) != 0) {
+        (*HandleType)[OpenInfo->HandleIndex] |= (UINTN)(HR_DEVICE_HANDLE | HR_CONTROLLER_HANDLE);
+        if (DriverBindingIndex != HANDLE_SNAPSHOT_NO_INDEX) {
+          (*HandleType)[DriverBindingIndex] |= (UINTN)HR_DEVICE_DRIVER;
+        }
+      }
+
+      if ((OpenInfo->Attributes & EFI_OPEN_PROTOCOL_BY_CHILD_CONTROLLER) != 0) {
+        (*HandleType)[OpenInfo->HandleIndex] |= (UINTN)(HR_DEVICE_HANDLE | HR_CONTROLLER_HANDLE);
+        if (DriverBindingIndex != HANDLE_SNAPSHOT_NO_INDEX) {
+          (*HandleType)[DriverBindingIndex] |= (UINTN)(HR_BUS_DRIVER | HR_DEVICE_DRIVER);
+        }
+
+        if (OpenInfo->ControllerIndex != HANDLE_SNAPSHOT_NO_INDEX) {
+          (*HandleType)[OpenInfo->ControllerIndex] |= (UINTN)(HR_DEVICE_HANDLE | HR_CHILD_HANDLE);
+        }
+      }
+    }
+
+    return EFI_SUCCESS;
+  }
+
+  if ((ControllerIndex != HANDLE_SNAPSHOT_NO_INDEX) && mHandleSnapshot->Entries[ControllerIndex].HasOpenInfo) {
+    (*HandleType)[ControllerIndex] |= (UINTN)(HR_DEVICE_HANDLE | HR_CONTROLLER_HANDLE);
+    for (Index = mHandleSnapshot->OpenInfoStart[ControllerIndex]; Index < mHandleSnapshot->OpenInfoStart[ControllerIndex + 1]; Index++) {
+      OpenInfo = &mHandleSnapshot->OpenInfo[Index];
+      if ((OpenInfo->Attributes & EFI_OPEN_PROTOCOL_BY_DRIVER) != 0) {
+        if (DriverBindingHandle == NULL) {
+          if (OpenInfo->AgentIndex != HANDLE_SNAPSHOT_NO_INDEX) {
+            (*HandleType)[OpenInfo->AgentIndex] |= (UINTN)HR_DEVICE_DRIVER;
+          }
+        } else if ((OpenInfo->AgentHandle == DriverBindingHandle) && (DriverBindingIndex != HANDLE_SNAPSHOT_NO_INDEX)) {
+          (*HandleType)[DriverBindingIndex] |= (UINTN)HR_DEVICE_DRIVER;
+        }
+      }
+
+      if ((OpenInfo->Attributes & EFI_OPEN_PROTOCOL_BY_CHILD_CONTROLLER) != 0) {
+        if (OpenInfo->AgentIndex != HANDLE_SNAPSHOT_NO_INDEX) {
+          (*HandleType)[OpenInfo->AgentIndex] |= (UINTN)(HR_BUS_DRIVER | HR_DEVICE_DRIVER);
+        }
+
+        if (((DriverBindingHandle == NULL) || (OpenInfo->AgentHandle == DriverBindingHandle)) &&
+            (OpenInfo->ControllerIndex != HANDLE_SNAPSHOT_NO_INDEX))
+        {
+          (*HandleType)[OpenInfo->ControllerIndex] |= (UINTN)(HR_DEVICE_HANDLE | HR_CHILD_HANDLE);
+        }
+      }
+    }
+  }
+
+  InternalHandleSnapshotMarkParents (ControllerHandle, ControllerIndex, *HandleType);
+
+  return EFI_SUCCESS;
+}
+
 /**
   Gets all the related EFI_HANDLEs based on the mask supplied.
 
@@ -3112,6 +3726,16 @@ ParseHandleDatabaseByRelationshipWithType (
   *HandleBuffer = NULL;
   *HandleType   = NULL;
 
+  if (mHandleSnapshot != NULL) {
+    return InternalHandleSnapshotByRelationshipWithType (
+             DriverBindingHandle,
+             ControllerHandle,
+             HandleCount,
+             HandleBuffer,
+             HandleType
+             );
+  }
+
   //
   // Retrieve the list of all handles from the handle database
   //
@@ -3157,25 +3781,7 @@ ParseHandleDatabaseByRelationshipWithType (
       //
       // Set the bit describing what this handle has
       //
-      if (CompareGuid (ProtocolGuidArray[ProtocolIndex], &gEfiLoadedImageProtocolGuid)) {
-        (*HandleType)[HandleIndex] |= (UINTN)HR_IMAGE_HANDLE;
-      } else if (CompareGuid (ProtocolGuidArray[ProtocolIndex], &gEfiDriverBindingProtocolGuid)) {
-        (*HandleType)[HandleIndex] |= (UINTN)HR_DRIVER_BINDING_HANDLE;
-      } else if (CompareGuid (ProtocolGuidArray[ProtocolIndex], &gEfiDriverConfiguration2ProtocolGuid)) {
-        (*HandleType)[HandleIndex] |= (UINTN)HR_DRIVER_CONFIGURATION_HANDLE;
-      } else if (CompareGuid (ProtocolGuidArray[ProtocolIndex], &gEfiDriverConfigurationProtocolGuid)) {
-        (*HandleType)[HandleIndex] |= (UINTN)HR_DRIVER_CONFIGURATION_HANDLE;
-      } else if (CompareGuid (ProtocolGuidArray[ProtocolIndex], &gEfiDriverDiagnostics2ProtocolGuid)) {
-        (*HandleType)[HandleIndex] |= (UINTN)HR_DRIVER_DIAGNOSTICS_HANDLE;
-      } else if (CompareGuid (ProtocolGuidArray[ProtocolIndex], &gEfiDriverDiagnosticsProtocolGuid)) {
-        (*HandleType)[HandleIndex] |= (UINTN)HR_DRIVER_DIAGNOSTICS_HANDLE;
-      } else if (CompareGuid (ProtocolGuidArray[ProtocolIndex], &gEfiComponentName2ProtocolGuid)) {
-        (*HandleType)[HandleIndex] |= (UINTN)HR_COMPONENT_NAME_HANDLE;
-      } else if (CompareGuid (ProtocolGuidArray[ProtocolIndex], &gEfiComponentNameProtocolGuid)) {
-        (*HandleType)[HandleIndex] |= (UINTN)HR_COMPONENT_NAME_HANDLE;
-      } else if (CompareGuid (ProtocolGuidArray[ProtocolIndex], &gEfiDevicePathProtocolGuid)) {
-        (*HandleType)[HandleIndex] |= (UINTN)HR_DEVICE_HANDLE;
-      }
+      (*HandleType)[HandleIndex] |= GetHandleTypeFromProtocol (ProtocolGuidArray[ProtocolIndex]);
 
       //
       // Retrieve the list of agents that have opened each protocol
@@ -276,6 +276,64 @@ typedef struct {
   UINTN          NextIndex;
 } HANDLE_INDEX_LIST;
 
+///
+/// Value used in a handle database snapshot for a handle that is not in the snapshot.
+///
+#define HANDLE_SNAPSHOT_NO_INDEX  MAX_UINTN
+
+///
+/// One agent that has a protocol open, as returned by OpenProtocolInformation().
+///
+typedef struct {
+  UINTN         HandleIndex;      ///< Snapshot index of the handle the protocol is installed on.
+  EFI_HANDLE    AgentHandle;
+  EFI_HANDLE    ControllerHandle;
+  UINTN         AgentIndex;       ///< Snapshot index of AgentHandle or HANDLE_SNAPSHOT_NO_INDEX.
+  UINTN         ControllerIndex;  ///< Snapshot index of ControllerHandle or HANDLE_SNAPSHOT_NO_INDEX.
+  UINT32        Attributes;
+} HANDLE_SNAPSHOT_OPEN_INFO;
+
+///
+/// One handle of a handle database snapshot.
+///
+typedef struct {
+  EFI_HANDLE      Handle;
+  UINTN           Type;          ///< HR_* bits derived from the protocols on the handle.
+  BOOLEAN         HasOpenInfo;   ///< TRUE if OpenProtocolInformation() worked for a protocol on the handle.
+  UINTN           ShellIndex;    ///< Index from ConvertHandleToHandleIndex(), 0 if none yet.
+  BOOLEAN         NameCached;    ///< TRUE if Name holds the result of GetStringNameFromHandle().
+  CONST CHAR16    *Name;
+} HANDLE_SNAPSHOT_ENTRY;
+
+///
+/// Snapshot of the handle database.
+///
+/// The open information is kept in one array ordered by the handle the protocol is
+/// installed on.  ByAgent and ByController hold indexes into that array grouped by
+/// the snapshot index of the agent and of the controller.  Group N covers
+/// [Start[N], Start[N + 1]) and group HandleCount holds the entries whose handle is
+/// not in the snapshot.
+///
+typedef struct {
+  UINTN                        RefCount;
+  UINTN                        HandleCount;
+  HANDLE_SNAPSHOT_ENTRY        *Entries;
+  EFI_HANDLE                   *Handles;
+  UINTN                        HashMask;
+  UINTN                        *HashTable;        ///< Snapshot index + 1 of each handle, 0 for an empty slot.
+  UINTN                        OpenInfoCount;
+  HANDLE_SNAPSHOT_OPEN_INFO    *OpenInfo;
+  UINTN                        *OpenInfoStart;    ///< HandleCount + 1 entries.
+  UINTN                        *ByAgent;
+  UINTN                        *ByAgentStart;     ///< HandleCount + 2 entries.
+  UINTN                        *ByController;
+  UINTN                        *ByControllerStart; ///< HandleCount + 2 entries.
+  UINTN                        ShellIndexCount;
+  UINTN                        *ShellIndexMap;    ///< Snapshot index of each shell handle index.
+  BOOLEAN                      NameLanguageSet;
+  CHAR8                        *NameLanguage;     ///< Language of the cached names.
+} HANDLE_DATABASE_SNAPSHOT;
+
 typedef
 CHAR16 *
 (EFIAPI *DUMP_PROTOCOL_INFO)(
@@ -10,6 +10,7 @@
 #include <Library/UefiLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/BaseMemoryLib.h>
+#include <Library/PrintLib.h>
 #include "AcpiParser.h"
 #include "AcpiView.h"
 #include "AcpiViewConfig.h"
@@ -20,6 +21,16 @@ STATIC UINT32  mTableWarningCount;
 
 STATIC ACPI_DESCRIPTION_HEADER_INFO  AcpiHdrInfo;
 
+/**
+  Output sink. Formatted output is collected here and handed to the console
+  in large chunks rather than one OutputString() call per field.
+**/
+#define ACPI_VIEW_OUTPUT_BUFFER_CHARS   4096
+#define ACPI_VIEW_OUTPUT_RESERVE_CHARS  512
+
+STATIC CHAR16  mOutputBuffer[ACPI_VIEW_OUTPUT_BUFFER_CHARS];
+STATIC UINTN   mOutputLength;
+
 /**
   An ACPI_PARSER array describing the ACPI header.
 **/
@@ -99,6 +110,65 @@ IncrementWarningCount (
   mTableWarningCount++;
 }
 
+/**
+  This function writes any buffered acpiview output to the console.
+
+  It must be called before changing the console attributes and before
+  anything is printed without going through AcpiViewPrint().
+**/
+VOID
+EFIAPI
+AcpiViewFlushOutput (
+  VOID
+  )
+{
+  if (mOutputLength != 0) {
+    mOutputBuffer[mOutputLength] = CHAR_NULL;
+    gST->ConOut->OutputString (gST->ConOut, mOutputBuffer);
+    mOutputLength = 0;
+  }
+}
+
+/**
+  This function formats a string into the acpiview output buffer.
+
+  The output is written to the console when the buffer fills up or when
+  AcpiViewFlushOutput() is called. A single call produces at most
+  ACPI_VIEW_OUTPUT_RESERVE_CHARS - 1 characters; longer output is truncated.
+
+  @param [in] Format  Null-terminated Unicode format string.
+  @param [in] ...     Variable argument list whose contents are accessed
+                      based on the format string specified by Format.
+
+  @return The number of Unicode characters added to the output buffer.
+**/
+UINTN
+EFIAPI
+AcpiViewPrint (
+  IN CONST CHAR16  *Format,
+  ...
+  )
+{
+  VA_LIST  Marker;
+  UINTN    Length;
+
+  if ((ACPI_VIEW_OUTPUT_BUFFER_CHARS - mOutputLength) < ACPI_VIEW_OUTPUT_RESERVE_CHARS) {
+    AcpiViewFlushOutput ();
+  }
+
+  VA_START (Marker, Format);
+  Length = UnicodeVSPrint (
+             &mOutputBuffer[mOutputLength],
+             ACPI_VIEW_OUTPUT_RESERVE_CHARS * sizeof (CHAR16),
+             Format,
+             Marker
+             );
+  VA_END (Marker);
+
+  mOutputLength += Length;
+  return Length;
+}
+
 /**
   This function verifies the ACPI table checksum.
 
@@ -140,6 +210,7 @@ VerifyChecksum (
     OriginalAttribute = gST->ConOut->Mode->Attribute;
     if (Checksum == 0) {
       if (GetColourHighlighting ()) {
+        AcpiViewFlushOutput ();
         gST->ConOut->SetAttribute (
                        gST->ConOut,
                        EFI_TEXT_ATTR (
@@ -149,10 +220,11 @@ VerifyChecksum (
                        );
       }
 
-      Print (L"Table Checksum : OK\n\n");
+      AcpiViewPrint (L"Table Checksum : OK\n\n");
     } else {
       IncrementErrorCount ();
       if (GetColourHighlighting ()) {
+        AcpiViewFlushOutput ();
         gST->ConOut->SetAttribute (
                        gST->ConOut,
                        EFI_TEXT_ATTR (
@@ -162,10 +234,11 @@ VerifyChecksum (
                        );
       }
 
-      Print (L"Table Checksum : FAILED (0x%X)\n\n", Checksum);
+      AcpiViewPrint (L"Table Checksum : FAILED (0x%X)\n\n", Checksum);
     }
 
     if (GetColourHighlighting ()) {
+      AcpiViewFlushOutput ();
       gST->ConOut->SetAttribute (gST->ConOut, OriginalAttribute);
     }
   }
@@ -186,55 +259,53 @@ DumpRaw (
   IN UINT32  Length
   )
 {
-  UINTN  ByteCount;
-  UINTN  PartLineChars;
-  UINTN  AsciiBufferIndex;
-  CHAR8  AsciiBuffer[17];
+  UINTN   ByteCount;
+  UINTN   LineBytes;
+  UINTN   Index;
+  UINTN   HexIndex;
+  CHAR16  HexBuffer[51];
+  CHAR8   AsciiBuffer[17];
 
-  ByteCount        = 0;
-  AsciiBufferIndex = 0;
+  AcpiViewPrint (L"Address  : 0x%p\n", Ptr);
+  AcpiViewPrint (L"Length   : %d\n", Length);
+  AcpiViewPrint (L"  \n");
 
-  Print (L"Address  : 0x%p\n", Ptr);
-  Print (L"Length   : %d\n", Length);
+  //
+  // Format one line of 16 bytes at a time. The hex column is always padded
+  // to its full width so that the ASCII column of a short final line lines
+  // up with the lines above it.
+  //
+  for (ByteCount = 0; ByteCount < Length; ByteCount += LineBytes) {
+    LineBytes = MIN (Length - ByteCount, 16);
+    HexIndex  = 0;
+
+    for (Index = 0; Index < 16; Index++) {
+      if (Index == 8) {
+        HexBuffer[HexIndex++] = (LineBytes > 8) ? L'-' : L' ';
+        HexBuffer[HexIndex++] = L' ';
+      }
 
-  while (ByteCount < Length) {
-    if ((ByteCount & 0x0F) == 0) {
-      AsciiBuffer[AsciiBufferIndex] = '\0';
-      Print (L"  %a\n%08X : ", AsciiBuffer, ByteCount);
-      AsciiBufferIndex = 0;
-    } else if ((ByteCount & 0x07) == 0) {
-      Print (L"- ");
-    }
+      if (Index < LineBytes) {
+        HexBuffer[HexIndex++] = (CHAR16)"0123456789ABCDEF"[Ptr[Index] >> 4];
+        HexBuffer[HexIndex++] = (CHAR16)"0123456789ABCDEF"[Ptr[Index] & 0x0F];
+        AsciiBuffer[Index]    = ((Ptr[Index] >= ' ') && (Ptr[Index] < 0x7F)) ?
+                                (CHAR8)Ptr[Index] : '.';
+      } else {
+        HexBuffer[HexIndex++] = L' ';
+        HexBuffer[HexIndex++] = L' ';
+      }
 
-    if ((*Ptr >= ' ') && (*Ptr < 0x7F)) {
-      AsciiBuffer[AsciiBufferIndex++] = *Ptr;
-    } else {
-      AsciiBuffer[AsciiBufferIndex++] = '.';
+      HexBuffer[HexIndex++] = L' ';
     }
 
-    Print (L"%02X ", *Ptr++);
-
-    ByteCount++;
-  }
+    HexBuffer[HexIndex]    = CHAR_NULL;
+    AsciiBuffer[LineBytes] = '\0';
 
-  // Justify the final line using spaces before printing
-  // the ASCII data.
-  PartLineChars = (Length & 0x0F);
-  if (PartLineChars != 0) {
-    PartLineChars = 48 - (PartLineChars * 3);
-    if ((Length & 0x0F) <= 8) {
-      PartLineChars += 2;
-    }
-
-    while (PartLineChars > 0) {
-      Print (L" ");
-      PartLineChars--;
-    }
+    AcpiViewPrint (L"%08X : %s  %a\n", ByteCount, HexBuffer, AsciiBuffer);
+    Ptr += LineBytes;
   }
 
-  // Print ASCII data for the final line.
-  AsciiBuffer[AsciiBufferIndex] = '\0';
-  Print (L"  %a\n\n", AsciiBuffer);
+  AcpiViewPrint (L"\n");
 }
 
 /**
@@ -250,7 +321,7 @@ DumpUint8 (
   IN UINT8         *Ptr
   )
 {
-  Print (Format, *Ptr);
+  AcpiViewPrint (Format, *Ptr);
 }
 
 /**
@@ -266,7 +337,7 @@ DumpUint16 (
   IN UINT8         *Ptr
   )
 {
-  Print (Format, *(UINT16 *)Ptr);
+  AcpiViewPrint (Format, *(UINT16 *)Ptr);
 }
 
 /**
@@ -282,7 +353,7 @@ DumpUint32 (
   IN UINT8         *Ptr
   )
 {
-  Print (Format, *(UINT32 *)Ptr);
+  AcpiViewPrint (Format, *(UINT32 *)Ptr);
 }
 
 /**
@@ -308,7 +379,7 @@ DumpUint64 (
   Val  = LShiftU64 (Val, 32);
   Val |= (UINT64)*(UINT32 *)Ptr;
 
-  Print (Format, Val);
+  AcpiViewPrint (Format, Val);
 }
 
 /**
@@ -327,7 +398,7 @@ Dump3Chars (
   IN UINT8         *Ptr
   )
 {
-  Print (
+  AcpiViewPrint (
     (Format != NULL) ? Format : L"%c%c%c",
     Ptr[0],
     Ptr[1],
@@ -351,7 +422,7 @@ Dump4Chars (
   IN UINT8         *Ptr
   )
 {
-  Print (
+  AcpiViewPrint (
     (Format != NULL) ? Format : L"%c%c%c%c",
     Ptr[0],
     Ptr[1],
@@ -376,7 +447,7 @@ Dump6Chars (
   IN UINT8         *Ptr
   )
 {
-  Print (
+  AcpiViewPrint (
     (Format != NULL) ? Format : L"%c%c%c%c%c%c",
     Ptr[0],
     Ptr[1],
@@ -403,7 +474,7 @@ Dump8Chars (
   IN UINT8         *Ptr
   )
 {
-  Print (
+  AcpiViewPrint (
     (Format != NULL) ? Format : L"%c%c%c%c%c%c%c%c",
     Ptr[0],
     Ptr[1],
@@ -432,7 +503,7 @@ Dump12Chars (
   IN       UINT8   *Ptr
   )
 {
-  Print (
+  AcpiViewPrint (
     (Format != NULL) ? Format : L"%c%c%c%c%c%c%c%c%c%c%c%c",
     Ptr[0],
     Ptr[1],
@@ -468,7 +539,7 @@ PrintFieldName (
   IN CONST CHAR16  *FieldName
   )
 {
-  Print (
+  AcpiViewPrint (
     L"%*a%-*s : ",
     gIndent + Indent,
     "",
@@ -534,6 +605,7 @@ ParseAcpi (
 
     if (HighLight) {
       OriginalAttribute = gST->ConOut->Mode->Attribute;
+      AcpiViewFlushOutput ();
       gST->ConOut->SetAttribute (
                      gST->ConOut,
                      EFI_TEXT_ATTR (
@@ -543,7 +615,7 @@ ParseAcpi (
                      );
     }
 
-    Print (
+    AcpiViewPrint (
       L"%*a%-*a :\n",
       gIndent,
       "",
@@ -551,6 +623,7 @@ ParseAcpi (
       AsciiName
       );
     if (HighLight) {
+      AcpiViewFlushOutput ();
       gST->ConOut->SetAttribute (gST->ConOut, OriginalAttribute);
     }
   }
@@ -571,7 +644,7 @@ ParseAcpi (
         (Offset != Parser[Index].Offset))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"\nERROR: %a: Offset Mismatch for %s\n"
         L"CurrentOffset = %d FieldOffset = %d\n",
         AsciiName,
@@ -603,7 +676,7 @@ ParseAcpi (
             DumpUint64 (Parser[Index].Format, Ptr);
             break;
           default:
-            Print (
+            AcpiViewPrint (
               L"\nERROR: %a: CANNOT PARSE THIS FIELD, Field Length = %d\n",
               AsciiName,
               Parser[Index].Length
@@ -619,7 +692,7 @@ ParseAcpi (
         Parser[Index].FieldValidator (Ptr, Parser[Index].Context);
       }
 
-      Print (L"\n");
+      AcpiViewPrint (L"\n");
     } // if (Trace)
 
     if (Parser[Index].ItemPtr != NULL) {
@@ -665,7 +738,7 @@ DumpGasStruct (
   IN UINT32  Length
   )
 {
-  Print (L"\n");
+  AcpiViewPrint (L"\n");
   return ParseAcpi (
            TRUE,
            Indent,
@@ -804,7 +877,7 @@ ParseAcpiBitFields (
 
   if ((Length == 0) || (Length > 8)) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: Bitfield Length(%d) is zero or exceeding the 64 bit limit.\n",
       Length
       );
@@ -826,6 +899,7 @@ ParseAcpiBitFields (
 
     if (HighLight) {
       OriginalAttribute = gST->ConOut->Mode->Attribute;
+      AcpiViewFlushOutput ();
       gST->ConOut->SetAttribute (
                      gST->ConOut,
                      EFI_TEXT_ATTR (
@@ -835,7 +909,7 @@ ParseAcpiBitFields (
                      );
     }
 
-    Print (
+    AcpiViewPrint (
       L"%*a%-*a :\n",
       gIndent,
       "",
@@ -843,6 +917,7 @@ ParseAcpiBitFields (
       AsciiName
       );
     if (HighLight) {
+      AcpiViewFlushOutput ();
       gST->ConOut->SetAttribute (gST->ConOut, OriginalAttribute);
     }
   }
@@ -862,7 +937,7 @@ ParseAcpiBitFields (
     if (Parser[Index].Length == 0) {
       IncrementErrorCount ();
       // don't parse the bitfield whose length is zero
-      Print (
+      AcpiViewPrint (
         L"\nERROR: %a: Cannot parse this field, Field Length = %d\n",
         Parser[Index].Length
         );
@@ -873,7 +948,7 @@ ParseAcpiBitFields (
         (Offset != Parser[Index].Offset))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"\nERROR: %a: Offset Mismatch for %s\n"
         L"CurrentOffset = %d FieldOffset = %d\n",
         AsciiName,
@@ -914,7 +989,7 @@ ParseAcpiBitFields (
             DumpUint64 (Parser[Index].Format, (UINT8 *)&Data);
             break;
           default:
-            Print (
+            AcpiViewPrint (
               L"\nERROR: %a: CANNOT PARSE THIS FIELD, Field Length = %d\n",
               AsciiName,
               Parser[Index].Length
@@ -930,7 +1005,7 @@ ParseAcpiBitFields (
         Parser[Index].FieldValidator ((UINT8 *)&Data, Parser[Index].Context);
       }
 
-      Print (L"\n");
+      AcpiViewPrint (L"\n");
     } // if (Trace)
 
     Offset += Parser[Index].Length;
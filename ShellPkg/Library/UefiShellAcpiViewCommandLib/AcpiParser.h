@@ -17,6 +17,37 @@
 /// that allows us to process the log options.
 #define RSDP_TABLE_INFO  SIGNATURE_32('R', 'S', 'D', 'P')
 
+/**
+  This function writes any buffered acpiview output to the console.
+
+  It must be called before changing the console attributes and before
+  anything is printed without going through AcpiViewPrint().
+**/
+VOID
+EFIAPI
+AcpiViewFlushOutput (
+  VOID
+  );
+
+/**
+  This function formats a string into the acpiview output buffer.
+
+  The output is written to the console when the buffer fills up or when
+  AcpiViewFlushOutput() is called.
+
+  @param [in] Format  Null-terminated Unicode format string.
+  @param [in] ...     Variable argument list whose contents are accessed
+                      based on the format string specified by Format.
+
+  @return The number of Unicode characters added to the output buffer.
+**/
+UINTN
+EFIAPI
+AcpiViewPrint (
+  IN CONST CHAR16  *Format,
+  ...
+  );
+
 /**
   This function increments the ACPI table error counter.
 **/
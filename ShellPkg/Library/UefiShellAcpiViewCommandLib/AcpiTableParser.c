@@ -211,7 +211,7 @@ ProcessAcpiTable (
     if (*AcpiTableLength < sizeof (EFI_ACPI_DESCRIPTION_HEADER)) {
       SignaturePtr = (CONST UINT8 *)AcpiTableSignature;
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Invalid %c%c%c%c table length. Length = %d\n",
         SignaturePtr[0],
         SignaturePtr[1],
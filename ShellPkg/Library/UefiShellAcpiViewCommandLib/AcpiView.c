@@ -60,7 +60,8 @@ DumpAcpiTableToFile (
     mBinTableCount++
     );
 
-  Print (L"Dumping ACPI table to : %s ... ", FileNameBuffer);
+  AcpiViewPrint (L"Dumping ACPI table to : %s ... ", FileNameBuffer);
+  AcpiViewFlushOutput ();
 
   TransferBytes = ShellDumpBufferToFile (FileNameBuffer, Ptr, Length);
   return (Length == TransferBytes);
@@ -112,6 +113,7 @@ ProcessTableReportOptions (
       if (mTableCount == 0) {
         if (HighLight) {
           OriginalAttribute = gST->ConOut->Mode->Attribute;
+          AcpiViewFlushOutput ();
           gST->ConOut->SetAttribute (
                          gST->ConOut,
                          EFI_TEXT_ATTR (
@@ -121,13 +123,14 @@ ProcessTableReportOptions (
                          );
         }
 
-        Print (L"\nInstalled Table(s):\n");
+        AcpiViewPrint (L"\nInstalled Table(s):\n");
         if (HighLight) {
+          AcpiViewFlushOutput ();
           gST->ConOut->SetAttribute (gST->ConOut, OriginalAttribute);
         }
       }
 
-      Print (
+      AcpiViewPrint (
         L"\t%4d. %c%c%c%c\n",
         ++mTableCount,
         SignaturePtr[0],
@@ -152,6 +155,7 @@ ProcessTableReportOptions (
   if (Log) {
     if (HighLight) {
       OriginalAttribute = gST->ConOut->Mode->Attribute;
+      AcpiViewFlushOutput ();
       gST->ConOut->SetAttribute (
                      gST->ConOut,
                      EFI_TEXT_ATTR (
@@ -161,7 +165,7 @@ ProcessTableReportOptions (
                      );
     }
 
-    Print (
+    AcpiViewPrint (
       L"\n\n --------------- %c%c%c%c Table --------------- \n\n",
       SignaturePtr[0],
       SignaturePtr[1],
@@ -169,6 +173,7 @@ ProcessTableReportOptions (
       SignaturePtr[3]
       );
     if (HighLight) {
+      AcpiViewFlushOutput ();
       gST->ConOut->SetAttribute (gST->ConOut, OriginalAttribute);
     }
   }
@@ -244,9 +249,10 @@ AcpiView (
     RsdpRevision = *(RsdpPtr + RSDP_REVISION_OFFSET);
 
     if (RsdpRevision < 2) {
-      Print (
+      AcpiViewPrint (
         L"ERROR: RSDP version less than 2 is not supported.\n"
         );
+      AcpiViewFlushOutput ();
       return EFI_UNSUPPORTED;
     }
 
@@ -264,9 +270,10 @@ AcpiView (
 
     Status = GetParser (RSDP_TABLE_INFO, &RsdpParserProc);
     if (EFI_ERROR (Status)) {
-      Print (
+      AcpiViewPrint (
         L"ERROR: No registered parser found for RSDP.\n"
         );
+      AcpiViewFlushOutput ();
       return Status;
     }
 
@@ -278,9 +285,10 @@ AcpiView (
       );
   } else {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Failed to find ACPI Table Guid in System Configuration Table.\n"
       );
+    AcpiViewFlushOutput ();
     return EFI_NOT_FOUND;
   }
 
@@ -297,13 +305,13 @@ AcpiView (
          (ReportDumpBinFile == ReportOption)) &&
         (!SelectedTable->Found))
     {
-      Print (L"\nRequested ACPI Table not found.\n");
+      AcpiViewPrint (L"\nRequested ACPI Table not found.\n");
     } else if (GetConsistencyChecking () &&
                (ReportDumpBinFile != ReportOption))
     {
       OriginalAttribute = gST->ConOut->Mode->Attribute;
 
-      Print (L"\nTable Statistics:\n");
+      AcpiViewPrint (L"\nTable Statistics:\n");
 
       if (GetColourHighlighting ()) {
         PrintAttribute = (GetErrorCount () > 0) ?
@@ -312,10 +320,11 @@ AcpiView (
                            ((OriginalAttribute&(BIT4|BIT5|BIT6))>>4)
                            ) :
                          OriginalAttribute;
+        AcpiViewFlushOutput ();
         gST->ConOut->SetAttribute (gST->ConOut, PrintAttribute);
       }
 
-      Print (L"\t%d Error(s)\n", GetErrorCount ());
+      AcpiViewPrint (L"\t%d Error(s)\n", GetErrorCount ());
 
       if (GetColourHighlighting ()) {
         PrintAttribute = (GetWarningCount () > 0) ?
@@ -325,16 +334,19 @@ AcpiView (
                            ) :
                          OriginalAttribute;
 
+        AcpiViewFlushOutput ();
         gST->ConOut->SetAttribute (gST->ConOut, PrintAttribute);
       }
 
-      Print (L"\t%d Warning(s)\n", GetWarningCount ());
+      AcpiViewPrint (L"\t%d Warning(s)\n", GetWarningCount ());
 
       if (GetColourHighlighting ()) {
+        AcpiViewFlushOutput ();
         gST->ConOut->SetAttribute (gST->ConOut, OriginalAttribute);
       }
     }
   }
 
+  AcpiViewFlushOutput ();
   return EFI_SUCCESS;
 }
@@ -184,7 +184,7 @@ ArmSbbrReqsValidate (
 
     if (Index >= ARRAY_SIZE (ArmSbbrTableCounts)) {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"\nERROR: SBBR v%a: Mandatory %c%c%c%c table's instance count not " \
         L"found\n",
         ArmSbbrVersions[Version],
@@ -199,7 +199,7 @@ ArmSbbrReqsValidate (
     if (ArmSbbrTableCounts[Index].Count == 0) {
       IsArmSbbrViolated = TRUE;
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"\nERROR: SBBR v%a: Mandatory %c%c%c%c table is missing",
         ArmSbbrVersions[Version],
         SignaturePtr[0],
@@ -211,13 +211,13 @@ ArmSbbrReqsValidate (
   }
 
   if (!IsArmSbbrViolated) {
-    Print (
+    AcpiViewPrint (
       L"\nINFO: SBBR v%a: All mandatory ACPI tables are installed",
       ArmSbbrVersions[Version]
       );
   }
 
-  Print (L"\n");
+  AcpiViewPrint (L"\n");
 
   return IsArmSbbrViolated ? EFI_NOT_FOUND : EFI_SUCCESS;
 }
@@ -48,7 +48,7 @@ ValidateProcessorFlags (
   // field must be set to 0 and ignored.
   if (((*Ptr & 0x3) != 0) && (*ProcessorId != 0)) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: 'ACPI Processor ID' field must be set to 0 for global"
       L" or shared nodes."
       );
@@ -75,7 +75,7 @@ ValidateGicInterfaceType (
   GicInterfaceType = *(UINT32 *)Ptr;
   if (GicInterfaceType > 3) {
     IncrementErrorCount ();
-    Print (L"\nError: Invalid GIC Interface type %d", GicInterfaceType);
+    AcpiViewPrint (L"\nError: Invalid GIC Interface type %d", GicInterfaceType);
   }
 }
 
@@ -96,7 +96,7 @@ ValidateInterfaceType (
 {
   if (*Ptr > 1) {
     IncrementErrorCount ();
-    Print (L"\nError: Interface type should be 0 or 1");
+    AcpiViewPrint (L"\nError: Interface type should be 0 or 1");
   }
 }
 
@@ -117,7 +117,7 @@ ValidateInterruptType (
 {
   if (*Ptr > 1) {
     IncrementErrorCount ();
-    Print (L"\nError: Interrupt type should be 0 or 1");
+    AcpiViewPrint (L"\nError: Interrupt type should be 0 or 1");
   }
 }
 
@@ -138,7 +138,7 @@ ValidateInterruptFlags (
 {
   if ((*Ptr & 0xfe) != 0) {
     IncrementErrorCount ();
-    Print (L"\nError: Reserved Flag bits not set to 0");
+    AcpiViewPrint (L"\nError: Reserved Flag bits not set to 0");
   }
 }
 
@@ -155,7 +155,7 @@ DumpVendorSpecificData (
   IN UINT8         *Ptr
   )
 {
-  Print (
+  AcpiViewPrint (
     L"%02X %02X %02X %02X %02X %02X %02X %02X\n",
     Ptr[0],
     Ptr[1],
@@ -167,7 +167,7 @@ DumpVendorSpecificData (
     Ptr[7]
     );
 
-  Print (
+  AcpiViewPrint (
     L"%*a   %02X %02X %02X %02X %02X %02X %02X %02X",
     OUTPUT_FIELD_COLUMN_WIDTH,
     "",
@@ -342,7 +342,7 @@ DumpProcessorNode (
       (ProcessorFlags == NULL))
   {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Insufficient Processor Error Node length. Length = %d.\n",
       Length
       );
@@ -382,7 +382,7 @@ DumpProcessorNode (
       break;
     default:
       IncrementErrorCount ();
-      Print (L"ERROR: Invalid Processor Resource Type.");
+      AcpiViewPrint (L"ERROR: Invalid Processor Resource Type.");
       return;
   } // switch
 }
@@ -523,7 +523,7 @@ DumpNodeInterrupts (
 
   if (Length < (InterruptCount * sizeof (EFI_ACPI_AEST_INTERRUPT_STRUCT))) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Node not long enough for Interrupt Array.\n" \
       L"       Length left = %d, Required = %d, Interrupt Count = %d\n",
       Length,
@@ -591,7 +591,7 @@ DumpAestNodeStructure (
 
   if ((Offset > DataOffset) || (DataOffset > Length)) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Invalid Node Data Offset: %d.\n" \
       L"       It should be between %d and %d.\n",
       DataOffset,
@@ -602,7 +602,7 @@ DumpAestNodeStructure (
 
   if ((Offset > InterfaceOffset) || (InterfaceOffset > Length)) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Invalid Node Interface Offset: %d.\n" \
       L"       It should be between %d and %d.\n",
       InterfaceOffset,
@@ -613,7 +613,7 @@ DumpAestNodeStructure (
 
   if ((Offset > InterruptArrayOffset) || (InterruptArrayOffset > Length)) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Invalid Node Interrupt Array Offset: %d.\n" \
       L"       It should be between %d and %d.\n",
       InterruptArrayOffset,
@@ -643,7 +643,7 @@ DumpAestNodeStructure (
       break;
     default:
       IncrementErrorCount ();
-      Print (L"ERROR: Invalid Error Node Type.\n");
+      AcpiViewPrint (L"ERROR: Invalid Error Node Type.\n");
       return;
   } // switch
 
@@ -722,7 +722,7 @@ ParseAcpiAest (
         (NodeInterruptCount == NULL))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Insufficient length left for Node Structure.\n" \
         L"       Length left = %d.\n",
         AcpiTableLength - Offset
@@ -735,7 +735,7 @@ ParseAcpiAest (
         ((Offset + (*AestNodeLength)) > AcpiTableLength))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Invalid AEST Node length. " \
         L"Length = %d. Offset = %d. AcpiTableLength = %d.\n",
         *AestNodeLength,
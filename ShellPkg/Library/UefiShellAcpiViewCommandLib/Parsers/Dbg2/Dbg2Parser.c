@@ -47,7 +47,7 @@ ValidateNameSpaceStrLen (
 
   if (NameSpaceStrLen < 2) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: NamespaceString Length = %d. If no Namespace device exists, " \
       L"NamespaceString[] must contain a period '.'",
       NameSpaceStrLen
@@ -134,7 +134,7 @@ DumpDbgDeviceInfo (
       (AddrSizeOffset == NULL))
   {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Insufficient Debug Device Information Structure length. " \
       L"Length = %d.\n",
       Length
@@ -160,7 +160,7 @@ DumpDbgDeviceInfo (
   // Debug Device Information structure
   if ((*AddrSizeOffset + (*GasCount * sizeof (UINT32))) > Length) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Invalid GAS count. GasCount = %d. RemainingBufferLength = %d. " \
       L"Parsing of the Debug Device Information structure aborted.\n",
       *GasCount,
@@ -176,7 +176,7 @@ DumpDbgDeviceInfo (
          (Offset < Length))
   {
     PrintFieldName (4, L"Address Size");
-    Print (L"0x%x\n", *((UINT32 *)(Ptr + Offset)));
+    AcpiViewPrint (L"0x%x\n", *((UINT32 *)(Ptr + Offset)));
     Offset += sizeof (UINT32);
   }
 
@@ -187,11 +187,11 @@ DumpDbgDeviceInfo (
   while ((Index++ < *NameSpaceStringLength) &&
          (Offset < Length))
   {
-    Print (L"%c", *(Ptr + Offset));
+    AcpiViewPrint (L"%c", *(Ptr + Offset));
     Offset++;
   }
 
-  Print (L"\n");
+  AcpiViewPrint (L"\n");
 
   // OEM Data
   if (*OEMDataOffset != 0) {
@@ -201,15 +201,15 @@ DumpDbgDeviceInfo (
     while ((Index++ < *OEMDataLength) &&
            (Offset < Length))
     {
-      Print (L"%x ", *(Ptr + Offset));
+      AcpiViewPrint (L"%x ", *(Ptr + Offset));
       if ((Index & 7) == 0) {
-        Print (L"\n%-*s   ", OUTPUT_FIELD_COLUMN_WIDTH, L"");
+        AcpiViewPrint (L"\n%-*s   ", OUTPUT_FIELD_COLUMN_WIDTH, L"");
       }
 
       Offset++;
     }
 
-    Print (L"\n");
+    AcpiViewPrint (L"\n");
   }
 }
 
@@ -256,7 +256,7 @@ ParseAcpiDbg2 (
       (NumberDbgDeviceInfo == NULL))
   {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Insufficient table length. AcpiTableLength = %d\n",
       AcpiTableLength
       );
@@ -281,7 +281,7 @@ ParseAcpiDbg2 (
     // successfully read.
     if (DbgDevInfoLen == NULL) {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Insufficient remaining table buffer length to read the " \
         L"Debug Device Information structure's 'Length' field. " \
         L"RemainingTableBufferLength = %d.\n",
@@ -295,7 +295,7 @@ ParseAcpiDbg2 (
         ((Offset + (*DbgDevInfoLen)) > AcpiTableLength))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Invalid Debug Device Information Structure length. " \
         L"Length = %d. Offset = %d. AcpiTableLength = %d.\n",
         *DbgDevInfoLen,
@@ -71,7 +71,7 @@ ValidateFirmwareCtrl (
  #if defined (MDE_CPU_ARM) || defined (MDE_CPU_AARCH64)
   if (*(UINT32 *)Ptr != 0) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: Firmware Control must be zero for ARM platforms."
       );
   }
@@ -97,7 +97,7 @@ ValidateXFirmwareCtrl (
  #if defined (MDE_CPU_ARM) || defined (MDE_CPU_AARCH64)
   if (*(UINT64 *)Ptr != 0) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: X Firmware Control must be zero for ARM platforms."
       );
   }
@@ -123,7 +123,7 @@ ValidateFlags (
  #if defined (MDE_CPU_ARM) || defined (MDE_CPU_AARCH64)
   if (((*(UINT32 *)Ptr) & HW_REDUCED_ACPI) == 0) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: HW_REDUCED_ACPI flag must be set for ARM platforms."
       );
   }
@@ -172,11 +172,11 @@ DumpFadtFlags (
   )
 {
   if (Format != NULL) {
-    Print (Format, *(UINT32 *)Ptr);
+    AcpiViewPrint (Format, *(UINT32 *)Ptr);
     return;
   }
 
-  Print (L"0x%X\n", *(UINT32 *)Ptr);
+  AcpiViewPrint (L"0x%X\n", *(UINT32 *)Ptr);
   ParseAcpiBitFields (
     TRUE,
     2,
@@ -291,14 +291,14 @@ ParseAcpiFadt (
 
   if (Trace) {
     if (FadtMinorRevision != NULL) {
-      Print (L"\nSummary:\n");
+      AcpiViewPrint (L"\nSummary:\n");
       PrintFieldName (2, L"FADT Version");
-      Print (L"%d.%d\n", *AcpiHdrInfo.Revision, *FadtMinorRevision);
+      AcpiViewPrint (L"%d.%d\n", *AcpiHdrInfo.Revision, *FadtMinorRevision);
     }
 
     if (*GetAcpiXsdtHeaderInfo ()->OemTableId != *AcpiHdrInfo.OemTableId) {
       IncrementErrorCount ();
-      Print (L"ERROR: OEM Table Id does not match with RSDT/XSDT.\n");
+      AcpiViewPrint (L"ERROR: OEM Table Id does not match with RSDT/XSDT.\n");
     }
   }
 
@@ -318,7 +318,7 @@ ParseAcpiFadt (
         ((*Flags & EFI_ACPI_6_3_HW_REDUCED_ACPI) != EFI_ACPI_6_3_HW_REDUCED_ACPI))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: No FACS table found, "
         L"both X_FIRMWARE_CTRL and FIRMWARE_CTRL are zero.\n"
         );
@@ -345,7 +345,7 @@ ParseAcpiFadt (
 
     Status = GetParser (FacsSignature, &FacsParserProc);
     if (EFI_ERROR (Status)) {
-      Print (
+      AcpiViewPrint (
         L"ERROR: No registered parser found for FACS.\n"
         );
       return;
@@ -372,7 +372,7 @@ ParseAcpiFadt (
       // as the CPU information MUST be presented in
       // the DSDT.
       IncrementErrorCount ();
-      Print (L"ERROR: Both X_DSDT and DSDT are invalid.\n");
+      AcpiViewPrint (L"ERROR: Both X_DSDT and DSDT are invalid.\n");
     }
 
  #endif
@@ -47,7 +47,7 @@ ValidateGtBlockTimerCount (
 
   if (BlockTimerCount > GT_BLOCK_TIMER_COUNT_MAX) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: Timer Count = %d. Max Timer Count is %d.",
       BlockTimerCount,
       GT_BLOCK_TIMER_COUNT_MAX
@@ -76,7 +76,7 @@ ValidateGtFrameNumber (
 
   if (FrameNumber >= GT_BLOCK_TIMER_COUNT_MAX) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: GT Frame Number = %d. GT Frame Number must be in range 0-%d.",
       FrameNumber,
       GT_BLOCK_TIMER_COUNT_MAX - 1
@@ -196,7 +196,7 @@ DumpGTBlock (
       (GtBlockTimerOffset == NULL))
   {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Insufficient GT Block Structure length. Length = %d.\n",
       Length
       );
@@ -293,7 +293,7 @@ ParseAcpiGtdt (
       (GtdtPlatformTimerOffset == NULL))
   {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Insufficient table length. AcpiTableLength = %d.\n",
       AcpiTableLength
       );
@@ -325,7 +325,7 @@ ParseAcpiGtdt (
         (PlatformTimerLength == NULL))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Insufficient remaining table buffer length to read the " \
         L"Platform Timer Structure header. Length = %d.\n",
         AcpiTableLength - Offset
@@ -338,7 +338,7 @@ ParseAcpiGtdt (
         ((Offset + (*PlatformTimerLength)) > AcpiTableLength))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Invalid Platform Timer Structure length. " \
         L"Length = %d. Offset = %d. AcpiTableLength = %d.\n",
         *PlatformTimerLength,
@@ -357,7 +357,7 @@ ParseAcpiGtdt (
         break;
       default:
         IncrementErrorCount ();
-        Print (
+        AcpiViewPrint (
           L"ERROR: Invalid Platform Timer Type = %d\n",
           *PlatformTimerType
           );
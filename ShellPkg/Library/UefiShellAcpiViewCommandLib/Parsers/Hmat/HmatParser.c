@@ -73,7 +73,7 @@ ValidateCacheAttributes (
 
   if (Attributes->TotalCacheLevels > 0x3) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: Attributes bits [3:0] have invalid value: 0x%x",
       Attributes->TotalCacheLevels
       );
@@ -81,7 +81,7 @@ ValidateCacheAttributes (
 
   if (Attributes->CacheLevel > 0x3) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: Attributes bits [7:4] have invalid value: 0x%x",
       Attributes->CacheLevel
       );
@@ -89,7 +89,7 @@ ValidateCacheAttributes (
 
   if (Attributes->CacheAssociativity > 0x2) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: Attributes bits [11:8] have invalid value: 0x%x",
       Attributes->CacheAssociativity
       );
@@ -97,7 +97,7 @@ ValidateCacheAttributes (
 
   if (Attributes->WritePolicy > 0x2) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: Attributes bits [15:12] have invalid value: 0x%x",
       Attributes->WritePolicy
       );
@@ -124,17 +124,17 @@ DumpCacheAttributes (
   Attributes =
     (EFI_ACPI_6_4_HMAT_STRUCTURE_MEMORY_SIDE_CACHE_INFO_CACHE_ATTRIBUTES *)Ptr;
 
-  Print (L"\n");
+  AcpiViewPrint (L"\n");
   PrintFieldName (4, L"Total Cache Levels");
-  Print (L"%d\n", Attributes->TotalCacheLevels);
+  AcpiViewPrint (L"%d\n", Attributes->TotalCacheLevels);
   PrintFieldName (4, L"Cache Level");
-  Print (L"%d\n", Attributes->CacheLevel);
+  AcpiViewPrint (L"%d\n", Attributes->CacheLevel);
   PrintFieldName (4, L"Cache Associativity");
-  Print (L"%d\n", Attributes->CacheAssociativity);
+  AcpiViewPrint (L"%d\n", Attributes->CacheAssociativity);
   PrintFieldName (4, L"Write Policy");
-  Print (L"%d\n", Attributes->WritePolicy);
+  AcpiViewPrint (L"%d\n", Attributes->WritePolicy);
   PrintFieldName (4, L"Cache Line Size");
-  Print (L"%d\n", Attributes->CacheLineSize);
+  AcpiViewPrint (L"%d\n", Attributes->CacheLineSize);
 }
 
 /**
@@ -284,7 +284,7 @@ DumpSllbi (
       (NumberTargetProximityDomain == NULL))
   {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Insufficient remaining table buffer length to read the " \
       L"SLLBI structure header. Length = %d.\n",
       Length
@@ -300,7 +300,7 @@ DumpSllbi (
 
   if (RequiredTableSize > Length) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Insufficient System Locality Latency and Bandwidth" \
       L"Information Structure length. TableLength = %d. " \
       L"RequiredTableLength = %d.\n",
@@ -326,7 +326,7 @@ DumpSllbi (
       );
 
     PrintFieldName (4, Buffer);
-    Print (
+    AcpiViewPrint (
       L"0x%x\n",
       InitiatorProximityDomainList[Index]
       );
@@ -342,7 +342,7 @@ DumpSllbi (
       );
 
     PrintFieldName (4, Buffer);
-    Print (
+    AcpiViewPrint (
       L"0x%x\n",
       TargetProximityDomainList[Index]
       );
@@ -351,7 +351,7 @@ DumpSllbi (
   // Create base name depending on Data Type in this Structure
   if (*SllbiDataType >= ARRAY_SIZE (SllbiNames)) {
     IncrementErrorCount ();
-    Print (L"Error: Unkown Data Type. DataType = 0x%x.\n", *SllbiDataType);
+    AcpiViewPrint (L"Error: Unkown Data Type. DataType = 0x%x.\n", *SllbiDataType);
     return;
   }
 
@@ -381,7 +381,7 @@ DumpSllbi (
       break;
     default:
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"Error: Invalid Memory Hierarchy. MemoryHierarchy = %d.\n",
         SllbiFlags->MemoryHierarchy
         );
@@ -398,48 +398,48 @@ DumpSllbi (
       );
     PrintFieldName (4, Buffer);
 
-    Print (L"\n      Target    : X-axis (Horizontal)");
-    Print (L"\n      Initiator : Y-axis (Vertical)");
-    Print (L"\n         |");
+    AcpiViewPrint (L"\n      Target    : X-axis (Horizontal)");
+    AcpiViewPrint (L"\n      Initiator : Y-axis (Vertical)");
+    AcpiViewPrint (L"\n         |");
 
     for (IndexTarget = 0;
          IndexTarget < *NumberTargetProximityDomain;
          IndexTarget++)
     {
-      Print (L"    %2d", IndexTarget);
+      AcpiViewPrint (L"    %2d", IndexTarget);
     }
 
-    Print (L"\n      ---+");
+    AcpiViewPrint (L"\n      ---+");
     for (IndexTarget = 0;
          IndexTarget < *NumberTargetProximityDomain;
          IndexTarget++)
     {
-      Print (L"------");
+      AcpiViewPrint (L"------");
     }
 
-    Print (L"\n");
+    AcpiViewPrint (L"\n");
 
     TargetStartOffset = 0;
     for (IndexInitiator = 0;
          IndexInitiator < *NumberInitiatorProximityDomain;
          IndexInitiator++)
     {
-      Print (L"      %2d |", IndexInitiator);
+      AcpiViewPrint (L"      %2d |", IndexInitiator);
       for (IndexTarget = 0;
            IndexTarget < *NumberTargetProximityDomain;
            IndexTarget++)
       {
-        Print (
+        AcpiViewPrint (
           L" %5d",
           LatencyBandwidthMatrix[TargetStartOffset + IndexTarget]
           );
       } // for Target
 
-      Print (L"\n");
+      AcpiViewPrint (L"\n");
       TargetStartOffset += (*NumberTargetProximityDomain);
     } // for Initiator
 
-    Print (L"\n");
+    AcpiViewPrint (L"\n");
   } else {
     // Display the latency/bandwidth matrix as a list
     UnicodeSPrint (
@@ -467,7 +467,7 @@ DumpSllbi (
           );
 
         PrintFieldName (4, SecondBuffer);
-        Print (
+        AcpiViewPrint (
           L"%d\n",
           LatencyBandwidthMatrix[TargetStartOffset + IndexTarget]
           );
@@ -510,7 +510,7 @@ DumpMsci (
   // successfully read.
   if (NumberSMBIOSHandles == NULL) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Insufficient remaining table buffer length to read the " \
       L"MSCI structure header. Length = %d.\n",
       Length
@@ -520,7 +520,7 @@ DumpMsci (
 
   if ((*NumberSMBIOSHandles * sizeof (UINT16)) > (Length - Offset)) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Invalid Number of SMBIOS Handles. SMBIOSHandlesCount = %d." \
       L"RemainingBufferLength = %d.\n",
       *NumberSMBIOSHandles,
@@ -540,7 +540,7 @@ DumpMsci (
       );
 
     PrintFieldName (4, Buffer);
-    Print (
+    AcpiViewPrint (
       L"0x%x\n",
       SMBIOSHandlesList[Index]
       );
@@ -608,7 +608,7 @@ ParseAcpiHmat (
         (HmatStructureLength == NULL))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Insufficient remaining table buffer length to read the " \
         L"HMAT structure header. Length = %d.\n",
         AcpiTableLength - Offset
@@ -621,7 +621,7 @@ ParseAcpiHmat (
         ((Offset + (*HmatStructureLength)) > AcpiTableLength))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Invalid HMAT Structure length. " \
         L"Length = %d. Offset = %d. AcpiTableLength = %d.\n",
         *HmatStructureLength,
@@ -652,7 +652,7 @@ ParseAcpiHmat (
         break;
       default:
         IncrementErrorCount ();
-        Print (
+        AcpiViewPrint (
           L"ERROR: Unknown HMAT structure:"
           L" Type = %d, Length = %d\n",
           *HmatStructureType,
@@ -50,7 +50,7 @@ ValidateItsIdMappingCount (
 {
   if (*(UINT32 *)Ptr != 0) {
     IncrementErrorCount ();
-    Print (L"\nERROR: IORT ID Mapping count must be zero.");
+    AcpiViewPrint (L"\nERROR: IORT ID Mapping count must be zero.");
   }
 }
 
@@ -72,7 +72,7 @@ ValidatePmcgIdMappingCount (
 {
   if (*(UINT32 *)Ptr > 1) {
     IncrementErrorCount ();
-    Print (L"\nERROR: IORT ID Mapping count must not be greater than 1.");
+    AcpiViewPrint (L"\nERROR: IORT ID Mapping count must not be greater than 1.");
   }
 }
 
@@ -93,7 +93,7 @@ ValidateItsIdArrayReference (
 {
   if (*(UINT32 *)Ptr != 0) {
     IncrementErrorCount ();
-    Print (L"\nERROR: IORT ID Mapping offset must be zero.");
+    AcpiViewPrint (L"\nERROR: IORT ID Mapping offset must be zero.");
   }
 }
 
@@ -332,7 +332,7 @@ DumpIortNodeSmmuV1V2 (
       (PmuInterruptOffset == NULL))
   {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Insufficient SMMUv1/2 node length. Length = %d\n",
       Length
       );
@@ -456,7 +456,7 @@ DumpIortNodeIts (
   // successfully read.
   if (ItsCount == NULL) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Insufficient ITS group length. Length = %d.\n",
       Length
       );
@@ -523,11 +523,11 @@ DumpIortNodeNamedComponent (
   while ((*(Ptr + Offset) != 0) &&
          (Offset < Length))
   {
-    Print (L"%c", *(Ptr + Offset));
+    AcpiViewPrint (L"%c", *(Ptr + Offset));
     Offset++;
   }
 
-  Print (L"\n");
+  AcpiViewPrint (L"\n");
 
   DumpIortNodeIdMappings (
     Ptr + MappingOffset,
@@ -655,7 +655,7 @@ ParseAcpiIort (
       (IortNodeOffset == NULL))
   {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Insufficient table length. AcpiTableLength = %d.\n",
       AcpiTableLength
       );
@@ -689,7 +689,7 @@ ParseAcpiIort (
         (IortIdMappingOffset == NULL))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Insufficient remaining table buffer length to read the " \
         L"IORT node header. Length = %d.\n",
         AcpiTableLength - Offset
@@ -702,7 +702,7 @@ ParseAcpiIort (
         ((Offset + (*IortNodeLength)) > AcpiTableLength))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Invalid IORT Node length. " \
         L"Length = %d. Offset = %d. AcpiTableLength = %d.\n",
         *IortNodeLength,
@@ -713,7 +713,7 @@ ParseAcpiIort (
     }
 
     PrintFieldName (2, L"* Node Offset *");
-    Print (L"0x%x\n", Offset);
+    AcpiViewPrint (L"0x%x\n", Offset);
 
     switch (*IortNodeType) {
       case EFI_ACPI_IORT_TYPE_ITS_GROUP:
@@ -765,7 +765,7 @@ ParseAcpiIort (
 
       default:
         IncrementErrorCount ();
-        Print (L"ERROR: Unsupported IORT Node type = %d\n", *IortNodeType);
+        AcpiViewPrint (L"ERROR: Unsupported IORT Node type = %d\n", *IortNodeType);
     } // switch
 
     NodePtr += (*IortNodeLength);
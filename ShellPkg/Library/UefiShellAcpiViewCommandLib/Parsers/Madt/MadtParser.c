@@ -40,7 +40,7 @@ ValidateGICDSystemVectorBase (
 {
   if (*(UINT32 *)Ptr != 0) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: System Vector Base must be zero."
       );
   }
@@ -76,7 +76,7 @@ ValidateSpeOverflowInterrupt (
       (SpeOverflowInterrupt > ARM_PPI_ID_EXTENDED_MAX))
   {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: SPE Overflow Interrupt ID of %d is not in the allowed PPI ID "
       L"ranges of %d-%d or %d-%d (for GICv3.1 or later).",
       SpeOverflowInterrupt,
@@ -87,7 +87,7 @@ ValidateSpeOverflowInterrupt (
       );
   } else if (SpeOverflowInterrupt != ARM_PPI_ID_PMBIRQ) {
     IncrementWarningCount ();
-    Print (
+    AcpiViewPrint (
       L"\nWARNING: SPE Overflow Interrupt ID of %d is not compliant with SBSA "
       L"Level 3 PPI ID assignment: %d.",
       SpeOverflowInterrupt,
@@ -318,7 +318,7 @@ ParseAcpiMadt (
         (MadtInterruptControllerLength == NULL))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Insufficient remaining table buffer length to read the " \
         L"Interrupt Controller Structure header. Length = %d.\n",
         AcpiTableLength - Offset
@@ -331,7 +331,7 @@ ParseAcpiMadt (
         ((Offset + (*MadtInterruptControllerLength)) > AcpiTableLength))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Invalid Interrupt Controller Structure length. " \
         L"Length = %d. Offset = %d. AcpiTableLength = %d.\n",
         *MadtInterruptControllerLength,
@@ -359,7 +359,7 @@ ParseAcpiMadt (
       {
         if (++GICDCount > 1) {
           IncrementErrorCount ();
-          Print (
+          AcpiViewPrint (
             L"ERROR: Only one GICD must be present,"
             L" GICDCount = %d\n",
             GICDCount
@@ -471,7 +471,7 @@ ParseAcpiMadt (
       default:
       {
         IncrementErrorCount ();
-        Print (
+        AcpiViewPrint (
           L"ERROR: Unknown Interrupt Controller Structure,"
           L" Type = %d, Length = %d\n",
           *MadtInterruptControllerType,
@@ -41,7 +41,7 @@ ValidateRangeLength4 (
 {
   if (*(UINT32 *)Ptr < MIN_EXT_PCC_SUBSPACE_MEM_RANGE_LEN) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nError: Shared memory range length is too short.\n"
       L"Length is %u when it should be greater than or equal to %u",
       *(UINT32 *)Ptr,
@@ -67,7 +67,7 @@ ValidateRangeLength8 (
 {
   if (*(UINT64 *)Ptr <= MIN_MEMORY_RANGE_LENGTH) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nError: Shared memory range length is too short.\n"
       L"Length is %u when it should be greater than %u",
       *(UINT64 *)Ptr,
@@ -99,7 +99,7 @@ ValidatePccMemoryIoGas (
       return;
     default:
       IncrementErrorCount ();
-      Print (L"\nError: Invalid address space");
+      AcpiViewPrint (L"\nError: Invalid address space");
   }
 }
 
@@ -127,7 +127,7 @@ ValidatePccGas (
       return;
     default:
       IncrementErrorCount ();
-      Print (L"\nError: Invalid address space");
+      AcpiViewPrint (L"\nError: Invalid address space");
   }
 }
 
@@ -244,7 +244,7 @@ ValidatePlatInterrupt (
        EFI_ACPI_6_4_PCCT_FLAGS_PLATFORM_INTERRUPT))
   {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nError: Global Platform interrupt flag must be set to 1" \
       L" if a PCC type 4 structure is present in PCCT."
       );
@@ -591,7 +591,7 @@ ParseAcpiPcct (
         (PccSubspaceLength == NULL))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Insufficient remaining table buffer length to read the " \
         L"structure header. Length = %u.\n",
         AcpiTableLength - Offset
@@ -604,7 +604,7 @@ ParseAcpiPcct (
         ((Offset + (*PccSubspaceLength)) > AcpiTableLength))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Invalid Structure length. " \
         L"Length = %u. Offset = %u. AcpiTableLength = %u.\n",
         *PccSubspaceLength,
@@ -653,7 +653,7 @@ ParseAcpiPcct (
         break;
       default:
         IncrementErrorCount ();
-        Print (
+        AcpiViewPrint (
           L"ERROR: Unknown PCC subspace structure:"
           L" Type = %u, Length = %u\n",
           PccSubspaceType,
@@ -668,6 +668,6 @@ ParseAcpiPcct (
 
   if (SubspaceCount > MAX_PCC_SUBSPACES) {
     IncrementErrorCount ();
-    Print (L"ERROR: Too many PCC subspaces.");
+    AcpiViewPrint (L"ERROR: Too many PCC subspaces.");
   }
 }
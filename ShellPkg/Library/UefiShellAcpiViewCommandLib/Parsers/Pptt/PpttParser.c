@@ -38,7 +38,7 @@ LogCacheFlagError (
   )
 {
   IncrementErrorCount ();
-  Print (
+  AcpiViewPrint (
     L"\nERROR: On Arm based systems, all cache properties must be"
     L" provided in the cache type structure."
     L" Missing '%s' flag.",
@@ -68,7 +68,7 @@ ValidateCacheFlags (
 
   if (CacheFlags == NULL) {
     IncrementErrorCount ();
-    Print (L"\nERROR: Cache Structure Flags were not successfully read.");
+    AcpiViewPrint (L"\nERROR: Cache Structure Flags were not successfully read.");
     return;
   }
 
@@ -132,14 +132,14 @@ ValidateCacheNumberOfSets (
 
   if (NumberOfSets == 0) {
     IncrementErrorCount ();
-    Print (L"\nERROR: Cache number of sets must be greater than 0");
+    AcpiViewPrint (L"\nERROR: Cache number of sets must be greater than 0");
     return;
   }
 
  #if defined (MDE_CPU_ARM) || defined (MDE_CPU_AARCH64)
   if (NumberOfSets > PPTT_ARM_CCIDX_CACHE_NUMBER_OF_SETS_MAX) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: When ARMv8.3-CCIDX is implemented the maximum cache number of "
       L"sets must be less than or equal to %d",
       PPTT_ARM_CCIDX_CACHE_NUMBER_OF_SETS_MAX
@@ -149,7 +149,7 @@ ValidateCacheNumberOfSets (
 
   if (NumberOfSets > PPTT_ARM_CACHE_NUMBER_OF_SETS_MAX) {
     IncrementWarningCount ();
-    Print (
+    AcpiViewPrint (
       L"\nWARNING: Without ARMv8.3-CCIDX, the maximum cache number of sets "
       L"must be less than or equal to %d. Ignore this message if "
       L"ARMv8.3-CCIDX is implemented",
@@ -183,7 +183,7 @@ ValidateCacheAssociativity (
 
   if (Associativity == 0) {
     IncrementErrorCount ();
-    Print (L"\nERROR: Cache associativity must be greater than 0");
+    AcpiViewPrint (L"\nERROR: Cache associativity must be greater than 0");
     return;
   }
 }
@@ -216,7 +216,7 @@ ValidateCacheLineSize (
       (LineSize > PPTT_ARM_CACHE_LINE_SIZE_MAX))
   {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: The cache line size must be between %d and %d bytes"
       L" on ARM Platforms.",
       PPTT_ARM_CACHE_LINE_SIZE_MIN,
@@ -227,7 +227,7 @@ ValidateCacheLineSize (
 
   if ((LineSize & (LineSize - 1)) != 0) {
     IncrementErrorCount ();
-    Print (L"\nERROR: The cache line size is not a power of 2.");
+    AcpiViewPrint (L"\nERROR: The cache line size is not a power of 2.");
   }
 
  #endif
@@ -259,14 +259,14 @@ ValidateCacheId (
 
   if (CacheFlags == NULL) {
     IncrementErrorCount ();
-    Print (L"\nERROR: Cache Structure Flags were not successfully read.");
+    AcpiViewPrint (L"\nERROR: Cache Structure Flags were not successfully read.");
     return;
   }
 
   if (CacheFlags->CacheIdValid == EFI_ACPI_6_4_PPTT_CACHE_ID_VALID) {
     if (CacheId == 0) {
       IncrementErrorCount ();
-      Print (L"\nERROR: 0 is not a valid Cache ID.");
+      AcpiViewPrint (L"\nERROR: 0 is not a valid Cache ID.");
       return;
     }
   }
@@ -296,7 +296,7 @@ ValidateCacheAttributes (
 
   if ((Attributes & 0xE0) != 0) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: Attributes bits [7:5] are reserved and must be zero.",
       Attributes
       );
@@ -387,7 +387,7 @@ DumpProcessorHierarchyNodeStructure (
   // successfully read.
   if (NumberOfPrivateResources == NULL) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Insufficient Processor Hierarchy Node length. Length = %d.\n",
       Length
       );
@@ -397,7 +397,7 @@ DumpProcessorHierarchyNodeStructure (
   // Make sure the Private Resource array lies inside this structure
   if (Offset + (*NumberOfPrivateResources * sizeof (UINT32)) > Length) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Invalid Number of Private Resources. " \
       L"PrivateResourceCount = %d. RemainingBufferLength = %d. " \
       L"Parsing of this structure aborted.\n",
@@ -420,7 +420,7 @@ DumpProcessorHierarchyNodeStructure (
       );
 
     PrintFieldName (4, Buffer);
-    Print (
+    AcpiViewPrint (
       L"0x%x\n",
       *((UINT32 *)(Ptr + Offset))
       );
@@ -513,7 +513,7 @@ ParseAcpiPptt (
         (ProcessorTopologyStructureLength == NULL))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Insufficient remaining table buffer length to read the " \
         L"processor topology structure header. Length = %d.\n",
         AcpiTableLength - Offset
@@ -526,7 +526,7 @@ ParseAcpiPptt (
         ((Offset + (*ProcessorTopologyStructureLength)) > AcpiTableLength))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Invalid Processor Topology Structure length. " \
         L"Length = %d. Offset = %d. AcpiTableLength = %d.\n",
         *ProcessorTopologyStructureLength,
@@ -537,7 +537,7 @@ ParseAcpiPptt (
     }
 
     PrintFieldName (2, L"* Structure Offset *");
-    Print (L"0x%x\n", Offset);
+    AcpiViewPrint (L"0x%x\n", Offset);
 
     switch (*ProcessorTopologyStructureType) {
       case EFI_ACPI_6_4_PPTT_TYPE_PROCESSOR:
@@ -554,14 +554,14 @@ ParseAcpiPptt (
         break;
       case EFI_ACPI_6_3_PPTT_TYPE_ID:
         IncrementErrorCount ();
-        Print (
+        AcpiViewPrint (
           L"ERROR: PPTT Type 2 - Processor ID has been removed and must not be"
           L"used.\n"
           );
         break;
       default:
         IncrementErrorCount ();
-        Print (
+        AcpiViewPrint (
           L"ERROR: Unknown processor topology structure:"
           L" Type = %d, Length = %d\n",
           *ProcessorTopologyStructureType,
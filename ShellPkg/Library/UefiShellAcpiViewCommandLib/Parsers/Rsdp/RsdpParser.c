@@ -42,7 +42,7 @@ ValidateRsdtAddress (
 
   if (RsdtAddr != 0) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: Rsdt Address = 0x%p. This must be NULL on ARM Platforms.",
       RsdtAddr
       );
@@ -78,7 +78,7 @@ ValidateXsdtAddress (
 
   if (XsdtAddr == 0) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: Xsdt Address = 0x%p. This must not be NULL on ARM Platforms.",
       XsdtAddr
       );
@@ -144,7 +144,7 @@ ParseAcpiRsdp (
   // successfully read.
   if (XsdtAddress == NULL) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Insufficient table length. AcpiTableLength = %d." \
       L"RSDP parsing aborted.\n",
       AcpiTableLength
@@ -158,7 +158,7 @@ ParseAcpiRsdp (
   // Therefore the RSDT should not be used on ARM platforms.
   if ((*XsdtAddress) == 0) {
     IncrementErrorCount ();
-    Print (L"ERROR: XSDT Pointer is not set. RSDP parsing aborted.\n");
+    AcpiViewPrint (L"ERROR: XSDT Pointer is not set. RSDP parsing aborted.\n");
     return;
   }
 
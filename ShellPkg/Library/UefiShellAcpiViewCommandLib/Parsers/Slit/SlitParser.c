@@ -80,7 +80,7 @@ ParseAcpiSlit (
   // successfully read.
   if (SlitSystemLocalityCount == NULL) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Insufficient table length. AcpiTableLength = %d.\n",
       AcpiTableLength
       );
@@ -101,7 +101,7 @@ ParseAcpiSlit (
   */
   if (*SlitSystemLocalityCount > MAX_UINT16) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: The Number of System Localities provided can't be represented " \
       L"in the SLIT table. SlitSystemLocalityCount = %ld. " \
       L"MaxLocalityCountAllowed = %d.\n",
@@ -116,7 +116,7 @@ ParseAcpiSlit (
   // Make sure system localities fit in the table buffer provided
   if (Offset + (LocalityCount * LocalityCount) > AcpiTableLength) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"ERROR: Invalid Number of System Localities. " \
       L"SlitSystemLocalityCount = %ld. AcpiTableLength = %d.\n",
       *SlitSystemLocalityCount,
@@ -139,20 +139,20 @@ ParseAcpiSlit (
       LocalityCount
       );
     PrintFieldName (0, Buffer);
-    Print (L"\n");
-    Print (L"       ");
+    AcpiViewPrint (L"\n");
+    AcpiViewPrint (L"       ");
     for (Index = 0; Index < LocalityCount; Index++) {
-      Print (L" (%3d) ", Index);
+      AcpiViewPrint (L" (%3d) ", Index);
     }
 
-    Print (L"\n");
+    AcpiViewPrint (L"\n");
     for (Count = 0; Count < LocalityCount; Count++) {
-      Print (L" (%3d) ", Count);
+      AcpiViewPrint (L" (%3d) ", Count);
       for (Index = 0; Index < LocalityCount; Index++) {
-        Print (L"  %3d  ", SLIT_ELEMENT (LocalityPtr, Count, Index));
+        AcpiViewPrint (L"  %3d  ", SLIT_ELEMENT (LocalityPtr, Count, Index));
       }
 
-      Print (L"\n");
+      AcpiViewPrint (L"\n");
     }
   }
 
@@ -162,7 +162,7 @@ ParseAcpiSlit (
       // Element[x][x] must be equal to 10
       if ((Count == Index) && (SLIT_ELEMENT (LocalityPtr, Count, Index) != 10)) {
         IncrementErrorCount ();
-        Print (
+        AcpiViewPrint (
           L"ERROR: Diagonal Element[0x%lx][0x%lx] (%3d)."
           L" Normalized Value is not 10\n",
           Count,
@@ -176,7 +176,7 @@ ParseAcpiSlit (
           SLIT_ELEMENT (LocalityPtr, Index, Count))
       {
         IncrementErrorCount ();
-        Print (
+        AcpiViewPrint (
           L"ERROR: Relative distances for Element[0x%lx][0x%lx] (%3d) and \n"
           L"Element[0x%lx][0x%lx] (%3d) do not match.\n",
           Count,
@@ -42,7 +42,7 @@ ValidateInterruptType (
       EFI_ACPI_SERIAL_PORT_CONSOLE_REDIRECTION_TABLE_INTERRUPT_TYPE_GIC)
   {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: InterruptType = %d. This must be 8 on ARM Platforms",
       InterruptType
       );
@@ -73,7 +73,7 @@ ValidateIrq (
 
   if (Irq != 0) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: Irq = %d. This must be zero on ARM Platforms\n",
       Irq
       );
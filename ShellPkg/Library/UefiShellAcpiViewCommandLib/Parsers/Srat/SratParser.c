@@ -38,7 +38,7 @@ ValidateSratReserved (
 {
   if (*(UINT32 *)Ptr != 1) {
     IncrementErrorCount ();
-    Print (L"\nERROR: Reserved should be 1 for backward compatibility.\n");
+    AcpiViewPrint (L"\nERROR: Reserved should be 1 for backward compatibility.\n");
   }
 }
 
@@ -64,7 +64,7 @@ ValidateSratDeviceHandleType (
 
   if (DeviceHandleType > EFI_ACPI_6_3_PCI_DEVICE_HANDLE) {
     IncrementErrorCount ();
-    Print (
+    AcpiViewPrint (
       L"\nERROR: Invalid Device Handle Type: %d. Must be between 0 and %d.",
       DeviceHandleType,
       EFI_ACPI_6_3_PCI_DEVICE_HANDLE
@@ -88,7 +88,7 @@ DumpSratPciBdfNumber (
 {
   CHAR16  Buffer[OUTPUT_FIELD_COLUMN_WIDTH];
 
-  Print (L"\n");
+  AcpiViewPrint (L"\n");
 
   /*
     The PCI BDF Number subfields are printed in the order specified in the ACPI
@@ -108,7 +108,7 @@ DumpSratPciBdfNumber (
     L"PCI Bus Number"
     );
   PrintFieldName (4, Buffer);
-  Print (
+  AcpiViewPrint (
     L"0x%x\n",
     *Ptr
     );
@@ -122,7 +122,7 @@ DumpSratPciBdfNumber (
     L"PCI Device Number"
     );
   PrintFieldName (4, Buffer);
-  Print (
+  AcpiViewPrint (
     L"0x%x\n",
     (*Ptr & (BIT7 | BIT6 | BIT5 | BIT4 | BIT3)) >> 3
     );
@@ -134,7 +134,7 @@ DumpSratPciBdfNumber (
     L"PCI Function Number"
     );
   PrintFieldName (4, Buffer);
-  Print (
+  AcpiViewPrint (
     L"0x%x\n",
     *Ptr & (BIT2 | BIT1 | BIT0)
     );
@@ -176,11 +176,11 @@ DumpSratDeviceHandle (
 {
   if (SratDeviceHandleType == NULL) {
     IncrementErrorCount ();
-    Print (L"\nERROR: Device Handle Type read incorrectly.\n");
+    AcpiViewPrint (L"\nERROR: Device Handle Type read incorrectly.\n");
     return;
   }
 
-  Print (L"\n");
+  AcpiViewPrint (L"\n");
 
   if (*SratDeviceHandleType == EFI_ACPI_6_3_ACPI_DEVICE_HANDLE) {
     ParseAcpi (
@@ -221,7 +221,7 @@ DumpSratApicProximity (
 
   ProximityDomain = Ptr[0] | (Ptr[1] << 8) | (Ptr[2] << 16);
 
-  Print (Format, ProximityDomain);
+  AcpiViewPrint (Format, ProximityDomain);
 }
 
 /**
@@ -406,7 +406,7 @@ ParseAcpiSrat (
         (SratRALength == NULL))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Insufficient remaining table buffer length to read the " \
         L"Static Resource Allocation structure header. Length = %d.\n",
         AcpiTableLength - Offset
@@ -419,7 +419,7 @@ ParseAcpiSrat (
         ((Offset + (*SratRALength)) > AcpiTableLength))
     {
       IncrementErrorCount ();
-      Print (
+      AcpiViewPrint (
         L"ERROR: Invalid Static Resource Allocation Structure length. " \
         L"Length = %d. Offset = %d. AcpiTableLength = %d.\n",
         *SratRALength,
@@ -534,7 +534,7 @@ ParseAcpiSrat (
 
       default:
         IncrementErrorCount ();
-        Print (L"ERROR: Unknown SRAT Affinity type = 0x%x\n", *SratRAType);
+        AcpiViewPrint (L"ERROR: Unknown SRAT Affinity type = 0x%x\n", *SratRAType);
         break;
     }
 
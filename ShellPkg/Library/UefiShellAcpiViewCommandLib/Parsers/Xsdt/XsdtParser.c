@@ -111,12 +111,12 @@ ParseAcpiXsdt (
       }
 
       PrintFieldName (2, Buffer);
-      Print (L"0x%lx\n", *TablePointer);
+      AcpiViewPrint (L"0x%lx\n", *TablePointer);
 
       // Validate the table pointers are not NULL
       if ((UINT64 *)(UINTN)(*TablePointer) == NULL) {
         IncrementErrorCount ();
-        Print (
+        AcpiViewPrint (
           L"ERROR: Invalid table entry at 0x%lx, table address is 0x%lx\n",
           TablePointer,
           *TablePointer
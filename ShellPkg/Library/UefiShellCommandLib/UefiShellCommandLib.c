@@ -1887,6 +1887,87 @@ FreeBufferList (
   }
 }
 
+//
+// Characters in one line of hex dump output after the indent:
+// "%08X: ", 16 * "XX ", " *", up to 16 ASCII characters, "*\r\n".
+//
+#define DUMP_HEX_LINE_CHARS  (10 + 48 + 2 + 16 + 3)
+
+//
+// Upper bound on the number of hex dump lines handed to the console at once.
+//
+#define DUMP_HEX_MAX_CHUNK_LINES  64
+
+/**
+  Format one line of hex dump output.
+
+  The line is not null-terminated.
+
+  @param[out] Line           Buffer of at least Indent + DUMP_HEX_LINE_CHARS
+                             characters to receive the line.
+  @param[in]  Indent         How many spaces to indent the output.
+  @param[in]  Offset         The offset to print at the start of the line.
+  @param[in]  Data           The data to print out.
+  @param[in]  Size           The number of bytes of Data to print, 1 to 16.
+  @param[in]  LastPrintable  The last character printed as is in the ASCII
+                             column; bytes above it are printed as '.'.
+
+  @return The number of characters written to Line.
+**/
+STATIC
+UINTN
+InternalDumpHexLine (
+  OUT CHAR16       *Line,
+  IN  UINTN        Indent,
+  IN  UINTN        Offset,
+  IN  CONST UINT8  *Data,
+  IN  UINTN        Size,
+  IN  UINT8        LastPrintable
+  )
+{
+  UINTN   Length;
+  UINTN   Index;
+  UINT8   TempByte;
+  UINT32  Offset32;
+
+  SetMem16 (Line, Indent * sizeof (CHAR16), L' ');
+  Length = Indent;
+
+  Offset32 = (UINT32)Offset;
+  for (Index = 0; Index < 8; Index++) {
+    Line[Length++] = (CHAR16)Hex[(Offset32 >> (28 - Index * 4)) & 0xF];
+  }
+
+  Line[Length++] = L':';
+  Line[Length++] = L' ';
+
+  for (Index = 0; Index < 16; Index++) {
+    if (Index < Size) {
+      TempByte       = Data[Index];
+      Line[Length++] = (CHAR16)Hex[TempByte >> 4];
+      Line[Length++] = (CHAR16)Hex[TempByte & 0xF];
+      Line[Length++] = (Index == 7) ? L'-' : L' ';
+    } else {
+      Line[Length++] = L' ';
+      Line[Length++] = L' ';
+      Line[Length++] = L' ';
+    }
+  }
+
+  Line[Length++] = L' ';
+  Line[Length++] = L'*';
+  for (Index = 0; Index < Size; Index++) {
+    TempByte       = Data[Index];
+    Line[Length++] = (CHAR16)((TempByte < ' ' || TempByte > LastPrintable) ? '.' : TempByte);
+  }
+
+  Line[Length++] = L'*';
+  Line[Length++] = L'\r';
+  Line[Length++] = L'\n';
+
+  return Length;
+}
+
 /**
   Dump some hexadecimal data to the screen.
 
@@ -1904,39 +1985,63 @@ DumpHex (
   IN VOID   *UserData
   )
 {
-  UINT8  *Data;
-
-  CHAR8  Val[50];
+  UINT8   *Data;
+  CHAR16  *Chunk;
+  CHAR16  Line[DUMP_HEX_LINE_CHARS + 1];
+  UINTN   ChunkLines;
+  UINTN   ChunkLength;
+  UINTN   LineCount;
+  UINTN   Size;
 
-  CHAR8  Str[20];
+  if (DataSize == 0) {
+    return;
+  }
 
-  UINT8  TempByte;
-  UINTN  Size;
-  UINTN  Index;
+  //
+  // Format as many lines as fit in one shell print buffer and print them
+  // together, so that the console is called once per chunk rather than
+  // once per line.
+  //
+  ChunkLines = (PcdGet16 (PcdShellPrintBufferSize) / sizeof (CHAR16) - 1) / (Indent + DUMP_HEX_LINE_CHARS);
+  ChunkLines = MIN (ChunkLines, DUMP_HEX_MAX_CHUNK_LINES);
+  ChunkLines = MIN (ChunkLines, (DataSize + 15) / 16);
+  Chunk      = NULL;
+  if (ChunkLines > 1) {
+    Chunk = AllocatePool ((ChunkLines * (Indent + DUMP_HEX_LINE_CHARS) + 1) * sizeof (CHAR16));
+  }
 
   Data = UserData;
-  while (DataSize != 0) {
-    Size = 16;
-    if (Size > DataSize) {
-      Size = DataSize;
+  if (Chunk == NULL) {
+    while (DataSize != 0) {
+      Size              = MIN (DataSize, 16);
+      ChunkLength       = InternalDumpHexLine (Line, 0, Offset, Data, Size, '~');
+      Line[ChunkLength] = CHAR_NULL;
+      ShellPrintEx (-1, -1, L"%*a%s", Indent, "", Line);
+
+      Data     += Size;
+      Offset   += Size;
+      DataSize -= Size;
     }
 
-    for (Index = 0; Index < Size; Index += 1) {
-      TempByte           = Data[Index];
-      Val[Index * 3 + 0] = Hex[TempByte >> 4];
-      Val[Index * 3 + 1] = Hex[TempByte & 0xF];
-      Val[Index * 3 + 2] = (CHAR8)((Index == 7) ? '-' : ' ');
-      Str[Index]         = (CHAR8)((TempByte < ' ' || TempByte > '~') ? '.' : TempByte);
-    }
+    return;
+  }
 
-    Val[Index * 3] = 0;
-    Str[Index]     = 0;
-    ShellPrintEx (-1, -1, L"%*a%08X: %-48a *%a*\r\n", Indent, "", Offset, Val, Str);
+  while (DataSize != 0) {
+    ChunkLength = 0;
+    for (LineCount = 0; LineCount < ChunkLines && DataSize != 0; LineCount++) {
+      Size         = MIN (DataSize, 16);
+      ChunkLength += InternalDumpHexLine (&Chunk[ChunkLength], Indent, Offset, Data, Size, '~');
+
+      Data     += Size;
+      Offset   += Size;
+      DataSize -= Size;
+    }
 
-    Data     += Size;
-    Offset   += Size;
-    DataSize -= Size;
+    Chunk[ChunkLength] = CHAR_NULL;
+    ShellPrintEx (-1, -1, L"%s", Chunk);
   }
+
+  FreePool (Chunk);
 }
 
 /**
@@ -1959,41 +2064,42 @@ CatSDumpHex (
   )
 {
   UINT8   *Data;
-  UINT8   TempByte;
   UINTN   Size;
-  UINTN   Index;
-  CHAR8   Val[50];
-  CHAR8   Str[20];
+  UINTN   Length;
+  UINTN   BufferLength;
   CHAR16  *RetVal;
-  CHAR16  *TempRetVal;
 
-  Data   = UserData;
-  RetVal = Buffer;
-  while (DataSize != 0) {
-    Size = 16;
-    if (Size > DataSize) {
-      Size = DataSize;
-    }
+  if (DataSize == 0) {
+    return Buffer;
+  }
 
-    for (Index = 0; Index < Size; Index += 1) {
-      TempByte           = Data[Index];
-      Val[Index * 3 + 0] = Hex[TempByte >> 4];
-      Val[Index * 3 + 1] = Hex[TempByte & 0xF];
-      Val[Index * 3 + 2] = (CHAR8)((Index == 7) ? '-' : ' ');
-      Str[Index]         = (CHAR8)((TempByte < ' ' || TempByte > 'z') ? '.' : TempByte);
-    }
+  //
+  // Size the result for all lines up front instead of growing it line by line.
+  //
+  BufferLength = (Buffer == NULL) ? 0 : StrLen (Buffer);
+  RetVal       = AllocatePool (
+                   (BufferLength + ((DataSize + 15) / 16) * (Indent + DUMP_HEX_LINE_CHARS) + 1) * sizeof (CHAR16)
+                   );
+  if (RetVal == NULL) {
+    SHELL_FREE_NON_NULL (Buffer);
+    return NULL;
+  }
 
-    Val[Index * 3] = 0;
-    Str[Index]     = 0;
-    TempRetVal     = CatSPrint (RetVal, L"%*a%08X: %-48a *%a*\r\n", Indent, "", Offset, Val, Str);
-    SHELL_FREE_NON_NULL (RetVal);
-    RetVal = TempRetVal;
+  CopyMem (RetVal, Buffer, BufferLength * sizeof (CHAR16));
+  SHELL_FREE_NON_NULL (Buffer);
+
+  Length = BufferLength;
+  Data   = UserData;
+  while (DataSize != 0) {
+    Size    = MIN (DataSize, 16);
+    Length += InternalDumpHexLine (&RetVal[Length], Indent, Offset, Data, Size, 'z');
 
     Data     += Size;
     Offset   += Size;
     DataSize -= Size;
   }
 
+  RetVal[Length] = CHAR_NULL;
   return RetVal;
 }
 
@@ -53,7 +53,9 @@ HEFI_EDITOR_BUFFER_IMAGE  HBufferImageConst = {
   FileTypeNone,
   NULL,
   NULL,
-  NULL
+  NULL,
+  0,
+  0
 };
 
 //
@@ -224,6 +226,7 @@ HBufferImageCleanup (
 
   HFileImageCleanup ();
   HDiskImageCleanup ();
+  HMemImageCleanup ();
 
   return Status;
 }
@@ -1084,9 +1087,10 @@ HBufferImageFree (
   )
 {
   //
-  // free all lines
+  // free all lines, and stop reading the rest of the old file
   //
   HBufferImageFreeLines ();
+  HFileImageCloseFile ();
 
   return EFI_SUCCESS;
 }
@@ -1428,6 +1432,18 @@ HBufferImageMovePosition (
   BOOLEAN  Under;
   UINTN    NewDisplayCol;
 
+  //
+  // read in the new row and a few screens after it, so that the line list
+  // only ends where the buffer itself ends
+  //
+  HBufferImageLoadTo (NewFilePosRow + 2 * (HMainEditor.ScreenSize.Row - 2));
+  if ((HBufferImage.PendingSize != 0) && (NewFilePosRow >= HBufferImage.NumLines)) {
+    //
+    // the rest could not be read, so stay within what has been read
+    //
+    return;
+  }
+
   //
   // CALCULATE gap between current file position and new file position
   //
@@ -1869,9 +1885,9 @@ HBufferImageGetTotalSize (
            EFI_EDITOR_LINE_LIST
            );
   //
-  // one line at most 0x10
+  // one line at most 0x10, plus what has not been read yet
   //
-  Size = 0x10 * (HBufferImage.NumLines - 1) + Line->Size;
+  Size = 0x10 * (HBufferImage.NumLines - 1) + Line->Size + HBufferImage.PendingSize;
 
   return Size;
 }
@@ -1909,6 +1925,14 @@ HBufferImageDeleteCharacterFromBuffer (
 
   EFI_STATUS  Status;
 
+  //
+  // everything after Pos moves, so the whole buffer has to be read in
+  //
+  Status = HBufferImageLoadAll ();
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   Size = HBufferImageGetTotalSize ();
 
   if (Size < Count) {
@@ -2037,6 +2061,16 @@ HBufferImageAddCharacterToBuffer (
 
   UINTN  NewPos;
 
+  EFI_STATUS  Status;
+
+  //
+  // everything after Pos moves, so the whole buffer has to be read in
+  //
+  Status = HBufferImageLoadAll ();
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   Size = HBufferImageGetTotalSize ();
 
   //
@@ -2281,6 +2315,144 @@ HBufferImageListToBuffer (
   return EFI_SUCCESS;
 }
 
+/**
+  Append bytes read from the file, disk or memory to the end of the line list.
+
+  A chunk need not end on a line boundary, so the last line is filled up
+  first. Once nothing is left to read, a full last line is followed by an
+  empty one, the same as HBufferImageBufferToList does.
+
+  @param[in] Buffer   The bytes read.
+  @param[in] Bytes    The size of Buffer in bytes.
+
+  @retval EFI_SUCCESS           The operation was successful.
+  @retval EFI_OUT_OF_RESOURCES  A memory allocation failed.
+**/
+EFI_STATUS
+HBufferImageAppendChunk (
+  IN VOID   *Buffer,
+  IN UINTN  Bytes
+  )
+{
+  HEFI_EDITOR_LINE  *Line;
+  UINT8             *BufferPtr;
+  UINTN             Left;
+
+  ASSERT (Bytes <= HBufferImage.PendingSize);
+
+  BufferPtr = (UINT8 *)Buffer;
+  Line      = NULL;
+  if (HBufferImage.Lines != NULL) {
+    Line = CR (HBufferImage.ListHead->BackLink, HEFI_EDITOR_LINE, Link, EFI_EDITOR_LINE_LIST);
+  }
+
+  while (Bytes > 0) {
+    if ((Line == NULL) || (Line->Size == 0x10)) {
+      Line = HBufferImageCreateLine ();
+      if (Line == NULL) {
+        return EFI_OUT_OF_RESOURCES;
+      }
+    }
+
+    Left = MIN (Bytes, 0x10 - Line->Size);
+    CopyMem (&Line->Buffer[Line->Size], BufferPtr, Left);
+
+    Line->Size               += Left;
+    BufferPtr                += Left;
+    Bytes                    -= Left;
+    HBufferImage.LoadedSize  += Left;
+    HBufferImage.PendingSize -= Left;
+  }
+
+  //
+  // last line is a full line, SO create a new line
+  //
+  if ((HBufferImage.PendingSize == 0) && (Line != NULL) && (Line->Size == 0x10)) {
+    Line = HBufferImageCreateLine ();
+    if (Line == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Read the next chunk of the file, disk or memory range into the line list.
+
+  @retval EFI_SUCCESS           The operation was successful.
+  @retval EFI_OUT_OF_RESOURCES  A memory allocation failed.
+  @retval EFI_LOAD_ERROR        A load error occurred.
+  @retval EFI_NOT_FOUND         No buffer is open.
+**/
+EFI_STATUS
+HBufferImageLoadChunk (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+
+  switch (HBufferImage.BufferType) {
+    case FileTypeFileBuffer:
+      Status = HFileImageLoadChunk ();
+      break;
+
+    case FileTypeDiskBuffer:
+      Status = HDiskImageLoadChunk ();
+      break;
+
+    case FileTypeMemBuffer:
+      Status = HMemImageLoadChunk ();
+      break;
+
+    default:
+      Status = EFI_NOT_FOUND;
+      break;
+  }
+
+  return Status;
+}
+
+/**
+  Read chunks into the line list until it holds the line after Row, or until
+  the whole file, disk or memory range has been read.
+
+  @param[in] Row    Row of file position ( start from 1 ).
+
+  @retval EFI_SUCCESS   The operation was successful.
+  @return               The error from reading the next chunk.
+**/
+EFI_STATUS
+HBufferImageLoadTo (
+  IN UINTN  Row
+  )
+{
+  EFI_STATUS  Status;
+
+  while ((HBufferImage.PendingSize != 0) && (HBufferImage.NumLines <= Row)) {
+    Status = HBufferImageLoadChunk ();
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Read whatever is left of the file, disk or memory range into the line list.
+
+  @retval EFI_SUCCESS   The operation was successful.
+  @return               The error from reading the next chunk.
+**/
+EFI_STATUS
+HBufferImageLoadAll (
+  VOID
+  )
+{
+  return HBufferImageLoadTo (MAX_UINTN);
+}
+
 /**
   Move the mouse in the image buffer.
 
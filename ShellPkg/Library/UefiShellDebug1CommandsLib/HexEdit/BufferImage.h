@@ -226,6 +226,50 @@ HBufferImageListToBuffer (
   IN UINTN  Bytes
   );
 
+/**
+  Append bytes read from the file, disk or memory to the end of the line list.
+
+  A chunk need not end on a line boundary, so the last line is filled up
+  first. Once nothing is left to read, a full last line is followed by an
+  empty one, the same as HBufferImageBufferToList does.
+
+  @param[in] Buffer   The bytes read.
+  @param[in] Bytes    The size of Buffer in bytes.
+
+  @retval EFI_SUCCESS           The operation was successful.
+  @retval EFI_OUT_OF_RESOURCES  A memory allocation failed.
+**/
+EFI_STATUS
+HBufferImageAppendChunk (
+  IN VOID   *Buffer,
+  IN UINTN  Bytes
+  );
+
+/**
+  Read chunks into the line list until it holds the line after Row, or until
+  the whole file, disk or memory range has been read.
+
+  @param[in] Row    Row of file position ( start from 1 ).
+
+  @retval EFI_SUCCESS   The operation was successful.
+  @return               The error from reading the next chunk.
+**/
+EFI_STATUS
+HBufferImageLoadTo (
+  IN UINTN  Row
+  );
+
+/**
+  Read whatever is left of the file, disk or memory range into the line list.
+
+  @retval EFI_SUCCESS   The operation was successful.
+  @return               The error from reading the next chunk.
+**/
+EFI_STATUS
+HBufferImageLoadAll (
+  VOID
+  );
+
 /**
   Move the mouse in the image buffer.
 
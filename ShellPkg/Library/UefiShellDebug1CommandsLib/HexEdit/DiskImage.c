@@ -28,7 +28,10 @@ HEFI_EDITOR_DISK_IMAGE  HDiskImageConst = {
   NULL,
   0,
   0,
-  0
+  0,
+  NULL,
+  0,
+  NULL
 };
 
 /**
@@ -93,10 +96,152 @@ HDiskImageCleanup (
 {
   SHELL_FREE_NON_NULL (HDiskImage.Name);
   SHELL_FREE_NON_NULL (HDiskImageBackupVar.Name);
+  SHELL_FREE_NON_NULL (HDiskImage.Original);
+  HDiskImage.Original     = NULL;
+  HDiskImage.OriginalSize = 0;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Replace the copy of the on-disk blocks that HDiskImageSave compares against.
+
+  Ownership of Buffer passes to HDiskImage. Buffer must be large enough for
+  the whole disk range, since blocks read later are appended to it.
+
+  @param[in] Buffer   The blocks now on disk, or NULL to drop the copy.
+  @param[in] Bytes    The number of bytes at the start of Buffer that are valid.
+**/
+VOID
+HDiskImageSetOriginal (
+  IN UINT8  *Buffer,
+  IN UINTN  Bytes
+  )
+{
+  SHELL_FREE_NON_NULL (HDiskImage.Original);
+  HDiskImage.Original     = Buffer;
+  HDiskImage.OriginalSize = (Buffer == NULL) ? 0 : Bytes;
+}
+
+/**
+  Write only the blocks of Buffer that differ from HDiskImage.Original.
+
+  Runs of adjacent changed blocks are written with a single WriteBlocks call.
+
+  @param[in] BlkIo    The block I/O protocol of the disk.
+  @param[in] Offset   The starting LBA of Buffer.
+  @param[in] Buffer   The new content of the blocks.
+  @param[in] Bytes    The number of bytes to compare; at most HDiskImage.OriginalSize.
+
+  @retval EFI_SUCCESS   All changed blocks were written.
+  @return               The error returned by WriteBlocks.
+**/
+EFI_STATUS
+HDiskImageWriteChangedBlocks (
+  IN EFI_BLOCK_IO_PROTOCOL  *BlkIo,
+  IN UINTN                  Offset,
+  IN UINT8                  *Buffer,
+  IN UINTN                  Bytes
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       BlockSize;
+  UINTN       Blocks;
+  UINTN       Index;
+  UINTN       Start;
+
+  BlockSize = BlkIo->Media->BlockSize;
+  Blocks    = Bytes / BlockSize;
+  Index     = 0;
+
+  while (Index < Blocks) {
+    if (CompareMem (Buffer + Index * BlockSize, HDiskImage.Original + Index * BlockSize, BlockSize) == 0) {
+      Index++;
+      continue;
+    }
+
+    Start = Index;
+    while (Index < Blocks &&
+           CompareMem (Buffer + Index * BlockSize, HDiskImage.Original + Index * BlockSize, BlockSize) != 0)
+    {
+      Index++;
+    }
+
+    Status = BlkIo->WriteBlocks (
+                      BlkIo,
+                      BlkIo->Media->MediaId,
+                      Offset + Start,
+                      (Index - Start) * BlockSize,
+                      Buffer + Start * BlockSize
+                      );
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
 
   return EFI_SUCCESS;
 }
 
+/**
+  Read the next chunk of blocks from the disk into HBufferImage.
+
+  @retval EFI_SUCCESS           The operation was successful.
+  @retval EFI_OUT_OF_RESOURCES  A memory allocation failed.
+  @retval EFI_LOAD_ERROR        A load error occurred.
+**/
+EFI_STATUS
+HDiskImageLoadChunk (
+  VOID
+  )
+{
+  EFI_BLOCK_IO_PROTOCOL  *BlkIo;
+  EFI_STATUS             Status;
+  UINT8                  *Buffer;
+  UINTN                  Bytes;
+
+  BlkIo = HDiskImage.BlkIo;
+  if (BlkIo == NULL) {
+    return EFI_LOAD_ERROR;
+  }
+
+  //
+  // always read whole blocks, so LoadedSize stays a multiple of the block size
+  //
+  Bytes  = MAX (HBUFFER_IMAGE_CHUNK_SIZE / HDiskImage.BlockSize, 1) * HDiskImage.BlockSize;
+  Bytes  = MIN (Bytes, HBufferImage.PendingSize);
+  Buffer = AllocatePool (Bytes);
+  if (Buffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = BlkIo->ReadBlocks (
+                    BlkIo,
+                    BlkIo->Media->MediaId,
+                    HDiskImage.Offset + HBufferImage.LoadedSize / HDiskImage.BlockSize,
+                    Bytes,
+                    Buffer
+                    );
+  if (EFI_ERROR (Status)) {
+    FreePool (Buffer);
+    StatusBarSetStatusString (L"Read Disk Failed");
+    return EFI_LOAD_ERROR;
+  }
+
+  //
+  // keep the blocks read so that saving only needs to write back
+  // the blocks that were changed
+  //
+  if ((HDiskImage.Original != NULL) && (HDiskImage.OriginalSize == HBufferImage.LoadedSize)) {
+    CopyMem (HDiskImage.Original + HDiskImage.OriginalSize, Buffer, Bytes);
+    HDiskImage.OriginalSize += Bytes;
+  }
+
+  Status = HBufferImageAppendChunk (Buffer, Bytes);
+  FreePool (Buffer);
+
+  return Status;
+}
+
 /**
   Set FileName field in HFileImage.
 
@@ -165,9 +310,11 @@ HDiskImageRead (
   EFI_BLOCK_IO_PROTOCOL           *BlkIo;
   EFI_STATUS                      Status;
 
-  VOID    *Buffer;
+  UINT8   *Buffer;
+  UINT8   *Original;
   CHAR16  *Str;
   UINTN   Bytes;
+  UINTN   ChunkBytes;
 
   HEFI_EDITOR_LINE  *Line;
 
@@ -206,10 +353,21 @@ HDiskImageRead (
     return EFI_LOAD_ERROR;
   }
 
-  Bytes  = BlkIo->Media->BlockSize * Size;
-  Buffer = AllocateZeroPool (Bytes);
-
-  if (Buffer == NULL) {
+  //
+  // only the first chunk of blocks is read here; the rest is read
+  // on demand as the cursor moves, so large ranges open quickly.
+  // Original gets room for the whole range, and is filled as blocks
+  // are read, so saving only needs to write back the changed blocks.
+  //
+  Bytes      = BlkIo->Media->BlockSize * Size;
+  ChunkBytes = MAX (HBUFFER_IMAGE_CHUNK_SIZE / BlkIo->Media->BlockSize, 1) * BlkIo->Media->BlockSize;
+  ChunkBytes = MIN (ChunkBytes, Bytes);
+  Original   = AllocatePool (Bytes);
+  Buffer     = AllocatePool (ChunkBytes);
+
+  if ((Original == NULL) || (Buffer == NULL)) {
+    SHELL_FREE_NON_NULL (Original);
+    SHELL_FREE_NON_NULL (Buffer);
     StatusBarSetStatusString (L"Read Disk Failed");
     return EFI_OUT_OF_RESOURCES;
   }
@@ -221,11 +379,12 @@ HDiskImageRead (
                     BlkIo,
                     BlkIo->Media->MediaId,
                     Offset,
-                    Bytes,
+                    ChunkBytes,
                     Buffer
                     );
 
   if (EFI_ERROR (Status)) {
+    FreePool (Original);
     FreePool (Buffer);
     StatusBarSetStatusString (L"Read Disk Failed");
     return EFI_LOAD_ERROR;
@@ -233,19 +392,10 @@ HDiskImageRead (
 
   HBufferImageFree ();
 
-  //
-  // convert buffer to line list
-  //
-  Status = HBufferImageBufferToList (Buffer, Bytes);
-  FreePool (Buffer);
-
-  if (EFI_ERROR (Status)) {
-    StatusBarSetStatusString (L"Read Disk Failed");
-    return Status;
-  }
-
   Status = HDiskImageSetDiskNameOffsetSize (DeviceName, Offset, Size);
   if (EFI_ERROR (Status)) {
+    FreePool (Original);
+    FreePool (Buffer);
     StatusBarSetStatusString (L"Read Disk Failed");
     return EFI_OUT_OF_RESOURCES;
   }
@@ -254,6 +404,24 @@ HDiskImageRead (
   // initialize some variables
   //
   HDiskImage.BlockSize = BlkIo->Media->BlockSize;
+  HDiskImage.BlkIo     = BlkIo;
+
+  CopyMem (Original, Buffer, ChunkBytes);
+  HDiskImageSetOriginal (Original, ChunkBytes);
+
+  //
+  // convert the first chunk to line list
+  //
+  HBufferImage.LoadedSize  = 0;
+  HBufferImage.PendingSize = Bytes;
+
+  Status = HBufferImageAppendChunk (Buffer, ChunkBytes);
+  FreePool (Buffer);
+  if (EFI_ERROR (Status)) {
+    HDiskImageSetOriginal (NULL, 0);
+    StatusBarSetStatusString (L"Read Disk Failed");
+    return Status;
+  }
 
   HBufferImage.DisplayPosition.Row    = 2;
   HBufferImage.DisplayPosition.Column = 10;
@@ -268,7 +436,7 @@ HDiskImageRead (
   HBufferImage.BufferPosition.Column = 1;
 
   if (!Recover) {
-    Str = CatSPrint (NULL, L"%d Lines Read", HBufferImage.NumLines);
+    Str = CatSPrint (NULL, L"%d Lines Read", HBufferImageGetTotalSize () / 0x10 + 1);
     if (Str == NULL) {
       StatusBarSetStatusString (L"Read Disk Failed");
       return EFI_OUT_OF_RESOURCES;
@@ -340,6 +508,8 @@ HDiskImageSave (
   EFI_HANDLE                      Handle;
   VOID                            *Buffer;
   UINTN                           Bytes;
+  UINTN                           ValidBytes;
+  BOOLEAN                         SameRange;
 
   //
   // if not modified, directly return
@@ -375,6 +545,23 @@ HDiskImageSave (
     return Status;
   }
 
+  SameRange = (BOOLEAN)((HDiskImage.Name != NULL) &&
+                        (HDiskImage.Offset == Offset) &&
+                        (HDiskImage.Size == Size) &&
+                        (HDiskImage.BlockSize == BlkIo->Media->BlockSize) &&
+                        (StrCmp (HDiskImage.Name, DeviceName) == 0));
+
+  //
+  // blocks not read yet are unchanged on the disk they were opened from;
+  // anywhere else they have to be written too, so read them in first
+  //
+  if (!SameRange || (HDiskImage.Original == NULL)) {
+    Status = HBufferImageLoadAll ();
+    if (EFI_ERROR (Status)) {
+      return EFI_LOAD_ERROR;
+    }
+  }
+
   Bytes  = BlkIo->Media->BlockSize * Size;
   Buffer = AllocateZeroPool (Bytes);
 
@@ -392,22 +579,38 @@ HDiskImageSave (
   }
 
   //
-  // write the buffer to disk
+  // write the buffer to disk; if the same blocks were read before,
+  // only the blocks that changed need to be written
   //
-  Status = BlkIo->WriteBlocks (
-                    BlkIo,
-                    BlkIo->Media->MediaId,
-                    Offset,
-                    Bytes,
-                    Buffer
-                    );
-
-  FreePool (Buffer);
+  if (SameRange && (HDiskImage.Original != NULL)) {
+    ValidBytes = MIN (HDiskImage.OriginalSize, Bytes);
+    Status     = HDiskImageWriteChangedBlocks (BlkIo, Offset, Buffer, ValidBytes);
+  } else {
+    ValidBytes = Bytes;
+    Status     = BlkIo->WriteBlocks (
+                          BlkIo,
+                          BlkIo->Media->MediaId,
+                          Offset,
+                          Bytes,
+                          Buffer
+                          );
+  }
 
   if (EFI_ERROR (Status)) {
+    //
+    // part of the blocks may have been written, so the copy is stale
+    //
+    FreePool (Buffer);
+    HDiskImageSetOriginal (NULL, 0);
     return EFI_LOAD_ERROR;
   }
 
+  if (SameRange) {
+    HDiskImageSetOriginal (Buffer, ValidBytes);
+  } else {
+    FreePool (Buffer);
+  }
+
   //
   // now not modified
   //
@@ -86,4 +86,16 @@ HDiskImageSave (
   IN UINTN   Size
   );
 
+/**
+  Read the next chunk of blocks from the disk into HBufferImage.
+
+  @retval EFI_SUCCESS           The operation was successful.
+  @retval EFI_OUT_OF_RESOURCES  A memory allocation failed.
+  @retval EFI_LOAD_ERROR        A load error occurred.
+**/
+EFI_STATUS
+HDiskImageLoadChunk (
+  VOID
+  );
+
 #endif
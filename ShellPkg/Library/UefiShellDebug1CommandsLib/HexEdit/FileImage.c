@@ -26,7 +26,8 @@ HEFI_EDITOR_FILE_IMAGE  HFileImageBackupVar;
 HEFI_EDITOR_BUFFER_IMAGE  HFileImageConst = {
   NULL,
   0,
-  FALSE
+  FALSE,
+  NULL
 };
 
 /**
@@ -86,10 +87,75 @@ HFileImageCleanup (
 {
   SHELL_FREE_NON_NULL (HFileImage.FileName);
   SHELL_FREE_NON_NULL (HFileImageBackupVar.FileName);
+  HFileImageCloseFile ();
 
   return EFI_SUCCESS;
 }
 
+/**
+  Close the file that the rest of HBufferImage would be read from.
+**/
+VOID
+HFileImageCloseFile (
+  VOID
+  )
+{
+  if (HFileImage.FileHandle != NULL) {
+    ShellCloseFile (&HFileImage.FileHandle);
+    HFileImage.FileHandle = NULL;
+  }
+}
+
+/**
+  Read the next chunk of the file into HBufferImage.
+
+  @retval EFI_SUCCESS           The operation was successful.
+  @retval EFI_OUT_OF_RESOURCES  A memory allocation failed.
+  @retval EFI_LOAD_ERROR        A load error occurred.
+**/
+EFI_STATUS
+HFileImageLoadChunk (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+  UINT8       *Buffer;
+  UINTN       Bytes;
+
+  if (HFileImage.FileHandle == NULL) {
+    return EFI_LOAD_ERROR;
+  }
+
+  Bytes  = MIN (HBufferImage.PendingSize, HBUFFER_IMAGE_CHUNK_SIZE);
+  Buffer = AllocatePool (Bytes);
+  if (Buffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = ShellSetFilePosition (HFileImage.FileHandle, HBufferImage.LoadedSize);
+  if (!EFI_ERROR (Status)) {
+    Status = ShellReadFile (HFileImage.FileHandle, &Bytes, Buffer);
+  }
+
+  //
+  // a file that got shorter since it was opened cannot be read to the end
+  //
+  if (EFI_ERROR (Status) || (Bytes == 0)) {
+    FreePool (Buffer);
+    StatusBarSetStatusString (L"Read File Failed");
+    return EFI_LOAD_ERROR;
+  }
+
+  Status = HBufferImageAppendChunk (Buffer, Bytes);
+  FreePool (Buffer);
+
+  if (HBufferImage.PendingSize == 0) {
+    HFileImageCloseFile ();
+  }
+
+  return Status;
+}
+
 /**
   Set FileName field in HFileImage
 
@@ -139,15 +205,21 @@ HFileImageRead (
   IN BOOLEAN       Recover
   )
 {
-  HEFI_EDITOR_LINE  *Line;
-  UINT8             *Buffer;
-  CHAR16            *UnicodeBuffer;
-  EFI_STATUS        Status;
+  HEFI_EDITOR_LINE   *Line;
+  UINT8              *Buffer;
+  CHAR16             *UnicodeBuffer;
+  EFI_STATUS         Status;
+  SHELL_FILE_HANDLE  FileHandle;
+  EFI_FILE_INFO      *Info;
+  UINTN              Bytes;
 
   //
   // variable initialization
   //
-  Line = NULL;
+  Line       = NULL;
+  Buffer     = NULL;
+  FileHandle = NULL;
+  Bytes      = 0;
 
   //
   // in this function, when you return error ( except EFI_OUT_OF_RESOURCES )
@@ -157,17 +229,52 @@ HFileImageRead (
   // so if you want to print the error status
   // you should set the status string
   //
-  Status = ReadFileIntoBuffer (FileName, (VOID **)&Buffer, &HFileImage.Size, &HFileImage.ReadOnly);
+  // an existing file is only read up to the first chunk here; the rest is
+  // read on demand as the cursor moves, so large files open quickly.
+  // New files and directories go through ReadFileIntoBuffer as before.
+  //
+  Status = ShellOpenFileByName (FileName, &FileHandle, EFI_FILE_MODE_READ, 0);
+  if (!EFI_ERROR (Status)) {
+    Info = ShellGetFileInfo (FileHandle);
+    if ((Info != NULL) && ((Info->Attribute & EFI_FILE_DIRECTORY) == 0)) {
+      HFileImage.Size     = (UINTN)Info->FileSize;
+      HFileImage.ReadOnly = (BOOLEAN)((Info->Attribute & EFI_FILE_READ_ONLY) != 0);
+
+      Bytes  = MIN (HFileImage.Size, HBUFFER_IMAGE_CHUNK_SIZE);
+      Buffer = AllocatePool (Bytes);
+      if (Buffer == NULL) {
+        Status = EFI_OUT_OF_RESOURCES;
+      } else {
+        Status = ShellReadFile (FileHandle, &Bytes, Buffer);
+      }
+    } else {
+      ShellCloseFile (&FileHandle);
+      FileHandle = NULL;
+    }
+
+    SHELL_FREE_NON_NULL (Info);
+  }
+
+  if (FileHandle == NULL) {
+    Status = ReadFileIntoBuffer (FileName, (VOID **)&Buffer, &HFileImage.Size, &HFileImage.ReadOnly);
+    Bytes  = HFileImage.Size;
+  }
+
   //
   // NULL pointer is only also a failure for a non-zero file size.
   //
   if ((EFI_ERROR (Status)) || ((Buffer == NULL) && (HFileImage.Size != 0))) {
+    if (FileHandle != NULL) {
+      ShellCloseFile (&FileHandle);
+    }
+
     UnicodeBuffer = CatSPrint (NULL, L"Read error on file %s: %r", FileName, Status);
     if (UnicodeBuffer == NULL) {
       SHELL_FREE_NON_NULL (Buffer);
       return EFI_OUT_OF_RESOURCES;
     }
 
+    SHELL_FREE_NON_NULL (Buffer);
     StatusBarSetStatusString (UnicodeBuffer);
     FreePool (UnicodeBuffer);
     return EFI_OUT_OF_RESOURCES;
@@ -180,8 +287,16 @@ HFileImageRead (
   //
   HBufferImageFree ();
 
-  Status = HBufferImageBufferToList (Buffer, HFileImage.Size);
+  HFileImage.FileHandle    = FileHandle;
+  HBufferImage.LoadedSize  = 0;
+  HBufferImage.PendingSize = HFileImage.Size;
+
+  Status = HBufferImageAppendChunk (Buffer, MIN (Bytes, HFileImage.Size));
   SHELL_FREE_NON_NULL (Buffer);
+  if (HBufferImage.PendingSize == 0) {
+    HFileImageCloseFile ();
+  }
+
   if (EFI_ERROR (Status)) {
     StatusBarSetStatusString (L"Error parsing file.");
     return Status;
@@ -198,9 +313,8 @@ HFileImageRead (
   HBufferImage.BufferType             = FileTypeFileBuffer;
 
   if (!Recover) {
-    UnicodeBuffer = CatSPrint (NULL, L"%d Lines Read", HBufferImage.NumLines);
+    UnicodeBuffer = CatSPrint (NULL, L"%d Lines Read", HBufferImageGetTotalSize () / 0x10 + 1);
     if (UnicodeBuffer == NULL) {
-      SHELL_FREE_NON_NULL (Buffer);
       return EFI_OUT_OF_RESOURCES;
     }
 
@@ -222,7 +336,6 @@ HFileImageRead (
     //
     Line = HBufferImageCreateLine ();
     if (Line == NULL) {
-      SHELL_FREE_NON_NULL (Buffer);
       return EFI_OUT_OF_RESOURCES;
     }
 
@@ -296,6 +409,15 @@ HFileImageSave (
     return EFI_LOAD_ERROR;
   }
 
+  //
+  // the file is written again from the line list,
+  // so the part not read yet has to be read in first
+  //
+  Status = HBufferImageLoadAll ();
+  if (EFI_ERROR (Status)) {
+    return EFI_LOAD_ERROR;
+  }
+
   Status = ShellOpenFileByName (FileName, &FileHandle, EFI_FILE_MODE_READ|EFI_FILE_MODE_WRITE, 0);
 
   if (!EFI_ERROR (Status)) {
@@ -74,4 +74,24 @@ HFileImageSave (
   IN CHAR16  *FileName
   );
 
+/**
+  Read the next chunk of the file into HBufferImage.
+
+  @retval EFI_SUCCESS           The operation was successful.
+  @retval EFI_OUT_OF_RESOURCES  A memory allocation failed.
+  @retval EFI_LOAD_ERROR        A load error occurred.
+**/
+EFI_STATUS
+HFileImageLoadChunk (
+  VOID
+  );
+
+/**
+  Close the file that the rest of HBufferImage would be read from.
+**/
+VOID
+HFileImageCloseFile (
+  VOID
+  );
+
 #endif
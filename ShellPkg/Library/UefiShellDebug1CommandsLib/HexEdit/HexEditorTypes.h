@@ -12,10 +12,18 @@
 #include "UefiShellDebug1CommandsLib.h"
 #include "EditTitleBar.h"
 
+#include <Protocol/BlockIo.h>
+
 #define EFI_EDITOR_LINE_LIST  SIGNATURE_32 ('e', 'e', 'l', 'l')
 
 #define ASCII_POSITION  ((0x10 * 3) + 12)
 
+//
+// files, disk ranges and memory ranges are read into the line list in chunks
+// of about this size, as the cursor gets near the end of what has been read
+//
+#define HBUFFER_IMAGE_CHUNK_SIZE  SIZE_64KB
+
 typedef struct {
   UINTN    Row;
   UINTN    Column;
@@ -64,21 +72,30 @@ typedef struct {
 typedef struct {
   CHAR16    *Name;
 
-  UINTN     BlockSize;
-  UINTN     Size;
-  UINTN     Offset;
+  UINTN                    BlockSize;
+  UINTN                    Size;
+  UINTN                    Offset;
+
+  UINT8                    *Original;               // blocks as last read from / written to disk
+  UINTN                    OriginalSize;            // bytes of Original that are valid so far
+
+  EFI_BLOCK_IO_PROTOCOL    *BlkIo;                  // disk the remaining blocks are read from
 } HEFI_EDITOR_DISK_IMAGE;
 
 typedef struct {
   EFI_CPU_IO2_PROTOCOL    *IoFncs;
   UINTN                   Offset;
   UINTN                   Size;
+
+  UINT8                   *Original;                // bytes as last read from / written to memory
+  UINTN                   OriginalSize;             // bytes of Original that are valid so far
 } HEFI_EDITOR_MEM_IMAGE;
 
 typedef struct {
-  CHAR16     *FileName;
-  UINTN      Size;                                  // file size
-  BOOLEAN    ReadOnly;                              // file is read-only or not
+  CHAR16               *FileName;
+  UINTN                Size;                        // file size
+  BOOLEAN              ReadOnly;                    // file is read-only or not
+  SHELL_FILE_HANDLE    FileHandle;                  // open while part of the file is not read yet
 } HEFI_EDITOR_FILE_IMAGE;
 
 typedef struct {
@@ -97,6 +114,9 @@ typedef struct {
   HEFI_EDITOR_FILE_IMAGE    *FileImage;
   HEFI_EDITOR_DISK_IMAGE    *DiskImage;
   HEFI_EDITOR_MEM_IMAGE     *MemImage;
+
+  UINTN                     LoadedSize;             // bytes read from the file/disk/memory so far
+  UINTN                     PendingSize;            // bytes still to be read on demand
 } HEFI_EDITOR_BUFFER_IMAGE;
 
 typedef struct {
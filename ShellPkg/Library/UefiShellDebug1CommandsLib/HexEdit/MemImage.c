@@ -27,6 +27,8 @@ HEFI_EDITOR_MEM_IMAGE  HMemImageBackupVar;
 HEFI_EDITOR_MEM_IMAGE  HMemImageConst = {
   NULL,
   0,
+  0,
+  NULL,
   0
 };
 
@@ -60,6 +62,140 @@ HMemImageInit (
   }
 }
 
+/**
+  Cleanup function for HMemImage.
+
+  @retval EFI_SUCCESS       The operation was successful.
+**/
+EFI_STATUS
+HMemImageCleanup (
+  VOID
+  )
+{
+  SHELL_FREE_NON_NULL (HMemImage.Original);
+  HMemImage.Original     = NULL;
+  HMemImage.OriginalSize = 0;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Replace the copy of the memory contents that HMemImageSave compares against.
+
+  Ownership of Buffer passes to HMemImage. Buffer must be large enough for
+  the whole memory range, since bytes read later are appended to it.
+
+  @param[in] Buffer   The bytes now in memory, or NULL to drop the copy.
+  @param[in] Size     The number of bytes at the start of Buffer that are valid.
+**/
+VOID
+HMemImageSetOriginal (
+  IN UINT8  *Buffer,
+  IN UINTN  Size
+  )
+{
+  SHELL_FREE_NON_NULL (HMemImage.Original);
+  HMemImage.Original     = Buffer;
+  HMemImage.OriginalSize = (Buffer == NULL) ? 0 : Size;
+}
+
+/**
+  Write only the byte ranges of Buffer that differ from HMemImage.Original.
+
+  @param[in] Offset   The memory address of Buffer.
+  @param[in] Buffer   The new content of the memory range.
+  @param[in] Size     The number of bytes to compare; at most HMemImage.OriginalSize.
+
+  @retval EFI_SUCCESS   All changed bytes were written.
+  @return               The error returned by the CPU I/O protocol.
+**/
+EFI_STATUS
+HMemImageWriteChangedRanges (
+  IN UINTN  Offset,
+  IN UINT8  *Buffer,
+  IN UINTN  Size
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       Index;
+  UINTN       Start;
+
+  Index = 0;
+  while (Index < Size) {
+    if (Buffer[Index] == HMemImage.Original[Index]) {
+      Index++;
+      continue;
+    }
+
+    Start = Index;
+    while (Index < Size && Buffer[Index] != HMemImage.Original[Index]) {
+      Index++;
+    }
+
+    Status = HMemImage.IoFncs->Mem.Write (
+                                     HMemImage.IoFncs,
+                                     EfiCpuIoWidthUint8,
+                                     Offset + Start,
+                                     Index - Start,
+                                     Buffer + Start
+                                     );
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Read the next chunk of the memory range into HBufferImage.
+
+  @retval EFI_SUCCESS           The operation was successful.
+  @retval EFI_OUT_OF_RESOURCES  A memory allocation failed.
+  @retval EFI_LOAD_ERROR        A load error occurred.
+**/
+EFI_STATUS
+HMemImageLoadChunk (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+  UINT8       *Buffer;
+  UINTN       Bytes;
+
+  Bytes  = MIN (HBufferImage.PendingSize, HBUFFER_IMAGE_CHUNK_SIZE);
+  Buffer = AllocatePool (Bytes);
+  if (Buffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = HMemImage.IoFncs->Mem.Read (
+                                   HMemImage.IoFncs,
+                                   EfiCpuIoWidthUint8,
+                                   HMemImage.Offset + HBufferImage.LoadedSize,
+                                   Bytes,
+                                   Buffer
+                                   );
+  if (EFI_ERROR (Status)) {
+    FreePool (Buffer);
+    StatusBarSetStatusString (L"Memory Specified Not Accessible");
+    return EFI_LOAD_ERROR;
+  }
+
+  //
+  // keep the bytes read so that saving only writes back what changed
+  //
+  if ((HMemImage.Original != NULL) && (HMemImage.OriginalSize == HBufferImage.LoadedSize)) {
+    CopyMem (HMemImage.Original + HMemImage.OriginalSize, Buffer, Bytes);
+    HMemImage.OriginalSize += Bytes;
+  }
+
+  Status = HBufferImageAppendChunk (Buffer, Bytes);
+  FreePool (Buffer);
+
+  return Status;
+}
+
 /**
   Backup function for HDiskImage. Only a few fields need to be backup.
   This is for making the Disk buffer refresh as few as possible.
@@ -117,14 +253,24 @@ HMemImageRead (
   )
 {
   EFI_STATUS        Status;
-  void              *Buffer;
+  UINT8             *Buffer;
+  UINT8             *Original;
+  UINTN             ChunkSize;
   CHAR16            *Str;
   HEFI_EDITOR_LINE  *Line;
 
   HBufferImage.BufferType = FileTypeMemBuffer;
 
-  Buffer = AllocateZeroPool (Size);
-  if (Buffer == NULL) {
+  //
+  // only the first chunk is read here; the rest is read on demand
+  // as the cursor moves, so large ranges open quickly
+  //
+  ChunkSize = MIN (Size, HBUFFER_IMAGE_CHUNK_SIZE);
+  Original  = AllocatePool (Size);
+  Buffer    = AllocatePool (ChunkSize);
+  if ((Original == NULL) || (Buffer == NULL)) {
+    SHELL_FREE_NON_NULL (Original);
+    SHELL_FREE_NON_NULL (Buffer);
     StatusBarSetStatusString (L"Read Memory Failed");
     return EFI_OUT_OF_RESOURCES;
   }
@@ -133,11 +279,12 @@ HMemImageRead (
                                    HMemImage.IoFncs,
                                    EfiCpuIoWidthUint8,
                                    Offset,
-                                   Size,
+                                   ChunkSize,
                                    Buffer
                                    );
 
   if (EFI_ERROR (Status)) {
+    FreePool (Original);
     FreePool (Buffer);
     StatusBarSetStatusString (L"Memory Specified Not Accessible");
     return EFI_LOAD_ERROR;
@@ -145,16 +292,25 @@ HMemImageRead (
 
   HBufferImageFree ();
 
-  Status = HBufferImageBufferToList (Buffer, Size);
-  FreePool (Buffer);
+  Status = HMemImageSetMemOffsetSize (Offset, Size);
 
+  //
+  // keep the bytes read so that saving only writes back what changed
+  //
+  CopyMem (Original, Buffer, ChunkSize);
+  HMemImageSetOriginal (Original, ChunkSize);
+
+  HBufferImage.LoadedSize  = 0;
+  HBufferImage.PendingSize = Size;
+
+  Status = HBufferImageAppendChunk (Buffer, ChunkSize);
+  FreePool (Buffer);
   if (EFI_ERROR (Status)) {
+    HMemImageSetOriginal (NULL, 0);
     StatusBarSetStatusString (L"Read Memory Failed");
     return Status;
   }
 
-  Status = HMemImageSetMemOffsetSize (Offset, Size);
-
   HBufferImage.DisplayPosition.Row    = 2;
   HBufferImage.DisplayPosition.Column = 10;
 
@@ -168,7 +324,7 @@ HMemImageRead (
   HBufferImage.BufferPosition.Column = 1;
 
   if (!Recover) {
-    Str = CatSPrint (NULL, L"%d Lines Read", HBufferImage.NumLines);
+    Str = CatSPrint (NULL, L"%d Lines Read", HBufferImageGetTotalSize () / 0x10 + 1);
     if (Str == NULL) {
       StatusBarSetStatusString (L"Read Memory Failed");
       return EFI_OUT_OF_RESOURCES;
@@ -225,6 +381,8 @@ HMemImageSave (
 {
   EFI_STATUS  Status;
   VOID        *Buffer;
+  UINTN       ValidSize;
+  BOOLEAN     SameRange;
 
   //
   // not modified, so directly return
@@ -235,6 +393,19 @@ HMemImageSave (
 
   HBufferImage.BufferType = FileTypeMemBuffer;
 
+  SameRange = (BOOLEAN)((HMemImage.Offset == Offset) && (HMemImage.Size == Size));
+
+  //
+  // bytes not read yet are unchanged in the range they were opened from;
+  // anywhere else they have to be written too, so read them in first
+  //
+  if (!SameRange || (HMemImage.Original == NULL)) {
+    Status = HBufferImageLoadAll ();
+    if (EFI_ERROR (Status)) {
+      return EFI_LOAD_ERROR;
+    }
+  }
+
   Buffer = AllocateZeroPool (Size);
 
   if (Buffer == NULL) {
@@ -248,22 +419,35 @@ HMemImageSave (
   }
 
   //
-  // write back to memory
+  // write back to memory; if the same range was read before,
+  // only the bytes that changed need to be written
   //
-  Status = HMemImage.IoFncs->Mem.Write (
-                                   HMemImage.IoFncs,
-                                   EfiCpuIoWidthUint8,
-                                   Offset,
-                                   Size,
-                                   Buffer
-                                   );
-
-  FreePool (Buffer);
+  if (SameRange && (HMemImage.Original != NULL)) {
+    ValidSize = MIN (HMemImage.OriginalSize, Size);
+    Status    = HMemImageWriteChangedRanges (Offset, Buffer, ValidSize);
+  } else {
+    ValidSize = Size;
+    Status    = HMemImage.IoFncs->Mem.Write (
+                                        HMemImage.IoFncs,
+                                        EfiCpuIoWidthUint8,
+                                        Offset,
+                                        Size,
+                                        Buffer
+                                        );
+  }
 
   if (EFI_ERROR (Status)) {
+    FreePool (Buffer);
+    HMemImageSetOriginal (NULL, 0);
     return EFI_LOAD_ERROR;
   }
 
+  if (SameRange) {
+    HMemImageSetOriginal (Buffer, ValidSize);
+  } else {
+    FreePool (Buffer);
+  }
+
   //
   // now not modified
   //
@@ -23,6 +23,16 @@ HMemImageInit (
   VOID
   );
 
+/**
+  Cleanup function for HMemImage.
+
+  @retval EFI_SUCCESS       The operation was successful.
+**/
+EFI_STATUS
+HMemImageCleanup (
+  VOID
+  );
+
 /**
   Backup function for HDiskImage. Only a few fields need to be backup.
   This is for making the Disk buffer refresh as few as possible.
@@ -83,4 +93,16 @@ HMemImageSave (
   IN UINTN  Size
   );
 
+/**
+  Read the next chunk of the memory range into HBufferImage.
+
+  @retval EFI_SUCCESS           The operation was successful.
+  @retval EFI_OUT_OF_RESOURCES  A memory allocation failed.
+  @retval EFI_LOAD_ERROR        A load error occurred.
+**/
+EFI_STATUS
+HMemImageLoadChunk (
+  VOID
+  );
+
 #endif
@@ -159,6 +159,7 @@ ShellCommandRunDevTree (
   UINT64        Intermediate;
   UINTN         ParentControllerHandleCount;
   EFI_HANDLE    *ParentControllerHandleBuffer;
+  EFI_STATUS    SnapshotStatus;
 
   ShellStatus = SHELL_SUCCESS;
   Status      = EFI_SUCCESS;
@@ -212,6 +213,11 @@ ShellCommandRunDevTree (
     Lang      = ShellCommandLineGetRawValue (Package, 1);
     HiiString = HiiGetString (gShellDriver1HiiHandle, STRING_TOKEN (STR_DEV_TREE_OUTPUT), Language);
 
+    //
+    // Answer the handle database queries below from one snapshot.
+    //
+    SnapshotStatus = ParseHandleDatabaseSnapshotCreate ();
+
     if (Lang == NULL) {
       for (LoopVar = 1; ; LoopVar++) {
         TheHandle = ConvertHandleIndexToHandle (LoopVar);
@@ -263,6 +269,10 @@ ShellCommandRunDevTree (
       }
     }
 
+    if (!EFI_ERROR (SnapshotStatus)) {
+      ParseHandleDatabaseSnapshotFree ();
+    }
+
     if (HiiString != NULL) {
       FreePool (HiiString);
     }
@@ -147,6 +147,7 @@ ShellCommandRunDevices (
   CHAR16        *Name;
   CONST CHAR16  *Lang;
   BOOLEAN       SfoFlag;
+  EFI_STATUS    SnapshotStatus;
 
   ShellStatus = SHELL_SUCCESS;
   Language    = NULL;
@@ -213,6 +214,11 @@ ShellCommandRunDevices (
         ShellPrintHiiEx (-1, -1, Language, STRING_TOKEN (STR_DEVICES_HEADER_LINES), gShellDriver1HiiHandle);
       }
 
+      //
+      // Answer the handle database queries below from one snapshot.
+      //
+      SnapshotStatus = ParseHandleDatabaseSnapshotCreate ();
+
       //
       // loop through each handle
       //
@@ -259,6 +265,10 @@ ShellCommandRunDevices (
       if (HandleList != NULL) {
         FreePool (HandleList);
       }
+
+      if (!EFI_ERROR (SnapshotStatus)) {
+        ParseHandleDatabaseSnapshotFree ();
+      }
     }
 
     SHELL_FREE_NON_NULL (Language);
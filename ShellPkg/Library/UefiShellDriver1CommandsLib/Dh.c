@@ -1105,6 +1105,7 @@ ShellCommandRunDh (
   BOOLEAN       VerboseFlag;
   UINT64        Intermediate;
   EFI_HANDLE    Handle;
+  EFI_STATUS    SnapshotStatus;
 
   ShellStatus = SHELL_SUCCESS;
   Status      = EFI_SUCCESS;
@@ -1160,6 +1161,11 @@ ShellCommandRunDh (
     RawValue    = ShellCommandLineGetRawValue (Package, 1);
     ProtocolVal = ShellCommandLineGetValue (Package, L"-p");
 
+    //
+    // Answer the handle database queries below from one snapshot.
+    //
+    SnapshotStatus = ParseHandleDatabaseSnapshotCreate ();
+
     if (RawValue == NULL) {
       if (ShellCommandLineGetFlag (Package, L"-p") && (ProtocolVal == NULL)) {
         ShellPrintHiiEx (-1, -1, NULL, STRING_TOKEN (STR_GEN_NO_VALUE), gShellDriver1HiiHandle, L"dh", L"-p");
@@ -1206,6 +1212,10 @@ ShellCommandRunDh (
       }
     }
 
+    if (!EFI_ERROR (SnapshotStatus)) {
+      ParseHandleDatabaseSnapshotFree ();
+    }
+
     ShellCommandLineFreeVarList (Package);
     SHELL_FREE_NON_NULL (Language);
   }
@@ -290,6 +290,7 @@ ShellCommandRunDrivers (
   BOOLEAN       DriverConfig;
   BOOLEAN       DriverDiag;
   BOOLEAN       SfoFlag;
+  EFI_STATUS    SnapshotStatus;
 
   ShellStatus  = SHELL_SUCCESS;
   Status       = EFI_SUCCESS;
@@ -364,7 +365,11 @@ ShellCommandRunDrivers (
           );
       }
 
-      HandleList = GetHandleListByProtocol (&gEfiDriverBindingProtocolGuid);
+      //
+      // Answer the handle database queries below from one snapshot.
+      //
+      SnapshotStatus = ParseHandleDatabaseSnapshotCreate ();
+      HandleList     = GetHandleListByProtocol (&gEfiDriverBindingProtocolGuid);
       for (HandleWalker = HandleList; HandleWalker != NULL && *HandleWalker != NULL; HandleWalker++) {
         ChildCount     = 0;
         DeviceCount    = 0;
@@ -434,6 +439,10 @@ ShellCommandRunDrivers (
           break;
         }
       }
+
+      if (!EFI_ERROR (SnapshotStatus)) {
+        ParseHandleDatabaseSnapshotFree ();
+      }
     }
 
     SHELL_FREE_NON_NULL (Language);
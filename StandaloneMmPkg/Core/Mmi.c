@@ -19,13 +19,16 @@
 
 #define MMI_ENTRY_SIGNATURE  SIGNATURE_32('m','m','i','e')
 
-typedef struct {
+typedef struct _MMI_ENTRY MMI_ENTRY;
+
+struct _MMI_ENTRY {
   UINTN         Signature;
   LIST_ENTRY    AllEntries; // All entries
 
   EFI_GUID      HandlerType; // Type of interrupt
   LIST_ENTRY    MmiHandlers; // All handlers
-} MMI_ENTRY;
+  MMI_ENTRY     *HashNext;   // Next entry in the same bucket of mMmiEntryHash
+};
 
 #define MMI_HANDLER_SIGNATURE  SIGNATURE_32('m','m','i','h')
 
@@ -39,6 +42,32 @@ typedef struct {
 LIST_ENTRY  mRootMmiHandlerList = INITIALIZE_LIST_HEAD_VARIABLE (mRootMmiHandlerList);
 LIST_ENTRY  mMmiEntryList       = INITIALIZE_LIST_HEAD_VARIABLE (mMmiEntryList);
 
+//
+// The entries of mMmiEntryList hashed by handler type, so that the MMI entry
+// of a GUID is found without walking all the registered handler types.
+//
+#define MMI_ENTRY_HASH_BUCKETS  64
+
+MMI_ENTRY  *mMmiEntryHash[MMI_ENTRY_HASH_BUCKETS];
+
+/**
+  Returns the bucket of mMmiEntryHash for a handler type.
+
+  @param  HandlerType            The type of the interrupt
+
+  @return Index in mMmiEntryHash
+
+**/
+STATIC
+UINTN
+MmiEntryHash (
+  IN CONST EFI_GUID  *HandlerType
+  )
+{
+  return (ReadUnaligned32 ((CONST UINT32 *)HandlerType) ^
+          ReadUnaligned32 ((CONST UINT32 *)HandlerType + 3)) & (MMI_ENTRY_HASH_BUCKETS - 1);
+}
+
 /**
   Finds the MMI entry for the requested handler type.
 
@@ -55,19 +84,17 @@ MmCoreFindMmiEntry (
   IN BOOLEAN   Create
   )
 {
-  LIST_ENTRY  *Link;
-  MMI_ENTRY   *Item;
-  MMI_ENTRY   *MmiEntry;
+  UINTN      Bucket;
+  MMI_ENTRY  *Item;
+  MMI_ENTRY  *MmiEntry;
 
   //
-  // Search the MMI entry list for the matching GUID
+  // Search the bucket of the GUID for the matching MMI entry
   //
   MmiEntry = NULL;
-  for (Link = mMmiEntryList.ForwardLink;
-       Link != &mMmiEntryList;
-       Link = Link->ForwardLink)
-  {
-    Item = CR (Link, MMI_ENTRY, AllEntries, MMI_ENTRY_SIGNATURE);
+  Bucket   = MmiEntryHash (HandlerType);
+  for (Item = mMmiEntryHash[Bucket]; Item != NULL; Item = Item->HashNext) {
+    ASSERT (Item->Signature == MMI_ENTRY_SIGNATURE);
     if (CompareGuid (&Item->HandlerType, HandlerType)) {
       //
       // This is the MMI entry
@@ -92,9 +119,11 @@ MmCoreFindMmiEntry (
       InitializeListHead (&MmiEntry->MmiHandlers);
 
       //
-      // Add it to MMI entry list
+      // Add it to MMI entry list and index
       //
       InsertTailList (&mMmiEntryList, &MmiEntry->AllEntries);
+      MmiEntry->HashNext    = mMmiEntryHash[Bucket];
+      mMmiEntryHash[Bucket] = MmiEntry;
     }
   }
 
@@ -298,6 +327,7 @@ MmiHandlerUnRegister (
 {
   MMI_HANDLER  *MmiHandler;
   MMI_ENTRY    *MmiEntry;
+  MMI_ENTRY    **Link;
 
   MmiHandler = (MMI_HANDLER *)DispatchHandle;
 
@@ -326,6 +356,12 @@ MmiHandlerUnRegister (
     // No handler registered for this interrupt now, remove the MMI_ENTRY
     //
     RemoveEntryList (&MmiEntry->AllEntries);
+    for (Link = &mMmiEntryHash[MmiEntryHash (&MmiEntry->HandlerType)]; *Link != NULL; Link = &(*Link)->HashNext) {
+      if (*Link == MmiEntry) {
+        *Link = MmiEntry->HashNext;
+        break;
+      }
+    }
 
     FreePool (MmiEntry);
   }
@@ -340,6 +340,7 @@ MmEntryPoint (
 {
   EFI_STATUS                 Status;
   EFI_MM_COMMUNICATE_HEADER  *CommunicateHeader;
+  BOOLEAN                    IsCommunicate;
 
   DEBUG ((DEBUG_INFO, "MmEntryPoint ...\n"));
 
@@ -361,6 +362,7 @@ MmEntryPoint (
   // TBD: Mark the InMm flag as TRUE
   //
   gMmCorePrivate->InMm = TRUE;
+  IsCommunicate        = FALSE;
 
   //
   // Check to see if this is a Synchronous MMI sent through the MM Communication
@@ -392,13 +394,17 @@ MmEntryPoint (
       gMmCorePrivate->BufferSize         += OFFSET_OF (EFI_MM_COMMUNICATE_HEADER, Data);
       gMmCorePrivate->CommunicationBuffer = 0;
       gMmCorePrivate->ReturnStatus        = (Status == EFI_SUCCESS) ? EFI_SUCCESS : EFI_NOT_FOUND;
+      IsCommunicate                       = TRUE;
     }
   }
 
   //
-  // Process Asynchronous MMI sources
+  // Process Asynchronous MMI sources, unless the platform has no root MMI
+  // handler that needs to run on a communicate request.
   //
-  MmiManage (NULL, NULL, NULL, NULL);
+  if (!IsCommunicate || !FeaturePcdGet (PcdMmCommunicateSkipRootMmi)) {
+    MmiManage (NULL, NULL, NULL, NULL);
+  }
 
   //
   // TBD: Do not use private data structure ?
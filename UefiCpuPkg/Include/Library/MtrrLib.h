@@ -214,6 +214,9 @@ MtrrGetAllMtrrs (
 /**
   This function sets all MTRRs (variable and fixed)
 
+  When the MTRRs already hold the content of MtrrSetting, nothing is written
+  and the cache is neither disabled nor flushed.
+
   @param[in]  MtrrSetting   A buffer to hold all MTRRs content.
 
   @return The pointer of MtrrSetting
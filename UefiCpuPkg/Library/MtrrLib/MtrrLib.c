@@ -2787,9 +2787,54 @@ MtrrGetAllMtrrs (
   return MtrrSetting;
 }
 
+/**
+  Worker function checks whether all MTRRs (variable and fixed) already hold
+  the content of an MTRR setting buffer.
+
+  @param[in]  MtrrSetting  A buffer holding all MTRRs content.
+
+  @retval TRUE   The MTRRs hold the content of MtrrSetting.
+  @retval FALSE  At least one MTRR differs from MtrrSetting.
+
+**/
+BOOLEAN
+MtrrLibIsAllMtrrsEqual (
+  IN MTRR_SETTINGS  *MtrrSetting
+  )
+{
+  UINT32  Index;
+  UINT32  VariableMtrrCount;
+
+  if (AsmReadMsr64 (MSR_IA32_MTRR_DEF_TYPE) != MtrrSetting->MtrrDefType) {
+    return FALSE;
+  }
+
+  for (Index = 0; Index < MTRR_NUMBER_OF_FIXED_MTRR; Index++) {
+    if (AsmReadMsr64 (mMtrrLibFixedMtrrTable[Index].Msr) != MtrrSetting->Fixed.Mtrr[Index]) {
+      return FALSE;
+    }
+  }
+
+  VariableMtrrCount = GetVariableMtrrCountWorker ();
+  ASSERT (VariableMtrrCount <= ARRAY_SIZE (MtrrSetting->Variables.Mtrr));
+
+  for (Index = 0; Index < VariableMtrrCount; Index++) {
+    if ((AsmReadMsr64 (MSR_IA32_MTRR_PHYSBASE0 + (Index << 1)) != MtrrSetting->Variables.Mtrr[Index].Base) ||
+        (AsmReadMsr64 (MSR_IA32_MTRR_PHYSMASK0 + (Index << 1)) != MtrrSetting->Variables.Mtrr[Index].Mask))
+    {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
 /**
   This function sets all MTRRs (variable and fixed)
 
+  When the MTRRs already hold the content of MtrrSetting, nothing is written
+  and the cache is neither disabled nor flushed.
+
   @param[in]  MtrrSetting  A buffer holding all MTRRs content.
 
   @retval The pointer of MtrrSetting
@@ -2807,6 +2852,15 @@ MtrrSetAllMtrrs (
     return MtrrSetting;
   }
 
+  //
+  // The settings are replayed on every AP and again on S3 resume, where most
+  // processors already hold them. Reading the MSRs is far cheaper than the
+  // cache disable and write-back invalidate needed to program them.
+  //
+  if (MtrrLibIsAllMtrrsEqual (MtrrSetting)) {
+    return MtrrSetting;
+  }
+
   MtrrLibPreMtrrChange (&MtrrContext);
 
   //
@@ -32,6 +32,11 @@ STATIC MTRR_LIB_SYSTEM_PARAMETER  mSystemParameters[] = {
   { 48, TRUE, TRUE, CacheWriteCombining, 12 },
 };
 
+STATIC MTRR_LIB_SYSTEM_PARAMETER  mBenchmarkSystemParameters[] = {
+  { 48, TRUE, TRUE, CacheUncacheable, MTRR_NUMBER_OF_VARIABLE_MTRR },
+  { 48, TRUE, TRUE, CacheWriteBack,   MTRR_NUMBER_OF_VARIABLE_MTRR },
+};
+
 UINT32  mFixedMtrrsIndex[] = {
   MSR_IA32_MTRR_FIX64K_00000,
   MSR_IA32_MTRR_FIX16K_80000,
@@ -65,6 +70,19 @@ typedef struct {
   CONST MTRR_LIB_SYSTEM_PARAMETER    *SystemParameter;
 } MTRR_LIB_GET_FIRMWARE_VARIABLE_MTRR_COUNT_CONTEXT;
 
+//
+// Context structure to be used for the MtrrSetMemoryAttributesInMtrrSettings() benchmark.
+//
+typedef struct {
+  CONST MTRR_LIB_SYSTEM_PARAMETER    *SystemParameter;
+  MTRR_MEMORY_RANGE                  Ranges[MTRR_NUMBER_OF_FIXED_MTRR * sizeof (UINT64) + 2 * MTRR_NUMBER_OF_VARIABLE_MTRR + 1];
+  UINTN                              RangeCount;
+  VOID                               *Scratch;
+  UINTN                              ScratchSize;
+} MTRR_LIB_BENCHMARK_CONTEXT;
+
+STATIC MTRR_LIB_BENCHMARK_CONTEXT  mBenchmarkContexts[ARRAY_SIZE (mBenchmarkSystemParameters)];
+
 STATIC CHAR8  *mCacheDescription[] = { "UC", "WC", "N/A", "N/A", "WT", "WP", "WB" };
 
 /**
@@ -299,6 +317,120 @@ UnitTestMtrrSetMemoryAttributesInMtrrSettings (
   return UNIT_TEST_PASSED;
 }
 
+/**
+  Prepare the MtrrSetMemoryAttributesInMtrrSettings() benchmark: generate a
+  memory layout that needs all the firmware variable MTRRs and a scratch
+  buffer big enough to calculate it.
+
+  @param[in]  Context    Pointer to MTRR_LIB_BENCHMARK_CONTEXT.
+
+  @retval  UNIT_TEST_PASSED                      The benchmark is ready.
+  @retval  UNIT_TEST_ERROR_PREREQUISITE_NOT_MET  The layout cannot be set.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+BenchmarkMtrrSetMemoryAttributesPrerequisite (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  MTRR_LIB_BENCHMARK_CONTEXT  *BenchmarkContext;
+  MTRR_MEMORY_RANGE           RawMtrrRange[MTRR_NUMBER_OF_VARIABLE_MTRR];
+  UINT32                      MtrrCount;
+  UINT32                      PerTypeCount;
+  MTRR_SETTINGS               LocalMtrrs;
+  RETURN_STATUS               Status;
+
+  BenchmarkContext = (MTRR_LIB_BENCHMARK_CONTEXT *)Context;
+  InitializeMtrrRegs ((MTRR_LIB_SYSTEM_PARAMETER *)BenchmarkContext->SystemParameter);
+
+  MtrrCount    = BenchmarkContext->SystemParameter->VariableMtrrCount - PatchPcdGet32 (PcdCpuNumberOfReservedVariableMtrrs);
+  PerTypeCount = MtrrCount / 5;
+  GenerateValidAndConfigurableMtrrPairs (
+    BenchmarkContext->SystemParameter->PhysicalAddressBits,
+    RawMtrrRange,
+    MtrrCount - 4 * PerTypeCount,
+    PerTypeCount,
+    PerTypeCount,
+    PerTypeCount,
+    PerTypeCount
+    );
+
+  BenchmarkContext->RangeCount = ARRAY_SIZE (BenchmarkContext->Ranges);
+  GetEffectiveMemoryRanges (
+    BenchmarkContext->SystemParameter->DefaultCacheType,
+    BenchmarkContext->SystemParameter->PhysicalAddressBits,
+    RawMtrrRange,
+    MtrrCount,
+    BenchmarkContext->Ranges,
+    &BenchmarkContext->RangeCount
+    );
+
+  ZeroMem (&LocalMtrrs, sizeof (LocalMtrrs));
+  LocalMtrrs.MtrrDefType        = MtrrGetDefaultMemoryType ();
+  BenchmarkContext->ScratchSize = SCRATCH_BUFFER_SIZE;
+  BenchmarkContext->Scratch     = malloc (BenchmarkContext->ScratchSize);
+  Status                        = MtrrSetMemoryAttributesInMtrrSettings (&LocalMtrrs, BenchmarkContext->Scratch, &BenchmarkContext->ScratchSize, BenchmarkContext->Ranges, BenchmarkContext->RangeCount);
+  if (Status == RETURN_BUFFER_TOO_SMALL) {
+    BenchmarkContext->Scratch = realloc (BenchmarkContext->Scratch, BenchmarkContext->ScratchSize);
+    Status                    = MtrrSetMemoryAttributesInMtrrSettings (&LocalMtrrs, BenchmarkContext->Scratch, &BenchmarkContext->ScratchSize, BenchmarkContext->Ranges, BenchmarkContext->RangeCount);
+  }
+
+  if (RETURN_ERROR (Status)) {
+    return UNIT_TEST_ERROR_PREREQUISITE_NOT_MET;
+  }
+
+  UT_LOG_INFO ("Memory ranges [%d] need %d variable MTRRs\n", BenchmarkContext->RangeCount, MtrrCount);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Free the scratch buffer of the MtrrSetMemoryAttributesInMtrrSettings() benchmark.
+
+  @param[in]  Context    Pointer to MTRR_LIB_BENCHMARK_CONTEXT.
+**/
+VOID
+EFIAPI
+BenchmarkMtrrSetMemoryAttributesCleanUp (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  MTRR_LIB_BENCHMARK_CONTEXT  *BenchmarkContext;
+
+  BenchmarkContext = (MTRR_LIB_BENCHMARK_CONTEXT *)Context;
+  free (BenchmarkContext->Scratch);
+  BenchmarkContext->Scratch = NULL;
+}
+
+/**
+  Benchmark of MtrrLib service MtrrSetMemoryAttributesInMtrrSettings(): calculate
+  the variable MTRRs of a random layout that needs all of them.
+
+  @param[in]  Context     Pointer to MTRR_LIB_BENCHMARK_CONTEXT.
+  @param[in]  Iterations  The number of calculations.
+**/
+VOID
+EFIAPI
+BenchmarkMtrrSetMemoryAttributes (
+  IN UNIT_TEST_CONTEXT  Context,
+  IN UINTN              Iterations
+  )
+{
+  MTRR_LIB_BENCHMARK_CONTEXT  *BenchmarkContext;
+  MTRR_SETTINGS               LocalMtrrs;
+  UINTN                       ScratchSize;
+  UINTN                       Index;
+
+  BenchmarkContext = (MTRR_LIB_BENCHMARK_CONTEXT *)Context;
+  for (Index = 0; Index < Iterations; Index++) {
+    ZeroMem (&LocalMtrrs, sizeof (LocalMtrrs));
+    LocalMtrrs.MtrrDefType = BenchmarkContext->SystemParameter->DefaultCacheType;
+    ScratchSize            = BenchmarkContext->ScratchSize;
+    MtrrSetMemoryAttributesInMtrrSettings (&LocalMtrrs, BenchmarkContext->Scratch, &ScratchSize, BenchmarkContext->Ranges, BenchmarkContext->RangeCount);
+  }
+
+  UT_BENCHMARK_KEEP (LocalMtrrs.Variables.Mtrr[0].Mask);
+}
+
 /**
   Test routine to check whether invalid base/size can be rejected.
 
@@ -756,6 +888,26 @@ UnitTestMtrrSetAllMtrrs (
     UT_ASSERT_EQUAL (AsmReadMsr64 (MSR_IA32_MTRR_PHYSMASK0 + (Index << 1)), Mtrrs.Variables.Mtrr[Index].Mask);
   }
 
+  //
+  // Setting the same MTRRs again must not write any MSR.
+  //
+  mMtrrMsrWriteCount = 0;
+  Result             = MtrrSetAllMtrrs (&Mtrrs);
+  UT_ASSERT_EQUAL ((UINTN)Result, (UINTN)&Mtrrs);
+  UT_ASSERT_EQUAL (mMtrrMsrWriteCount, 0);
+
+  //
+  // A change in the last variable MTRR must still be programmed.
+  //
+  Index = SystemParameter.VariableMtrrCount - 1;
+  GenerateRandomMtrrPair (SystemParameter.PhysicalAddressBits, GenerateRandomCacheType (), &Mtrrs.Variables.Mtrr[Index], NULL);
+  Result = MtrrSetAllMtrrs (&Mtrrs);
+  UT_ASSERT_EQUAL ((UINTN)Result, (UINTN)&Mtrrs);
+  UT_ASSERT_NOT_EQUAL (mMtrrMsrWriteCount, 0);
+  UT_ASSERT_EQUAL (AsmReadMsr64 (MSR_IA32_MTRR_DEF_TYPE), Mtrrs.MtrrDefType);
+  UT_ASSERT_EQUAL (AsmReadMsr64 (MSR_IA32_MTRR_PHYSBASE0 + (Index << 1)), Mtrrs.Variables.Mtrr[Index].Base);
+  UT_ASSERT_EQUAL (AsmReadMsr64 (MSR_IA32_MTRR_PHYSMASK0 + (Index << 1)), Mtrrs.Variables.Mtrr[Index].Mask);
+
   return UNIT_TEST_PASSED;
 }
 
@@ -1093,6 +1245,7 @@ UnitTestingEntry (
   EFI_STATUS                                         Status;
   UNIT_TEST_FRAMEWORK_HANDLE                         Framework;
   UNIT_TEST_SUITE_HANDLE                             MtrrApiTests;
+  UNIT_TEST_SUITE_HANDLE                             MtrrBenchmarks;
   UINTN                                              Index;
   UINTN                                              SystemIndex;
   MTRR_LIB_TEST_CONTEXT                              Context;
@@ -1144,6 +1297,21 @@ UnitTestingEntry (
     }
   }
 
+  //
+  // Populate the MtrrLib Benchmark Suite.
+  //
+  Status = CreateUnitTestSuite (&MtrrBenchmarks, Framework, "MtrrLib Benchmarks", "MtrrLib.Benchmark", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for MtrrLib Benchmarks\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  for (SystemIndex = 0; SystemIndex < ARRAY_SIZE (mBenchmarkSystemParameters); SystemIndex++) {
+    mBenchmarkContexts[SystemIndex].SystemParameter = &mBenchmarkSystemParameters[SystemIndex];
+    AddBenchmarkCase (MtrrBenchmarks, "Benchmark MtrrSetMemoryAttributesInMtrrSettings", "MtrrSetMemoryAttributesInMtrrSettings", BenchmarkMtrrSetMemoryAttributes, BenchmarkMtrrSetMemoryAttributesPrerequisite, BenchmarkMtrrSetMemoryAttributesCleanUp, &mBenchmarkContexts[SystemIndex]);
+  }
+
   //
   // Execute the tests.
   //
@@ -44,6 +44,7 @@ typedef struct {
 
 extern UINT32   mFixedMtrrsIndex[];
 extern BOOLEAN  mRandomInput;
+extern UINTN    mMtrrMsrWriteCount;
 
 /**
   Initialize the MTRR registers.
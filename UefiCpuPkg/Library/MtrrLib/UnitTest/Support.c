@@ -19,6 +19,7 @@ MSR_IA32_MTRR_DEF_TYPE_REGISTER  mDefTypeMsr;
 MSR_IA32_MTRRCAP_REGISTER        mMtrrCapMsr;
 CPUID_VERSION_INFO_EDX           mCpuidVersionInfoEdx;
 CPUID_VIR_PHY_ADDRESS_SIZE_EAX   mCpuidVirPhyAddressSizeEax;
+UINTN                            mMtrrMsrWriteCount;
 
 BOOLEAN       mRandomInput;
 UINTN         mNumberIndex = 0;
@@ -233,6 +234,8 @@ UnitTestMtrrLibAsmWriteMsr64 (
 {
   UINT32  Index;
 
+  mMtrrMsrWriteCount++;
+
   for (Index = 0; Index < ARRAY_SIZE (mFixedMtrrsValue); Index++) {
     if (MsrIndex == mFixedMtrrsIndex[Index]) {
       mFixedMtrrsValue[Index] = Value;
@@ -0,0 +1,199 @@
+/** @file
+  UnitTestLib APIs to run benchmark cases
+
+  Benchmark cases are regular test cases whose test function is
+  UnitTestBenchmarkRunner().  The runner calibrates the iteration count of a
+  sample against the performance counter, warms the benchmark up, then records
+  the min, median, 99th percentile and max time of one iteration.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#include <Uefi.h>
+#include <UnitTestFrameworkTypes.h>
+#include <Library/UnitTestLib.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/TimerLib.h>
+
+///
+/// Written by UnitTestBenchmarkKeep() so that benchmark results stay live.
+///
+volatile UINT64  mUnitTestBenchmarkSink;
+
+/**
+  Sink for values produced in benchmark loops.  Use UT_BENCHMARK_KEEP() rather
+  than calling this function directly.
+
+  @param[in]  Value  Value to consume.
+**/
+VOID
+EFIAPI
+UnitTestBenchmarkKeep (
+  IN UINT64  Value
+  )
+{
+  mUnitTestBenchmarkSink = Value;
+}
+
+/**
+  Runs one sample of a benchmark case and returns its duration.
+
+  @param[in]  Test        The benchmark case.
+  @param[in]  Iterations  The iteration count of the sample.
+  @param[in]  Start       The value the performance counter starts with.
+  @param[in]  End         The value the performance counter ends with.
+
+  @return  The duration of the sample in nanoseconds.
+**/
+STATIC
+UINT64
+RunBenchmarkSample (
+  IN UNIT_TEST  *Test,
+  IN UINTN      Iterations,
+  IN UINT64     Start,
+  IN UINT64     End
+  )
+{
+  UINT64  Begin;
+  UINT64  Finish;
+  UINT64  Ticks;
+
+  Begin = GetPerformanceCounter ();
+  Test->RunBenchmark (Test->Context, Iterations);
+  Finish = GetPerformanceCounter ();
+
+  if (Start < End) {
+    Ticks = (Finish >= Begin) ? (Finish - Begin) : ((End - Begin) + (Finish - Start) + 1);
+  } else {
+    Ticks = (Begin >= Finish) ? (Begin - Finish) : ((Begin - End) + (Start - Finish) + 1);
+  }
+
+  return GetTimeInNanoSecond (Ticks);
+}
+
+/**
+  Sorts samples in ascending order.
+
+  @param[in, out]  Samples  The samples to sort.
+  @param[in]       Count    The number of samples.
+**/
+STATIC
+VOID
+SortBenchmarkSamples (
+  IN OUT UINT64  *Samples,
+  IN     UINTN   Count
+  )
+{
+  UINTN   Index;
+  UINTN   Insert;
+  UINT64  Sample;
+
+  for (Index = 1; Index < Count; Index++) {
+    Sample = Samples[Index];
+    for (Insert = Index; (Insert > 0) && (Samples[Insert - 1] > Sample); Insert--) {
+      Samples[Insert] = Samples[Insert - 1];
+    }
+
+    Samples[Insert] = Sample;
+  }
+}
+
+/**
+  Runs the benchmark function of the currently executing test case and records
+  its timing statistics.  This is the UNIT_TEST_FUNCTION of every test case
+  added by AddBenchmarkCase().
+
+  @param[in]  Context    The context of the benchmark case.
+
+  @retval  UNIT_TEST_PASSED  The benchmark was measured.
+  @retval  UNIT_TEST_SKIPPED The performance counter does not advance.
+
+**/
+UNIT_TEST_STATUS
+EFIAPI
+UnitTestBenchmarkRunner (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UNIT_TEST_FRAMEWORK         *Framework;
+  UNIT_TEST                   *Test;
+  UNIT_TEST_BENCHMARK_RESULT  *Result;
+  UINT64                      *Samples;
+  UINT64                      Start;
+  UINT64                      End;
+  UINT64                      Duration;
+  UINTN                       Iterations;
+  UINTN                       Index;
+
+  Framework = (UNIT_TEST_FRAMEWORK *)GetActiveFrameworkHandle ();
+  Test      = Framework->CurrentTest;
+  ASSERT ((Test != NULL) && (Test->RunBenchmark != NULL));
+  Result = &Test->BenchmarkResult;
+  ZeroMem (Result, sizeof (*Result));
+
+  if (GetPerformanceCounterProperties (&Start, &End) == 0) {
+    UT_LOG_WARNING ("No performance counter, benchmark %a skipped\n", Test->Name);
+    return UNIT_TEST_SKIPPED;
+  }
+
+  //
+  // Calibrate: double the iteration count until one sample is long enough to
+  // be measured accurately. This also warms up caches and branch predictors.
+  //
+  Iterations = 1;
+  Duration   = RunBenchmarkSample (Test, Iterations, Start, End);
+  while ((Duration < UNIT_TEST_BENCHMARK_MIN_SAMPLE_TIME) && (Iterations < UNIT_TEST_BENCHMARK_MAX_ITERATIONS)) {
+    if ((Duration == 0) && (Iterations >= UNIT_TEST_BENCHMARK_STALLED_ITERATIONS)) {
+      break;
+    }
+
+    Iterations *= 2;
+    Duration    = RunBenchmarkSample (Test, Iterations, Start, End);
+  }
+
+  if (Duration == 0) {
+    UT_LOG_WARNING ("Performance counter does not advance, benchmark %a skipped\n", Test->Name);
+    return UNIT_TEST_SKIPPED;
+  }
+
+  for (Index = 0; Index < UNIT_TEST_BENCHMARK_WARMUP_SAMPLES; Index++) {
+    RunBenchmarkSample (Test, Iterations, Start, End);
+  }
+
+  Samples = AllocatePool (UNIT_TEST_BENCHMARK_SAMPLES * sizeof (UINT64));
+  UT_ASSERT_NOT_NULL (Samples);
+
+  for (Index = 0; Index < UNIT_TEST_BENCHMARK_SAMPLES; Index++) {
+    Samples[Index] = RunBenchmarkSample (Test, Iterations, Start, End);
+  }
+
+  SortBenchmarkSamples (Samples, UNIT_TEST_BENCHMARK_SAMPLES);
+
+  //
+  // Convert the sample durations to picoseconds per iteration. The 99th
+  // percentile uses the nearest-rank method.
+  //
+  Result->Iterations  = Iterations;
+  Result->SampleCount = UNIT_TEST_BENCHMARK_SAMPLES;
+  Result->Min         = DivU64x64Remainder (MultU64x32 (Samples[0], 1000), Iterations, NULL);
+  Result->Median      = DivU64x64Remainder (MultU64x32 (Samples[UNIT_TEST_BENCHMARK_SAMPLES / 2], 1000), Iterations, NULL);
+  Result->P99         = DivU64x64Remainder (MultU64x32 (Samples[(UNIT_TEST_BENCHMARK_SAMPLES * 99 + 99) / 100 - 1], 1000), Iterations, NULL);
+  Result->Max         = DivU64x64Remainder (MultU64x32 (Samples[UNIT_TEST_BENCHMARK_SAMPLES - 1], 1000), Iterations, NULL);
+  FreePool (Samples);
+
+  UT_LOG_INFO (
+    "{\"benchmark\": \"%a\", \"iterations\": %ld, \"samples\": %d, \"min_ps\": %ld, \"median_ps\": %ld, \"p99_ps\": %ld, \"max_ps\": %ld}\n",
+    Test->Name,
+    Result->Iterations,
+    Result->SampleCount,
+    Result->Min,
+    Result->Median,
+    Result->P99,
+    Result->Max
+    );
+
+  return UNIT_TEST_PASSED;
+}
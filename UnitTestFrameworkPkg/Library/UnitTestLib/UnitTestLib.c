@@ -509,6 +509,78 @@ Exit:
   return Status;
 }
 
+/**
+  Adds benchmark case to Suite
+
+  A benchmark case is run in sequence with the test cases of Suite.  It passes
+  unless its prerequisite fails or it triggers a test assertion, and its timing
+  statistics are reported through UnitTestResultReportLib and the test log.
+
+  @param[in]  SuiteHandle   Unit test suite to add benchmark to.
+  @param[in]  Description   Null-terminated ASCII string that is the user
+                            friendly description of a benchmark.  String is
+                            copied.
+  @param[in]  Name          Null-terminated ASCII string that is the short name
+                            of the benchmark with no spaces.  String is copied.
+  @param[in]  Function      Benchmark function.
+  @param[in]  Prerequisite  Prerequisite function, runs before benchmark.  This
+                            is an optional parameter that may be NULL.
+  @param[in]  CleanUp       Clean up function, runs after benchmark.  This is
+                            an optional parameter that may be NULL.
+  @param[in]  Context       Pointer to context.    This is an optional parameter
+                            that may be NULL.
+
+  @retval  EFI_SUCCESS            The benchmark case was added to Suite.
+  @retval  EFI_INVALID_PARAMETER  SuiteHandle is NULL.
+  @retval  EFI_INVALID_PARAMETER  Description is NULL.
+  @retval  EFI_INVALID_PARAMETER  Name is NULL.
+  @retval  EFI_INVALID_PARAMETER  Function is NULL.
+  @retval  EFI_UNSUPPORTED        PcdUnitTestBenchmarkEnable is FALSE, so there
+                                  is no performance counter to time the
+                                  benchmark with.
+  @retval  EFI_OUT_OF_RESOURCES   There are not enough resources available to
+                                  add the benchmark case to Suite.
+**/
+EFI_STATUS
+EFIAPI
+AddBenchmarkCase (
+  IN UNIT_TEST_SUITE_HANDLE        SuiteHandle,
+  IN CHAR8                         *Description,
+  IN CHAR8                         *Name,
+  IN UNIT_TEST_BENCHMARK_FUNCTION  Function,
+  IN UNIT_TEST_PREREQUISITE        Prerequisite  OPTIONAL,
+  IN UNIT_TEST_CLEANUP             CleanUp       OPTIONAL,
+  IN UNIT_TEST_CONTEXT             Context       OPTIONAL
+  )
+{
+  EFI_STATUS            Status;
+  UNIT_TEST_SUITE       *Suite;
+  UNIT_TEST_LIST_ENTRY  *NewTestEntry;
+
+  if (Function == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (!PcdGetBool (PcdUnitTestBenchmarkEnable)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  //
+  // Add a regular test case that runs the benchmark, then tag it as a
+  // benchmark. On success AddTestCase() appends it to the suite.
+  //
+  Status = AddTestCase (SuiteHandle, Description, Name, UnitTestBenchmarkRunner, Prerequisite, CleanUp, Context);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Suite                         = (UNIT_TEST_SUITE *)SuiteHandle;
+  NewTestEntry                  = (UNIT_TEST_LIST_ENTRY *)GetPreviousNode (&Suite->TestCaseList, &Suite->TestCaseList);
+  NewTestEntry->UT.RunBenchmark = Function;
+
+  return EFI_SUCCESS;
+}
+
 STATIC
 VOID
 UpdateTestFromSave (
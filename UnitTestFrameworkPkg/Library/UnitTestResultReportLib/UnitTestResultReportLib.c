@@ -38,6 +38,7 @@ struct _UNIT_TEST_STATUS_STRING  mStatusStrings[] = {
   { UNIT_TEST_ERROR_TEST_FAILED,          "FAILED"                        },
   { UNIT_TEST_RUNNING,                    "RUNNING"                       },
   { UNIT_TEST_PENDING,                    "PENDING"                       },
+  { UNIT_TEST_SKIPPED,                    "SKIPPED"                       },
   { 0,                                    "**UNKNOWN**"                   }
 };
 
@@ -106,6 +107,95 @@ GetStringForFailureType (
   return mFailureTypeStrings[Index].String;
 }
 
+/*
+  Print a benchmark time in nanoseconds.
+
+  @param[in]  Label  The label of the time.
+  @param[in]  Time   The time in picoseconds.
+*/
+STATIC
+VOID
+OutputBenchmarkTime (
+  IN CONST CHAR8  *Label,
+  IN UINT64       Time
+  )
+{
+  UINT32  Remainder;
+  UINT64  Nanoseconds;
+
+  Nanoseconds = DivU64x32Remainder (Time, 1000, &Remainder);
+  ReportPrint ("   %a%ld.%03d ns\n", Label, Nanoseconds, Remainder);
+}
+
+/*
+  Print the timing statistics of a benchmark case.
+
+  @param[in]  Result  The benchmark statistics.
+*/
+STATIC
+VOID
+OutputBenchmarkResult (
+  IN UNIT_TEST_BENCHMARK_RESULT  *Result
+  )
+{
+  ReportPrint ("  BENCHMARK: %ld iterations x %d samples\n", Result->Iterations, Result->SampleCount);
+  OutputBenchmarkTime ("MIN:     ", Result->Min);
+  OutputBenchmarkTime ("MEDIAN:  ", Result->Median);
+  OutputBenchmarkTime ("P99:     ", Result->P99);
+  OutputBenchmarkTime ("MAX:     ", Result->Max);
+}
+
+/*
+  Print the statistics of all the benchmark cases as a JSON array, so that they
+  can be collected by CI from the report.
+
+  @param[in]  Framework  The unit test framework.
+*/
+STATIC
+VOID
+OutputBenchmarkJson (
+  IN UNIT_TEST_FRAMEWORK  *Framework
+  )
+{
+  UNIT_TEST_SUITE_LIST_ENTRY  *Suite;
+  UNIT_TEST_LIST_ENTRY        *Test;
+  UNIT_TEST_BENCHMARK_RESULT  *Result;
+  BOOLEAN                     First;
+
+  First = TRUE;
+  for (Suite = (UNIT_TEST_SUITE_LIST_ENTRY *)GetFirstNode (&Framework->TestSuiteList);
+       (LIST_ENTRY *)Suite != &Framework->TestSuiteList;
+       Suite = (UNIT_TEST_SUITE_LIST_ENTRY *)GetNextNode (&Framework->TestSuiteList, (LIST_ENTRY *)Suite))
+  {
+    for (Test = (UNIT_TEST_LIST_ENTRY *)GetFirstNode (&(Suite->UTS.TestCaseList));
+         (LIST_ENTRY *)Test != &(Suite->UTS.TestCaseList);
+         Test = (UNIT_TEST_LIST_ENTRY *)GetNextNode (&(Suite->UTS.TestCaseList), (LIST_ENTRY *)Test))
+    {
+      Result = &Test->UT.BenchmarkResult;
+      if ((Test->UT.RunBenchmark == NULL) || (Result->SampleCount == 0)) {
+        continue;
+      }
+
+      if (First) {
+        ReportPrint ("BENCHMARK RESULTS (JSON)\n[\n");
+        First = FALSE;
+      } else {
+        ReportPrint (",\n");
+      }
+
+      ReportPrint ("  {\"suite\": \"%a\", \"benchmark\": \"%a\", ", Suite->UTS.Name, Test->UT.Name);
+      ReportPrint ("\"iterations\": %ld, \"samples\": %d, ", Result->Iterations, Result->SampleCount);
+      ReportPrint ("\"min_ps\": %ld, \"median_ps\": %ld, ", Result->Min, Result->Median);
+      ReportPrint ("\"p99_ps\": %ld, \"max_ps\": %ld}", Result->P99, Result->Max);
+    }
+  }
+
+  if (!First) {
+    ReportPrint ("\n]\n");
+    ReportPrint ("=========================================================\n");
+  }
+}
+
 /*
   Method to print the Unit Test run results
 
@@ -174,6 +264,10 @@ OutputUnitTestFrameworkReport (
       ReportPrint ("  FAILURE: %a\n", GetStringForFailureType (Test->UT.FailureType));
       ReportPrint ("  FAILURE MESSAGE:\n%a\n", Test->UT.FailureMessage);
 
+      if ((Test->UT.RunBenchmark != NULL) && (Test->UT.BenchmarkResult.SampleCount != 0)) {
+        OutputBenchmarkResult (&Test->UT.BenchmarkResult);
+      }
+
       if (Test->UT.Log != NULL) {
         ReportPrint ("  LOG:\n");
         ReportOutput (Test->UT.Log);
@@ -217,5 +311,7 @@ OutputUnitTestFrameworkReport (
   ReportPrint (" Not Run: %d  (%d%%)\n", NotRun, (NotRun * 100) / (Passed + Failed + NotRun));
   ReportPrint ("=========================================================\n");
 
+  OutputBenchmarkJson (Framework);
+
   return EFI_SUCCESS;
 }
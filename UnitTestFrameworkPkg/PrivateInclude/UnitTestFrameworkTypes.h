@@ -46,22 +46,69 @@ typedef UINT32 FAILURE_TYPE;
 #define FAILURETYPE_ASSERTNOTNULL      (8)
 #define FAILURETYPE_EXPECTASSERT       (9)
 
+///
+/// The number of timed samples collected for a benchmark case
+///
+#define UNIT_TEST_BENCHMARK_SAMPLES  (100)
+
+///
+/// The number of untimed samples run before a benchmark case is measured
+///
+#define UNIT_TEST_BENCHMARK_WARMUP_SAMPLES  (3)
+
+///
+/// The minimum duration of one sample of a benchmark case, in nanoseconds.
+/// The iteration count of the samples is doubled until a sample lasts at
+/// least this long.
+///
+#define UNIT_TEST_BENCHMARK_MIN_SAMPLE_TIME  (1000000)
+
+///
+/// The maximum iteration count of one sample of a benchmark case
+///
+#define UNIT_TEST_BENCHMARK_MAX_ITERATIONS  (BIT30)
+
+///
+/// The iteration count at which calibration gives up if the performance
+/// counter has not advanced at all
+///
+#define UNIT_TEST_BENCHMARK_STALLED_ITERATIONS  (BIT20)
+
+///
+/// Timing statistics of a benchmark case.  Times are per iteration, in
+/// picoseconds.
+///
+typedef struct {
+  UINT64    Iterations;   // Iterations per sample
+  UINT32    SampleCount;  // 0 if the benchmark has not been measured
+  UINT64    Min;
+  UINT64    Median;
+  UINT64    P99;
+  UINT64    Max;
+} UNIT_TEST_BENCHMARK_RESULT;
+
 ///
 /// Unit Test context structure tracked by the unit test framework.
 ///
 typedef struct {
-  CHAR8                     *Description;
-  CHAR8                     *Name; // can't have spaces and should be short
-  CHAR8                     *Log;
-  FAILURE_TYPE              FailureType;
-  CHAR8                     FailureMessage[UNIT_TEST_TESTFAILUREMSG_LENGTH];
-  UINT8                     Fingerprint[UNIT_TEST_FINGERPRINT_SIZE];
-  UNIT_TEST_STATUS          Result;
-  UNIT_TEST_FUNCTION        RunTest;
-  UNIT_TEST_PREREQUISITE    Prerequisite;
-  UNIT_TEST_CLEANUP         CleanUp;
-  UNIT_TEST_CONTEXT         Context;
-  UNIT_TEST_SUITE_HANDLE    ParentSuite;
+  CHAR8                           *Description;
+  CHAR8                           *Name; // can't have spaces and should be short
+  CHAR8                           *Log;
+  FAILURE_TYPE                    FailureType;
+  CHAR8                           FailureMessage[UNIT_TEST_TESTFAILUREMSG_LENGTH];
+  UINT8                           Fingerprint[UNIT_TEST_FINGERPRINT_SIZE];
+  UNIT_TEST_STATUS                Result;
+  UNIT_TEST_FUNCTION              RunTest;
+  UNIT_TEST_PREREQUISITE          Prerequisite;
+  UNIT_TEST_CLEANUP               CleanUp;
+  UNIT_TEST_CONTEXT               Context;
+  UNIT_TEST_SUITE_HANDLE          ParentSuite;
+  //
+  // Only set for the benchmark cases added by AddBenchmarkCase(), whose
+  // RunTest is the framework's benchmark runner.
+  //
+  UNIT_TEST_BENCHMARK_FUNCTION    RunBenchmark;
+  UNIT_TEST_BENCHMARK_RESULT      BenchmarkResult;
 } UNIT_TEST;
 
 ///
@@ -166,6 +213,23 @@ UnitTestLogInit (
   IN UINTN          BufferSize  OPTIONAL
   );
 
+/**
+  Runs the benchmark function of the currently executing test case and records
+  its timing statistics.  This is the UNIT_TEST_FUNCTION of every test case
+  added by AddBenchmarkCase().
+
+  @param[in]  Context    The context of the benchmark case.
+
+  @retval  UNIT_TEST_PASSED  The benchmark was measured.
+  @retval  UNIT_TEST_SKIPPED The performance counter does not advance.
+
+**/
+UNIT_TEST_STATUS
+EFIAPI
+UnitTestBenchmarkRunner (
+  IN UNIT_TEST_CONTEXT  Context
+  );
+
 /**
   Internal helper function to return a handle to the currently executing framework.
   This function is generally used for communication within the UnitTest framework, but is